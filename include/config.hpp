@@ -22,6 +22,9 @@ class Config {
 	std::string _worldName;
 	std::string _gamemode;
 	std::string _difficulty;
+	int			_chunkCacheSize;	// MiB of decoded chunks kept in memory
+	std::string _regionCompression; // compression of the chunks we write: gzip, deflate, none or lz4
+	int			_viewDistance;		// cap on the view distance a client asks for, in chunks
 
   public:
 	Config();
@@ -38,6 +41,9 @@ class Config {
 	std::string getWorldName();
 	std::string getGamemode();
 	std::string getDifficulty();
+	int			getChunkCacheSize();
+	std::string getRegionCompression();
+	int			getViewDistance();
 
 	void setProtocolVersion(int ProtoVersion);
 	void setServerSize(int ServerSize);
@@ -48,6 +54,9 @@ class Config {
 	void setWorldName(std::string WorldName);
 	void setGamemode(std::string Gamemode);
 	void setDifficulty(std::string Difficulty);
+	void setChunkCacheSize(int ChunkCacheSize);
+	void setRegionCompression(std::string RegionCompression);
+	void setViewDistance(int ViewDistance);
 };
 
 #endif
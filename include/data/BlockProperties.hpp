@@ -0,0 +1,116 @@
+#ifndef BLOCK_PROPERTIES_HPP
+#define BLOCK_PROPERTIES_HPP
+
+#include "BlockStates.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// How blocks let light through and stop movement, which the generated state table does not carry. Hand-maintained
+// from the vanilla block definitions: blocks are classified by name, anything neither listed nor matched by a suffix
+// is a full, opaque, solid cube. Shared by the light engine and the heightmaps.
+namespace BlockProperties {
+	inline constexpr uint8_t AIR	   = 1 << 0;
+	inline constexpr uint8_t CLEAR	   = 1 << 1; // light passes without losing a level: plants, glass, partial blocks
+	inline constexpr uint8_t DIMMING   = 1 << 2; // light crossing it loses one level
+	inline constexpr uint8_t NON_SOLID = 1 << 3; // no collision box, or one too small to stand on
+	inline constexpr uint8_t FLUID	   = 1 << 4; // a fluid, or a block that always holds water
+	inline constexpr uint8_t LEAVES	   = 1 << 5;
+
+	struct Entry {
+		std::string_view name;
+		uint8_t			 flags;
+	};
+
+	inline constexpr Entry BLOCKS[] = {
+		{"minecraft:activator_rail", CLEAR | NON_SOLID}, {"minecraft:air", AIR | CLEAR}, {"minecraft:allium", CLEAR | NON_SOLID},
+		{"minecraft:amethyst_cluster", CLEAR}, {"minecraft:anvil", CLEAR}, {"minecraft:attached_melon_stem", CLEAR | NON_SOLID},
+		{"minecraft:attached_pumpkin_stem", CLEAR | NON_SOLID}, {"minecraft:azalea", CLEAR}, {"minecraft:azure_bluet", CLEAR | NON_SOLID},
+		{"minecraft:bamboo", CLEAR}, {"minecraft:barrier", CLEAR}, {"minecraft:beacon", DIMMING}, {"minecraft:beetroots", CLEAR | NON_SOLID},
+		{"minecraft:bell", CLEAR}, {"minecraft:big_dripleaf", CLEAR}, {"minecraft:big_dripleaf_stem", CLEAR | NON_SOLID},
+		{"minecraft:blue_orchid", CLEAR | NON_SOLID}, {"minecraft:brewing_stand", CLEAR}, {"minecraft:brown_mushroom", CLEAR | NON_SOLID},
+		{"minecraft:bubble_column", DIMMING | FLUID}, {"minecraft:bush", CLEAR | NON_SOLID}, {"minecraft:cactus", CLEAR},
+		{"minecraft:cactus_flower", CLEAR | NON_SOLID}, {"minecraft:cake", CLEAR}, {"minecraft:calibrated_sculk_sensor", CLEAR},
+		{"minecraft:campfire", CLEAR}, {"minecraft:candle", CLEAR | NON_SOLID}, {"minecraft:carrots", CLEAR | NON_SOLID},
+		{"minecraft:cauldron", CLEAR}, {"minecraft:cave_air", AIR | CLEAR}, {"minecraft:cave_vines", CLEAR | NON_SOLID},
+		{"minecraft:cave_vines_plant", CLEAR | NON_SOLID}, {"minecraft:chain", CLEAR | NON_SOLID}, {"minecraft:chest", CLEAR},
+		{"minecraft:chipped_anvil", CLEAR}, {"minecraft:chorus_flower", CLEAR}, {"minecraft:chorus_plant", CLEAR},
+		{"minecraft:closed_eyeblossom", CLEAR | NON_SOLID}, {"minecraft:cobweb", DIMMING}, {"minecraft:cocoa", CLEAR | NON_SOLID},
+		{"minecraft:comparator", CLEAR | NON_SOLID}, {"minecraft:composter", CLEAR}, {"minecraft:conduit", CLEAR},
+		{"minecraft:cornflower", CLEAR | NON_SOLID}, {"minecraft:crimson_fungus", CLEAR | NON_SOLID}, {"minecraft:crimson_roots", CLEAR | NON_SOLID},
+		{"minecraft:damaged_anvil", CLEAR}, {"minecraft:dandelion", CLEAR | NON_SOLID}, {"minecraft:daylight_detector", CLEAR},
+		{"minecraft:dead_bush", CLEAR | NON_SOLID}, {"minecraft:decorated_pot", CLEAR}, {"minecraft:detector_rail", CLEAR | NON_SOLID},
+		{"minecraft:dragon_egg", CLEAR}, {"minecraft:enchanting_table", CLEAR}, {"minecraft:end_gateway", CLEAR},
+		{"minecraft:end_portal", CLEAR | NON_SOLID}, {"minecraft:end_portal_frame", CLEAR}, {"minecraft:end_rod", CLEAR | NON_SOLID},
+		{"minecraft:ender_chest", CLEAR}, {"minecraft:fern", CLEAR | NON_SOLID}, {"minecraft:fire", CLEAR | NON_SOLID},
+		{"minecraft:firefly_bush", CLEAR | NON_SOLID}, {"minecraft:flower_pot", CLEAR | NON_SOLID}, {"minecraft:flowering_azalea", CLEAR},
+		{"minecraft:frogspawn", CLEAR | NON_SOLID}, {"minecraft:frosted_ice", DIMMING}, {"minecraft:glass", CLEAR},
+		{"minecraft:glow_lichen", CLEAR | NON_SOLID}, {"minecraft:grindstone", CLEAR}, {"minecraft:hanging_roots", CLEAR | NON_SOLID},
+		{"minecraft:heavy_core", CLEAR}, {"minecraft:honey_block", DIMMING}, {"minecraft:hopper", CLEAR}, {"minecraft:ice", DIMMING},
+		{"minecraft:iron_bars", CLEAR}, {"minecraft:kelp", DIMMING | FLUID}, {"minecraft:kelp_plant", DIMMING | FLUID}, {"minecraft:ladder", CLEAR},
+		{"minecraft:lantern", CLEAR}, {"minecraft:large_amethyst_bud", CLEAR}, {"minecraft:large_fern", CLEAR | NON_SOLID},
+		{"minecraft:lava", DIMMING | FLUID}, {"minecraft:lava_cauldron", CLEAR}, {"minecraft:leaf_litter", CLEAR | NON_SOLID},
+		{"minecraft:lectern", CLEAR}, {"minecraft:lever", CLEAR | NON_SOLID}, {"minecraft:light", CLEAR | NON_SOLID},
+		{"minecraft:lilac", CLEAR | NON_SOLID}, {"minecraft:lily_of_the_valley", CLEAR | NON_SOLID}, {"minecraft:lily_pad", CLEAR | NON_SOLID},
+		{"minecraft:mangrove_propagule", CLEAR | NON_SOLID}, {"minecraft:mangrove_roots", DIMMING},
+		{"minecraft:medium_amethyst_bud", CLEAR | NON_SOLID}, {"minecraft:melon_stem", CLEAR | NON_SOLID}, {"minecraft:moving_piston", CLEAR},
+		{"minecraft:nether_portal", CLEAR | NON_SOLID}, {"minecraft:nether_sprouts", CLEAR | NON_SOLID}, {"minecraft:nether_wart", CLEAR | NON_SOLID},
+		{"minecraft:open_eyeblossom", CLEAR | NON_SOLID}, {"minecraft:oxeye_daisy", CLEAR | NON_SOLID},
+		{"minecraft:pale_hanging_moss", CLEAR | NON_SOLID}, {"minecraft:peony", CLEAR | NON_SOLID}, {"minecraft:pink_petals", CLEAR | NON_SOLID},
+		{"minecraft:piston_head", CLEAR}, {"minecraft:pitcher_crop", CLEAR | NON_SOLID}, {"minecraft:pitcher_plant", CLEAR | NON_SOLID},
+		{"minecraft:pointed_dripstone", CLEAR | NON_SOLID}, {"minecraft:poppy", CLEAR | NON_SOLID}, {"minecraft:potatoes", CLEAR | NON_SOLID},
+		{"minecraft:powder_snow_cauldron", CLEAR}, {"minecraft:powered_rail", CLEAR | NON_SOLID}, {"minecraft:pumpkin_stem", CLEAR | NON_SOLID},
+		{"minecraft:rail", CLEAR | NON_SOLID}, {"minecraft:red_mushroom", CLEAR | NON_SOLID}, {"minecraft:redstone_torch", CLEAR | NON_SOLID},
+		{"minecraft:redstone_wall_torch", CLEAR | NON_SOLID}, {"minecraft:redstone_wire", CLEAR | NON_SOLID},
+		{"minecraft:repeater", CLEAR | NON_SOLID}, {"minecraft:resin_clump", CLEAR | NON_SOLID}, {"minecraft:rose_bush", CLEAR | NON_SOLID},
+		{"minecraft:scaffolding", CLEAR}, {"minecraft:sculk_sensor", CLEAR}, {"minecraft:sculk_shrieker", CLEAR},
+		{"minecraft:sculk_vein", CLEAR | NON_SOLID}, {"minecraft:sea_pickle", CLEAR | NON_SOLID}, {"minecraft:seagrass", DIMMING | FLUID},
+		{"minecraft:short_dry_grass", CLEAR | NON_SOLID}, {"minecraft:short_grass", CLEAR | NON_SOLID}, {"minecraft:slime_block", DIMMING},
+		{"minecraft:small_amethyst_bud", CLEAR | NON_SOLID}, {"minecraft:small_dripleaf", CLEAR | NON_SOLID}, {"minecraft:sniffer_egg", CLEAR},
+		{"minecraft:snow", CLEAR}, {"minecraft:soul_campfire", CLEAR}, {"minecraft:soul_fire", CLEAR | NON_SOLID}, {"minecraft:soul_lantern", CLEAR},
+		{"minecraft:soul_torch", CLEAR | NON_SOLID}, {"minecraft:soul_wall_torch", CLEAR | NON_SOLID}, {"minecraft:spawner", DIMMING},
+		{"minecraft:spore_blossom", CLEAR | NON_SOLID}, {"minecraft:stonecutter", CLEAR}, {"minecraft:structure_void", CLEAR | NON_SOLID},
+		{"minecraft:sugar_cane", CLEAR | NON_SOLID}, {"minecraft:sunflower", CLEAR | NON_SOLID}, {"minecraft:sweet_berry_bush", CLEAR | NON_SOLID},
+		{"minecraft:tall_dry_grass", CLEAR | NON_SOLID}, {"minecraft:tall_grass", CLEAR | NON_SOLID}, {"minecraft:tall_seagrass", DIMMING | FLUID},
+		{"minecraft:torch", CLEAR | NON_SOLID}, {"minecraft:torchflower", CLEAR | NON_SOLID}, {"minecraft:torchflower_crop", CLEAR | NON_SOLID},
+		{"minecraft:trapped_chest", CLEAR}, {"minecraft:trial_spawner", DIMMING}, {"minecraft:tripwire", CLEAR | NON_SOLID},
+		{"minecraft:tripwire_hook", CLEAR | NON_SOLID}, {"minecraft:turtle_egg", CLEAR | NON_SOLID}, {"minecraft:twisting_vines", CLEAR | NON_SOLID},
+		{"minecraft:twisting_vines_plant", CLEAR | NON_SOLID}, {"minecraft:vault", DIMMING}, {"minecraft:vine", CLEAR | NON_SOLID},
+		{"minecraft:void_air", AIR | CLEAR}, {"minecraft:wall_torch", CLEAR | NON_SOLID}, {"minecraft:warped_fungus", CLEAR | NON_SOLID},
+		{"minecraft:warped_roots", CLEAR | NON_SOLID}, {"minecraft:water", DIMMING | FLUID}, {"minecraft:water_cauldron", CLEAR},
+		{"minecraft:weeping_vines", CLEAR | NON_SOLID}, {"minecraft:weeping_vines_plant", CLEAR | NON_SOLID}, {"minecraft:wheat", CLEAR | NON_SOLID},
+		{"minecraft:wildflowers", CLEAR | NON_SOLID}, {"minecraft:wither_rose", CLEAR | NON_SOLID},
+	};
+
+	// Families of blocks, one entry for every wood, stone or color variant
+	inline constexpr Entry SUFFIXES[] = {
+		{"_sapling", CLEAR | NON_SOLID}, {"_tulip", CLEAR | NON_SOLID}, {"_stained_glass", CLEAR}, {"_pane", CLEAR}, {"_slab", CLEAR},
+		{"_stairs", CLEAR}, {"_fence", CLEAR}, {"_fence_gate", CLEAR}, {"_wall", CLEAR}, {"_door", CLEAR}, {"_trapdoor", CLEAR}, {"_sign", CLEAR},
+		{"_banner", CLEAR}, {"_pressure_plate", CLEAR}, {"_button", CLEAR | NON_SOLID}, {"_carpet", CLEAR | NON_SOLID},
+		{"_candle", CLEAR | NON_SOLID}, {"_candle_cake", CLEAR}, {"_bed", CLEAR}, {"_head", CLEAR | NON_SOLID}, {"_skull", CLEAR | NON_SOLID},
+		{"_coral", CLEAR | NON_SOLID}, {"_coral_fan", CLEAR | NON_SOLID}, {"_wall_fan", CLEAR | NON_SOLID}, {"lightning_rod", CLEAR | NON_SOLID},
+		{"_leaves", LEAVES},
+	};
+
+	// Flags per block, in BlockStates order. Suffixes are matched per block and the listed blocks found by hash
+	// afterwards: matching all 1100 names against the list would not fit the compile-time evaluation budget.
+	inline constexpr auto FLAGS = []() {
+		const BlockStateTable&						   blocks = BlockStates::get();
+		std::array<uint8_t, BlockStates::get().size()> flags{};
+		for (size_t i = 0; i < flags.size(); i++) {
+			std::string_view name = blocks.begin()[i].name;
+			if (name.starts_with("minecraft:potted_")) flags[i] |= CLEAR | NON_SOLID;
+			for (const Entry& suffix : SUFFIXES) {
+				if (name.ends_with(suffix.name)) flags[i] |= suffix.flags;
+			}
+		}
+		for (const Entry& entry : BLOCKS) flags[static_cast<size_t>(blocks.findBlock(entry.name) - blocks.begin())] |= entry.flags;
+		return flags;
+	}();
+
+	constexpr uint8_t of(const BlockStateBlock& block) { return FLAGS[static_cast<size_t>(&block - BlockStates::get().begin())]; }
+} // namespace BlockProperties
+
+#endif // BLOCK_PROPERTIES_HPP
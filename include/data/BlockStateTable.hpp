@@ -0,0 +1,129 @@
+#ifndef BLOCK_STATE_TABLE_HPP
+#define BLOCK_STATE_TABLE_HPP
+
+#include "RegistryTable.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+
+struct BlockStateProperty {
+	std::string_view name;
+	uint16_t		 firstValue; // index in the value array, values in report order
+	uint8_t			 valueCount;
+};
+
+// Position of one property in the state ids of a block: value index (state - firstState) / stride % valueCount
+struct BlockStatePropertySlot {
+	const BlockStateProperty* property; // null when the block has no such property
+	uint32_t				  stride;
+};
+
+struct BlockStateBlock {
+	std::string_view name;
+	uint32_t		 firstState;
+	uint32_t		 defaultState;
+	uint16_t		 firstProperty; // index in the block property array
+	uint8_t			 propertyCount;
+};
+
+// Immutable (block name, properties) -> global block state id table, data generated by tools/gen_block_states.py.
+// Blocks are found with the RegistryTable perfect hash; the states of a block are consecutive, the cartesian product
+// of its properties with the last one varying fastest, so a state id is computed from the value indices.
+// Everything is constexpr and lookups never allocate.
+class BlockStateTable {
+  private:
+	std::span<const BlockStateBlock>	_blocks; // sorted by name
+	std::span<const uint32_t>			_seeds;	 // displacement seed per bucket
+	std::span<const uint16_t>			_slots;	 // hash slot -> index in _blocks
+	std::span<const uint16_t>			_blockProperties;
+	std::span<const BlockStateProperty> _properties;
+	std::span<const std::string_view>	_values;
+
+  public:
+	constexpr BlockStateTable(std::span<const BlockStateBlock>	  blocks,
+							  std::span<const uint32_t>			  seeds,
+							  std::span<const uint16_t>			  slots,
+							  std::span<const uint16_t>			  blockProperties,
+							  std::span<const BlockStateProperty> properties,
+							  std::span<const std::string_view>	  values)
+		: _blocks(blocks), _seeds(seeds), _slots(slots), _blockProperties(blockProperties), _properties(properties), _values(values) {}
+
+	constexpr const BlockStateBlock* findBlock(std::string_view name) const {
+		if (_blocks.empty()) return nullptr;
+		uint32_t			   bucket = RegistryTable::hash(0, name) % _seeds.size();
+		uint32_t			   slot	  = RegistryTable::hash(_seeds[bucket], name) % _slots.size();
+		const BlockStateBlock& block  = _blocks[_slots[slot]];
+		return block.name == name ? &block : nullptr;
+	}
+
+	constexpr const BlockStateProperty& getProperty(const BlockStateBlock& block, size_t index) const {
+		return _properties[_blockProperties[block.firstProperty + index]];
+	}
+
+	constexpr std::string_view getValue(const BlockStateProperty& property, size_t index) const { return _values[property.firstValue + index]; }
+
+	// Where the property `name` sits in the state ids of `block`, looked up once to read it from many states
+	constexpr BlockStatePropertySlot findProperty(const BlockStateBlock& block, std::string_view name) const {
+		uint32_t stride = 1;
+		for (size_t i = block.propertyCount; i-- > 0;) {
+			const BlockStateProperty& property = getProperty(block, i);
+			if (property.name == name) return {&property, stride};
+			stride *= property.valueCount;
+		}
+		return {nullptr, 0};
+	}
+
+	// Value of the property at `slot` in `state` of `block`, empty when the block has no such property
+	constexpr std::string_view getValue(const BlockStateBlock& block, const BlockStatePropertySlot& slot, uint32_t state) const {
+		if (!slot.property) return {};
+		return getValue(*slot.property, (state - block.firstState) / slot.stride % slot.property->valueCount);
+	}
+
+	// State of `block` where each property takes valueOf(property name), a std::string_view. Properties it leaves
+	// empty or sets to an unknown value keep the one of the default state.
+	template <typename ValueOf> constexpr uint32_t getState(const BlockStateBlock& block, ValueOf&& valueOf) const {
+		uint32_t offset		   = 0;
+		uint32_t stride		   = 1;
+		uint32_t defaultOffset = block.defaultState - block.firstState;
+		for (size_t i = block.propertyCount; i-- > 0;) {
+			const BlockStateProperty& property = getProperty(block, i);
+			std::string_view		  wanted   = valueOf(property.name);
+
+			uint32_t index = (defaultOffset / stride) % property.valueCount;
+			for (uint32_t v = 0; !wanted.empty() && v < property.valueCount; v++) {
+				if (getValue(property, v) == wanted) {
+					index = v;
+					break;
+				}
+			}
+			offset += index * stride;
+			stride *= property.valueCount;
+		}
+		return block.firstState + offset;
+	}
+
+	// (name, properties) -> state id, properties given as (name, value) pairs in any order
+	constexpr std::optional<uint32_t> find(std::string_view name, std::span<const std::pair<std::string_view, std::string_view>> properties = {}) const {
+		const BlockStateBlock* block = findBlock(name);
+		if (!block) return std::nullopt;
+		return getState(*block, [&](std::string_view property) {
+			for (const auto& [key, value] : properties) {
+				if (key == property) return value;
+			}
+			return std::string_view();
+		});
+	}
+
+	constexpr size_t size() const { return _blocks.size(); }
+	constexpr bool	 empty() const { return _blocks.empty(); }
+
+	// Iteration in name order
+	constexpr const BlockStateBlock* begin() const { return _blocks.data(); }
+	constexpr const BlockStateBlock* end() const { return _blocks.data() + _blocks.size(); }
+};
+
+#endif
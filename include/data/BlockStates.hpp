@@ -0,0 +1,710 @@
+// Generated by tools/gen_block_states.py from the data generator's blocks.json - do not edit
+#ifndef BLOCK_STATES_HPP
+#define BLOCK_STATES_HPP
+
+#include "BlockStateTable.hpp"
+
+#include <cstdint>
+#include <string_view>
+
+namespace BlockStatesData {
+	// name, first state, default state, first entry in BLOCK_PROPERTIES, property count
+	inline constexpr BlockStateBlock BLOCKS[] = {
+			{"minecraft:acacia_button", 9500, 9509, 0, 3}, {"minecraft:acacia_door", 12981, 12992, 3, 5},
+			{"minecraft:acacia_fence", 12597, 12628, 8, 5}, {"minecraft:acacia_fence_gate", 12309, 12316, 13, 4},
+			{"minecraft:acacia_hanging_sign", 5130, 5163, 17, 3}, {"minecraft:acacia_leaves", 364, 391, 20, 3},
+			{"minecraft:acacia_log", 148, 149, 23, 1}, {"minecraft:acacia_planks", 19, 19, 24, 0},
+			{"minecraft:acacia_pressure_plate", 5900, 5901, 24, 1}, {"minecraft:acacia_sapling", 37, 37, 25, 1},
+			{"minecraft:acacia_sign", 4462, 4463, 26, 2}, {"minecraft:acacia_slab", 12083, 12086, 28, 2},
+			{"minecraft:acacia_stairs", 10701, 10712, 30, 4}, {"minecraft:acacia_trapdoor", 6396, 6411, 34, 5},
+			{"minecraft:acacia_wall_hanging_sign", 5730, 5731, 39, 2}, {"minecraft:acacia_wall_sign", 4882, 4883, 41, 2},
+			{"minecraft:acacia_wood", 213, 214, 43, 1}, {"minecraft:activator_rail", 10137, 10150, 44, 3}, {"minecraft:air", 0, 0, 47, 0},
+			{"minecraft:allium", 2125, 2125, 47, 0}, {"minecraft:amethyst_block", 22067, 22067, 47, 0},
+			{"minecraft:amethyst_cluster", 22069, 22078, 47, 2}, {"minecraft:ancient_debris", 20484, 20484, 49, 0},
+			{"minecraft:andesite", 6, 6, 49, 0}, {"minecraft:andesite_slab", 15167, 15170, 49, 2},
+			{"minecraft:andesite_stairs", 14793, 14804, 51, 4}, {"minecraft:andesite_wall", 17783, 17786, 55, 6},
+			{"minecraft:anvil", 9924, 9924, 61, 1}, {"minecraft:attached_melon_stem", 7060, 7060, 62, 1},
+			{"minecraft:attached_pumpkin_stem", 7056, 7056, 63, 1}, {"minecraft:azalea", 25860, 25860, 64, 0},
+			{"minecraft:azalea_leaves", 504, 531, 64, 3}, {"minecraft:azure_bluet", 2126, 2126, 67, 0}, {"minecraft:bamboo", 13976, 13976, 67, 3},
+			{"minecraft:bamboo_block", 168, 169, 70, 1}, {"minecraft:bamboo_button", 9620, 9629, 71, 3},
+			{"minecraft:bamboo_door", 13301, 13312, 74, 5}, {"minecraft:bamboo_fence", 12757, 12788, 79, 5},
+			{"minecraft:bamboo_fence_gate", 12469, 12476, 84, 4}, {"minecraft:bamboo_hanging_sign", 5642, 5675, 88, 3},
+			{"minecraft:bamboo_mosaic", 28, 28, 91, 0}, {"minecraft:bamboo_mosaic_slab", 12119, 12122, 91, 2},
+			{"minecraft:bamboo_mosaic_stairs", 11181, 11192, 93, 4}, {"minecraft:bamboo_planks", 27, 27, 97, 0},
+			{"minecraft:bamboo_pressure_plate", 5910, 5911, 97, 1}, {"minecraft:bamboo_sapling", 13975, 13975, 98, 0},
+			{"minecraft:bamboo_sign", 4654, 4655, 98, 2}, {"minecraft:bamboo_slab", 12113, 12116, 100, 2},
+			{"minecraft:bamboo_stairs", 11101, 11112, 102, 4}, {"minecraft:bamboo_trapdoor", 6716, 6731, 106, 5},
+			{"minecraft:bamboo_wall_hanging_sign", 5794, 5795, 111, 2}, {"minecraft:bamboo_wall_sign", 4930, 4931, 113, 2},
+			{"minecraft:barrel", 19439, 19440, 115, 2}, {"minecraft:barrier", 11262, 11263, 117, 1}, {"minecraft:basalt", 6031, 6032, 118, 1},
+			{"minecraft:beacon", 8702, 8702, 119, 0}, {"minecraft:bedrock", 85, 85, 119, 0}, {"minecraft:bee_nest", 20433, 20433, 119, 2},
+			{"minecraft:beehive", 20457, 20457, 121, 2}, {"minecraft:beetroots", 13540, 13540, 123, 1}, {"minecraft:bell", 19502, 19503, 124, 3},
+			{"minecraft:big_dripleaf", 25912, 25913, 127, 3}, {"minecraft:big_dripleaf_stem", 25944, 25945, 130, 2},
+			{"minecraft:birch_button", 9452, 9461, 132, 3}, {"minecraft:birch_door", 12853, 12864, 135, 5},
+			{"minecraft:birch_fence", 12533, 12564, 140, 5}, {"minecraft:birch_fence_gate", 12245, 12252, 145, 4},
+			{"minecraft:birch_hanging_sign", 5066, 5099, 149, 3}, {"minecraft:birch_leaves", 308, 335, 152, 3},
+			{"minecraft:birch_log", 142, 143, 155, 1}, {"minecraft:birch_planks", 17, 17, 156, 0},
+			{"minecraft:birch_pressure_plate", 5896, 5897, 156, 1}, {"minecraft:birch_sapling", 33, 33, 157, 1},
+			{"minecraft:birch_sign", 4430, 4431, 158, 2}, {"minecraft:birch_slab", 12071, 12074, 160, 2},
+			{"minecraft:birch_stairs", 8530, 8541, 162, 4}, {"minecraft:birch_trapdoor", 6268, 6283, 166, 5},
+			{"minecraft:birch_wall_hanging_sign", 5722, 5723, 171, 2}, {"minecraft:birch_wall_sign", 4874, 4875, 173, 2},
+			{"minecraft:birch_wood", 207, 208, 175, 1}, {"minecraft:black_banner", 11896, 11896, 176, 1},
+			{"minecraft:black_bed", 1971, 1974, 177, 3}, {"minecraft:black_candle", 22017, 22020, 180, 3},
+			{"minecraft:black_candle_cake", 22065, 22066, 183, 1}, {"minecraft:black_carpet", 11640, 11640, 184, 0},
+			{"minecraft:black_concrete", 13774, 13774, 184, 0}, {"minecraft:black_concrete_powder", 13790, 13790, 184, 0},
+			{"minecraft:black_glazed_terracotta", 13755, 13755, 184, 1}, {"minecraft:black_shulker_box", 13689, 13693, 185, 1},
+			{"minecraft:black_stained_glass", 6139, 6139, 186, 0}, {"minecraft:black_stained_glass_pane", 10669, 10700, 186, 5},
+			{"minecraft:black_terracotta", 10188, 10188, 191, 0}, {"minecraft:black_wall_banner", 11972, 11972, 191, 1},
+			{"minecraft:black_wool", 2108, 2108, 192, 0}, {"minecraft:blackstone", 20496, 20496, 192, 0},
+			{"minecraft:blackstone_slab", 20901, 20904, 192, 2}, {"minecraft:blackstone_stairs", 20497, 20508, 194, 4},
+			{"minecraft:blackstone_wall", 20577, 20580, 198, 6}, {"minecraft:blast_furnace", 19459, 19460, 204, 2},
+			{"minecraft:blue_banner", 11832, 11832, 206, 1}, {"minecraft:blue_bed", 1907, 1910, 207, 3},
+			{"minecraft:blue_candle", 21953, 21956, 210, 3}, {"minecraft:blue_candle_cake", 22057, 22058, 213, 1},
+			{"minecraft:blue_carpet", 11636, 11636, 214, 0}, {"minecraft:blue_concrete", 13770, 13770, 214, 0},
+			{"minecraft:blue_concrete_powder", 13786, 13786, 214, 0}, {"minecraft:blue_glazed_terracotta", 13739, 13739, 214, 1},
+			{"minecraft:blue_ice", 13972, 13972, 215, 0}, {"minecraft:blue_orchid", 2124, 2124, 215, 0},
+			{"minecraft:blue_shulker_box", 13665, 13669, 215, 1}, {"minecraft:blue_stained_glass", 6135, 6135, 216, 0},
+			{"minecraft:blue_stained_glass_pane", 10541, 10572, 216, 5}, {"minecraft:blue_terracotta", 10184, 10184, 221, 0},
+			{"minecraft:blue_wall_banner", 11956, 11956, 221, 1}, {"minecraft:blue_wool", 2104, 2104, 222, 0},
+			{"minecraft:bone_block", 13577, 13578, 222, 1}, {"minecraft:bookshelf", 2142, 2142, 223, 0},
+			{"minecraft:brain_coral", 13856, 13856, 223, 1}, {"minecraft:brain_coral_block", 13840, 13840, 224, 0},
+			{"minecraft:brain_coral_fan", 13876, 13876, 224, 1}, {"minecraft:brain_coral_wall_fan", 13932, 13932, 225, 2},
+			{"minecraft:brewing_stand", 8174, 8181, 227, 3}, {"minecraft:brick_slab", 12161, 12164, 230, 2},
+			{"minecraft:brick_stairs", 7400, 7411, 232, 4}, {"minecraft:brick_wall", 15191, 15194, 236, 6},
+			{"minecraft:bricks", 2139, 2139, 242, 0}, {"minecraft:brown_banner", 11848, 11848, 242, 1}, {"minecraft:brown_bed", 1923, 1926, 243, 3},
+			{"minecraft:brown_candle", 21969, 21972, 246, 3}, {"minecraft:brown_candle_cake", 22059, 22060, 249, 1},
+			{"minecraft:brown_carpet", 11637, 11637, 250, 0}, {"minecraft:brown_concrete", 13771, 13771, 250, 0},
+			{"minecraft:brown_concrete_powder", 13787, 13787, 250, 0}, {"minecraft:brown_glazed_terracotta", 13743, 13743, 250, 1},
+			{"minecraft:brown_mushroom", 2135, 2135, 251, 0}, {"minecraft:brown_mushroom_block", 6792, 6792, 251, 6},
+			{"minecraft:brown_shulker_box", 13671, 13675, 257, 1}, {"minecraft:brown_stained_glass", 6136, 6136, 258, 0},
+			{"minecraft:brown_stained_glass_pane", 10573, 10604, 258, 5}, {"minecraft:brown_terracotta", 10185, 10185, 263, 0},
+			{"minecraft:brown_wall_banner", 11960, 11960, 263, 1}, {"minecraft:brown_wool", 2105, 2105, 264, 0},
+			{"minecraft:bubble_column", 13991, 13991, 264, 1}, {"minecraft:bubble_coral", 13858, 13858, 265, 1},
+			{"minecraft:bubble_coral_block", 13841, 13841, 266, 0}, {"minecraft:bubble_coral_fan", 13878, 13878, 266, 1},
+			{"minecraft:bubble_coral_wall_fan", 13940, 13940, 267, 2}, {"minecraft:budding_amethyst", 22068, 22068, 269, 0},
+			{"minecraft:bush", 2051, 2051, 269, 0}, {"minecraft:cactus", 5960, 5960, 269, 1}, {"minecraft:cactus_flower", 5976, 5976, 270, 0},
+			{"minecraft:cake", 6053, 6053, 270, 1}, {"minecraft:calcite", 23352, 23352, 271, 0},
+			{"minecraft:calibrated_sculk_sensor", 23451, 23452, 271, 4}, {"minecraft:campfire", 19542, 19545, 275, 4},
+			{"minecraft:candle", 21761, 21764, 279, 3}, {"minecraft:candle_cake", 22033, 22034, 282, 1}, {"minecraft:carrots", 9388, 9388, 283, 1},
+			{"minecraft:cartography_table", 19467, 19467, 284, 0}, {"minecraft:carved_pumpkin", 6045, 6045, 284, 1},
+			{"minecraft:cauldron", 8182, 8182, 285, 0}, {"minecraft:cave_air", 13990, 13990, 285, 0},
+			{"minecraft:cave_vines", 25805, 25806, 285, 2}, {"minecraft:cave_vines_plant", 25857, 25858, 287, 1},
+			{"minecraft:chain", 7016, 7019, 288, 2}, {"minecraft:chain_command_block", 13558, 13564, 290, 2},
+			{"minecraft:cherry_button", 9524, 9533, 292, 3}, {"minecraft:cherry_door", 13045, 13056, 295, 5},
+			{"minecraft:cherry_fence", 12629, 12660, 300, 5}, {"minecraft:cherry_fence_gate", 12341, 12348, 305, 4},
+			{"minecraft:cherry_hanging_sign", 5194, 5227, 309, 3}, {"minecraft:cherry_leaves", 392, 419, 312, 3},
+			{"minecraft:cherry_log", 151, 152, 315, 1}, {"minecraft:cherry_planks", 20, 20, 316, 0},
+			{"minecraft:cherry_pressure_plate", 5902, 5903, 316, 1}, {"minecraft:cherry_sapling", 39, 39, 317, 1},
+			{"minecraft:cherry_sign", 4494, 4495, 318, 2}, {"minecraft:cherry_slab", 12089, 12092, 320, 2},
+			{"minecraft:cherry_stairs", 10781, 10792, 322, 4}, {"minecraft:cherry_trapdoor", 6460, 6475, 326, 5},
+			{"minecraft:cherry_wall_hanging_sign", 5738, 5739, 331, 2}, {"minecraft:cherry_wall_sign", 4890, 4891, 333, 2},
+			{"minecraft:cherry_wood", 216, 217, 335, 1}, {"minecraft:chest", 3018, 3019, 336, 3}, {"minecraft:chipped_anvil", 9928, 9928, 339, 1},
+			{"minecraft:chiseled_bookshelf", 2143, 2206, 340, 7}, {"minecraft:chiseled_copper", 23987, 23987, 347, 0},
+			{"minecraft:chiseled_deepslate", 27619, 27619, 347, 0}, {"minecraft:chiseled_nether_bricks", 21758, 21758, 347, 0},
+			{"minecraft:chiseled_polished_blackstone", 20910, 20910, 347, 0}, {"minecraft:chiseled_quartz_block", 10053, 10053, 347, 0},
+			{"minecraft:chiseled_red_sandstone", 11977, 11977, 347, 0}, {"minecraft:chiseled_resin_bricks", 8055, 8055, 347, 0},
+			{"minecraft:chiseled_sandstone", 579, 579, 347, 0}, {"minecraft:chiseled_stone_bricks", 6783, 6783, 347, 0},
+			{"minecraft:chiseled_tuff", 22939, 22939, 347, 0}, {"minecraft:chiseled_tuff_bricks", 23351, 23351, 347, 0},
+			{"minecraft:chorus_flower", 13435, 13435, 347, 1}, {"minecraft:chorus_plant", 13371, 13434, 348, 6},
+			{"minecraft:clay", 5977, 5977, 354, 0}, {"minecraft:closed_eyeblossom", 27918, 27918, 354, 0},
+			{"minecraft:coal_block", 11642, 11642, 354, 0}, {"minecraft:coal_ore", 133, 133, 354, 0}, {"minecraft:coarse_dirt", 11, 11, 354, 0},
+			{"minecraft:cobbled_deepslate", 25975, 25975, 354, 0}, {"minecraft:cobbled_deepslate_slab", 26056, 26059, 354, 2},
+			{"minecraft:cobbled_deepslate_stairs", 25976, 25987, 356, 4}, {"minecraft:cobbled_deepslate_wall", 26062, 26065, 360, 6},
+			{"minecraft:cobblestone", 14, 14, 366, 0}, {"minecraft:cobblestone_slab", 12155, 12158, 366, 2},
+			{"minecraft:cobblestone_stairs", 4778, 4789, 368, 4}, {"minecraft:cobblestone_wall", 8703, 8706, 372, 6},
+			{"minecraft:cobweb", 2047, 2047, 378, 0}, {"minecraft:cocoa", 8203, 8203, 378, 2}, {"minecraft:command_block", 8690, 8696, 380, 2},
+			{"minecraft:comparator", 9992, 9993, 382, 3}, {"minecraft:composter", 20408, 20408, 385, 1},
+			{"minecraft:conduit", 13973, 13973, 386, 1}, {"minecraft:copper_block", 23974, 23974, 387, 0},
+			{"minecraft:copper_bulb", 25728, 25731, 387, 2}, {"minecraft:copper_door", 24688, 24699, 389, 5},
+			{"minecraft:copper_grate", 25712, 25713, 394, 1}, {"minecraft:copper_ore", 23978, 23978, 395, 0},
+			{"minecraft:copper_trapdoor", 25200, 25215, 395, 5}, {"minecraft:cornflower", 2132, 2132, 400, 0},
+			{"minecraft:cracked_deepslate_bricks", 27620, 27620, 400, 0}, {"minecraft:cracked_deepslate_tiles", 27621, 27621, 400, 0},
+			{"minecraft:cracked_nether_bricks", 21759, 21759, 400, 0}, {"minecraft:cracked_polished_blackstone_bricks", 20909, 20909, 400, 0},
+			{"minecraft:cracked_stone_bricks", 6782, 6782, 400, 0}, {"minecraft:crafter", 27658, 27703, 400, 3},
+			{"minecraft:crafting_table", 4341, 4341, 403, 0}, {"minecraft:creaking_heart", 2920, 2927, 403, 3},
+			{"minecraft:creeper_head", 9804, 9820, 406, 2}, {"minecraft:creeper_wall_head", 9836, 9837, 408, 2},
+			{"minecraft:crimson_button", 20131, 20140, 410, 3}, {"minecraft:crimson_door", 20179, 20190, 413, 5},
+			{"minecraft:crimson_fence", 19715, 19746, 418, 5}, {"minecraft:crimson_fence_gate", 19907, 19914, 423, 4},
+			{"minecraft:crimson_fungus", 19640, 19640, 427, 0}, {"minecraft:crimson_hanging_sign", 5450, 5483, 427, 3},
+			{"minecraft:crimson_hyphae", 19633, 19634, 430, 1}, {"minecraft:crimson_nylium", 19639, 19639, 431, 0},
+			{"minecraft:crimson_planks", 19697, 19697, 431, 0}, {"minecraft:crimson_pressure_plate", 19711, 19712, 431, 1},
+			{"minecraft:crimson_roots", 19696, 19696, 432, 0}, {"minecraft:crimson_sign", 20307, 20308, 432, 2},
+			{"minecraft:crimson_slab", 19699, 19702, 434, 2}, {"minecraft:crimson_stairs", 19971, 19982, 436, 4},
+			{"minecraft:crimson_stem", 19627, 19628, 440, 1}, {"minecraft:crimson_trapdoor", 19779, 19794, 441, 5},
+			{"minecraft:crimson_wall_hanging_sign", 5778, 5779, 446, 2}, {"minecraft:crimson_wall_sign", 20371, 20372, 448, 2},
+			{"minecraft:crying_obsidian", 20485, 20485, 450, 0}, {"minecraft:cut_copper", 23983, 23983, 450, 0},
+			{"minecraft:cut_copper_slab", 24330, 24333, 450, 2}, {"minecraft:cut_copper_stairs", 24232, 24243, 452, 4},
+			{"minecraft:cut_red_sandstone", 11978, 11978, 456, 0}, {"minecraft:cut_red_sandstone_slab", 12197, 12200, 456, 2},
+			{"minecraft:cut_sandstone", 580, 580, 458, 0}, {"minecraft:cut_sandstone_slab", 12143, 12146, 458, 2},
+			{"minecraft:cyan_banner", 11800, 11800, 460, 1}, {"minecraft:cyan_bed", 1875, 1878, 461, 3},
+			{"minecraft:cyan_candle", 21921, 21924, 464, 3}, {"minecraft:cyan_candle_cake", 22053, 22054, 467, 1},
+			{"minecraft:cyan_carpet", 11634, 11634, 468, 0}, {"minecraft:cyan_concrete", 13768, 13768, 468, 0},
+			{"minecraft:cyan_concrete_powder", 13784, 13784, 468, 0}, {"minecraft:cyan_glazed_terracotta", 13731, 13731, 468, 1},
+			{"minecraft:cyan_shulker_box", 13653, 13657, 469, 1}, {"minecraft:cyan_stained_glass", 6133, 6133, 470, 0},
+			{"minecraft:cyan_stained_glass_pane", 10477, 10508, 470, 5}, {"minecraft:cyan_terracotta", 10182, 10182, 475, 0},
+			{"minecraft:cyan_wall_banner", 11948, 11948, 475, 1}, {"minecraft:cyan_wool", 2102, 2102, 476, 0},
+			{"minecraft:damaged_anvil", 9932, 9932, 476, 1}, {"minecraft:dandelion", 2121, 2121, 477, 0},
+			{"minecraft:dark_oak_button", 9548, 9557, 477, 3}, {"minecraft:dark_oak_door", 13109, 13120, 480, 5},
+			{"minecraft:dark_oak_fence", 12661, 12692, 485, 5}, {"minecraft:dark_oak_fence_gate", 12373, 12380, 490, 4},
+			{"minecraft:dark_oak_hanging_sign", 5322, 5355, 494, 3}, {"minecraft:dark_oak_leaves", 420, 447, 497, 3},
+			{"minecraft:dark_oak_log", 154, 155, 500, 1}, {"minecraft:dark_oak_planks", 21, 21, 501, 0},
+			{"minecraft:dark_oak_pressure_plate", 5904, 5905, 501, 1}, {"minecraft:dark_oak_sapling", 41, 41, 502, 1},
+			{"minecraft:dark_oak_sign", 4558, 4559, 503, 2}, {"minecraft:dark_oak_slab", 12095, 12098, 505, 2},
+			{"minecraft:dark_oak_stairs", 10861, 10872, 507, 4}, {"minecraft:dark_oak_trapdoor", 6524, 6539, 511, 5},
+			{"minecraft:dark_oak_wall_hanging_sign", 5754, 5755, 516, 2}, {"minecraft:dark_oak_wall_sign", 4906, 4907, 518, 2},
+			{"minecraft:dark_oak_wood", 219, 220, 520, 1}, {"minecraft:dark_prismarine", 11362, 11362, 521, 0},
+			{"minecraft:dark_prismarine_slab", 11615, 11618, 521, 2}, {"minecraft:dark_prismarine_stairs", 11523, 11534, 523, 4},
+			{"minecraft:daylight_detector", 10008, 10024, 527, 2}, {"minecraft:dead_brain_coral", 13846, 13846, 529, 1},
+			{"minecraft:dead_brain_coral_block", 13835, 13835, 530, 0}, {"minecraft:dead_brain_coral_fan", 13866, 13866, 530, 1},
+			{"minecraft:dead_brain_coral_wall_fan", 13892, 13892, 531, 2}, {"minecraft:dead_bubble_coral", 13848, 13848, 533, 1},
+			{"minecraft:dead_bubble_coral_block", 13836, 13836, 534, 0}, {"minecraft:dead_bubble_coral_fan", 13868, 13868, 534, 1},
+			{"minecraft:dead_bubble_coral_wall_fan", 13900, 13900, 535, 2}, {"minecraft:dead_bush", 2050, 2050, 537, 0},
+			{"minecraft:dead_fire_coral", 13850, 13850, 537, 1}, {"minecraft:dead_fire_coral_block", 13837, 13837, 538, 0},
+			{"minecraft:dead_fire_coral_fan", 13870, 13870, 538, 1}, {"minecraft:dead_fire_coral_wall_fan", 13908, 13908, 539, 2},
+			{"minecraft:dead_horn_coral", 13852, 13852, 541, 1}, {"minecraft:dead_horn_coral_block", 13838, 13838, 542, 0},
+			{"minecraft:dead_horn_coral_fan", 13872, 13872, 542, 1}, {"minecraft:dead_horn_coral_wall_fan", 13916, 13916, 543, 2},
+			{"minecraft:dead_tube_coral", 13844, 13844, 545, 1}, {"minecraft:dead_tube_coral_block", 13834, 13834, 546, 0},
+			{"minecraft:dead_tube_coral_fan", 13864, 13864, 546, 1}, {"minecraft:dead_tube_coral_wall_fan", 13884, 13884, 547, 2},
+			{"minecraft:decorated_pot", 27642, 27651, 549, 3}, {"minecraft:deepslate", 25972, 25973, 552, 1},
+			{"minecraft:deepslate_brick_slab", 27289, 27292, 553, 2}, {"minecraft:deepslate_brick_stairs", 27209, 27220, 555, 4},
+			{"minecraft:deepslate_brick_wall", 27295, 27298, 559, 6}, {"minecraft:deepslate_bricks", 27208, 27208, 565, 0},
+			{"minecraft:deepslate_coal_ore", 134, 134, 565, 0}, {"minecraft:deepslate_copper_ore", 23979, 23979, 565, 0},
+			{"minecraft:deepslate_diamond_ore", 4339, 4339, 565, 0}, {"minecraft:deepslate_emerald_ore", 8296, 8296, 565, 0},
+			{"minecraft:deepslate_gold_ore", 130, 130, 565, 0}, {"minecraft:deepslate_iron_ore", 132, 132, 565, 0},
+			{"minecraft:deepslate_lapis_ore", 564, 564, 565, 0}, {"minecraft:deepslate_redstone_ore", 5914, 5915, 565, 1},
+			{"minecraft:deepslate_tile_slab", 26878, 26881, 566, 2}, {"minecraft:deepslate_tile_stairs", 26798, 26809, 568, 4},
+			{"minecraft:deepslate_tile_wall", 26884, 26887, 572, 6}, {"minecraft:deepslate_tiles", 26797, 26797, 578, 0},
+			{"minecraft:detector_rail", 2011, 2024, 578, 3}, {"minecraft:diamond_block", 4340, 4340, 581, 0},
+			{"minecraft:diamond_ore", 4338, 4338, 581, 0}, {"minecraft:diorite", 4, 4, 581, 0}, {"minecraft:diorite_slab", 15185, 15188, 581, 2},
+			{"minecraft:diorite_stairs", 15033, 15044, 583, 4}, {"minecraft:diorite_wall", 19079, 19082, 587, 6},
+			{"minecraft:dirt", 10, 10, 593, 0}, {"minecraft:dirt_path", 13544, 13544, 593, 0}, {"minecraft:dispenser", 566, 567, 593, 2},
+			{"minecraft:dragon_egg", 8200, 8200, 595, 0}, {"minecraft:dragon_head", 9844, 9860, 595, 2},
+			{"minecraft:dragon_wall_head", 9876, 9877, 597, 2}, {"minecraft:dried_kelp_block", 13818, 13818, 599, 0},
+			{"minecraft:dripstone_block", 25804, 25804, 599, 0}, {"minecraft:dropper", 10161, 10162, 599, 2},
+			{"minecraft:emerald_block", 8449, 8449, 601, 0}, {"minecraft:emerald_ore", 8295, 8295, 601, 0},
+			{"minecraft:enchanting_table", 8173, 8173, 601, 0}, {"minecraft:end_gateway", 13545, 13545, 601, 0},
+			{"minecraft:end_portal", 8190, 8190, 601, 0}, {"minecraft:end_portal_frame", 8191, 8195, 601, 2},
+			{"minecraft:end_rod", 13365, 13369, 603, 1}, {"minecraft:end_stone", 8199, 8199, 604, 0},
+			{"minecraft:end_stone_brick_slab", 15143, 15146, 604, 2}, {"minecraft:end_stone_brick_stairs", 14393, 14404, 606, 4},
+			{"minecraft:end_stone_brick_wall", 18755, 18758, 610, 6}, {"minecraft:end_stone_bricks", 13525, 13525, 616, 0},
+			{"minecraft:ender_chest", 8297, 8298, 616, 2}, {"minecraft:exposed_chiseled_copper", 23986, 23986, 618, 0},
+			{"minecraft:exposed_copper", 23975, 23975, 618, 0}, {"minecraft:exposed_copper_bulb", 25732, 25735, 618, 2},
+			{"minecraft:exposed_copper_door", 24752, 24763, 620, 5}, {"minecraft:exposed_copper_grate", 25714, 25715, 625, 1},
+			{"minecraft:exposed_copper_trapdoor", 25264, 25279, 626, 5}, {"minecraft:exposed_cut_copper", 23982, 23982, 631, 0},
+			{"minecraft:exposed_cut_copper_slab", 24324, 24327, 631, 2}, {"minecraft:exposed_cut_copper_stairs", 24152, 24163, 633, 4},
+			{"minecraft:farmland", 4350, 4350, 637, 1}, {"minecraft:fern", 2049, 2049, 638, 0}, {"minecraft:fire", 2406, 2437, 638, 6},
+			{"minecraft:fire_coral", 13860, 13860, 644, 1}, {"minecraft:fire_coral_block", 13842, 13842, 645, 0},
+			{"minecraft:fire_coral_fan", 13880, 13880, 645, 1}, {"minecraft:fire_coral_wall_fan", 13948, 13948, 646, 2},
+			{"minecraft:firefly_bush", 27921, 27921, 648, 0}, {"minecraft:fletching_table", 19468, 19468, 648, 0},
+			{"minecraft:flower_pot", 9351, 9351, 648, 0}, {"minecraft:flowering_azalea", 25861, 25861, 648, 0},
+			{"minecraft:flowering_azalea_leaves", 532, 559, 648, 3}, {"minecraft:frogspawn", 27640, 27640, 651, 0},
+			{"minecraft:frosted_ice", 13570, 13570, 651, 1}, {"minecraft:furnace", 4358, 4359, 652, 2},
+			{"minecraft:gilded_blackstone", 21321, 21321, 654, 0}, {"minecraft:glass", 562, 562, 654, 0},
+			{"minecraft:glass_pane", 7022, 7053, 654, 5}, {"minecraft:glow_lichen", 7112, 7239, 659, 7},
+			{"minecraft:glowstone", 6042, 6042, 666, 0}, {"minecraft:gold_block", 2137, 2137, 666, 0}, {"minecraft:gold_ore", 129, 129, 666, 0},
+			{"minecraft:granite", 2, 2, 666, 0}, {"minecraft:granite_slab", 15161, 15164, 666, 2},
+			{"minecraft:granite_stairs", 14713, 14724, 668, 4}, {"minecraft:granite_wall", 16487, 16490, 672, 6},
+			{"minecraft:grass_block", 8, 9, 678, 1}, {"minecraft:gravel", 124, 124, 679, 0}, {"minecraft:gray_banner", 11768, 11768, 679, 1},
+			{"minecraft:gray_bed", 1843, 1846, 680, 3}, {"minecraft:gray_candle", 21889, 21892, 683, 3},
+			{"minecraft:gray_candle_cake", 22049, 22050, 686, 1}, {"minecraft:gray_carpet", 11632, 11632, 687, 0},
+			{"minecraft:gray_concrete", 13766, 13766, 687, 0}, {"minecraft:gray_concrete_powder", 13782, 13782, 687, 0},
+			{"minecraft:gray_glazed_terracotta", 13723, 13723, 687, 1}, {"minecraft:gray_shulker_box", 13641, 13645, 688, 1},
+			{"minecraft:gray_stained_glass", 6131, 6131, 689, 0}, {"minecraft:gray_stained_glass_pane", 10413, 10444, 689, 5},
+			{"minecraft:gray_terracotta", 10180, 10180, 694, 0}, {"minecraft:gray_wall_banner", 11940, 11940, 694, 1},
+			{"minecraft:gray_wool", 2100, 2100, 695, 0}, {"minecraft:green_banner", 11864, 11864, 695, 1},
+			{"minecraft:green_bed", 1939, 1942, 696, 3}, {"minecraft:green_candle", 21985, 21988, 699, 3},
+			{"minecraft:green_candle_cake", 22061, 22062, 702, 1}, {"minecraft:green_carpet", 11638, 11638, 703, 0},
+			{"minecraft:green_concrete", 13772, 13772, 703, 0}, {"minecraft:green_concrete_powder", 13788, 13788, 703, 0},
+			{"minecraft:green_glazed_terracotta", 13747, 13747, 703, 1}, {"minecraft:green_shulker_box", 13677, 13681, 704, 1},
+			{"minecraft:green_stained_glass", 6137, 6137, 705, 0}, {"minecraft:green_stained_glass_pane", 10605, 10636, 705, 5},
+			{"minecraft:green_terracotta", 10186, 10186, 710, 0}, {"minecraft:green_wall_banner", 11964, 11964, 710, 1},
+			{"minecraft:green_wool", 2106, 2106, 711, 0}, {"minecraft:grindstone", 19469, 19473, 711, 2},
+			{"minecraft:hanging_roots", 25968, 25969, 713, 1}, {"minecraft:hay_block", 11622, 11623, 714, 1},
+			{"minecraft:heavy_core", 27750, 27751, 715, 1}, {"minecraft:heavy_weighted_pressure_plate", 9976, 9976, 716, 1},
+			{"minecraft:honey_block", 20481, 20481, 717, 0}, {"minecraft:honeycomb_block", 20482, 20482, 717, 0},
+			{"minecraft:hopper", 10042, 10042, 717, 2}, {"minecraft:horn_coral", 13862, 13862, 719, 1},
+			{"minecraft:horn_coral_block", 13843, 13843, 720, 0}, {"minecraft:horn_coral_fan", 13882, 13882, 720, 1},
+			{"minecraft:horn_coral_wall_fan", 13956, 13956, 721, 2}, {"minecraft:ice", 5958, 5958, 723, 0},
+			{"minecraft:infested_chiseled_stone_bricks", 6791, 6791, 723, 0}, {"minecraft:infested_cobblestone", 6787, 6787, 723, 0},
+			{"minecraft:infested_cracked_stone_bricks", 6790, 6790, 723, 0}, {"minecraft:infested_deepslate", 27622, 27623, 723, 1},
+			{"minecraft:infested_mossy_stone_bricks", 6789, 6789, 724, 0}, {"minecraft:infested_stone", 6786, 6786, 724, 0},
+			{"minecraft:infested_stone_bricks", 6788, 6788, 724, 0}, {"minecraft:iron_bars", 6984, 7015, 724, 5},
+			{"minecraft:iron_block", 2138, 2138, 729, 0}, {"minecraft:iron_door", 5828, 5839, 729, 5}, {"minecraft:iron_ore", 131, 131, 734, 0},
+			{"minecraft:iron_trapdoor", 11296, 11311, 734, 5}, {"minecraft:jack_o_lantern", 6049, 6049, 739, 1},
+			{"minecraft:jigsaw", 20391, 20401, 740, 1}, {"minecraft:jukebox", 5994, 5995, 741, 1}, {"minecraft:jungle_button", 9476, 9485, 742, 3},
+			{"minecraft:jungle_door", 12917, 12928, 745, 5}, {"minecraft:jungle_fence", 12565, 12596, 750, 5},
+			{"minecraft:jungle_fence_gate", 12277, 12284, 755, 4}, {"minecraft:jungle_hanging_sign", 5258, 5291, 759, 3},
+			{"minecraft:jungle_leaves", 336, 363, 762, 3}, {"minecraft:jungle_log", 145, 146, 765, 1}, {"minecraft:jungle_planks", 18, 18, 766, 0},
+			{"minecraft:jungle_pressure_plate", 5898, 5899, 766, 1}, {"minecraft:jungle_sapling", 35, 35, 767, 1},
+			{"minecraft:jungle_sign", 4526, 4527, 768, 2}, {"minecraft:jungle_slab", 12077, 12080, 770, 2},
+			{"minecraft:jungle_stairs", 8610, 8621, 772, 4}, {"minecraft:jungle_trapdoor", 6332, 6347, 776, 5},
+			{"minecraft:jungle_wall_hanging_sign", 5746, 5747, 781, 2}, {"minecraft:jungle_wall_sign", 4898, 4899, 783, 2},
+			{"minecraft:jungle_wood", 210, 211, 785, 1}, {"minecraft:kelp", 13791, 13791, 786, 1}, {"minecraft:kelp_plant", 13817, 13817, 787, 0},
+			{"minecraft:ladder", 4750, 4751, 787, 2}, {"minecraft:lantern", 19534, 19537, 789, 2}, {"minecraft:lapis_block", 565, 565, 791, 0},
+			{"minecraft:lapis_ore", 563, 563, 791, 0}, {"minecraft:large_amethyst_bud", 22081, 22090, 791, 2},
+			{"minecraft:large_fern", 11654, 11655, 793, 1}, {"minecraft:lava", 102, 102, 794, 1}, {"minecraft:lava_cauldron", 8186, 8186, 795, 0},
+			{"minecraft:leaf_litter", 25895, 25895, 795, 2}, {"minecraft:lectern", 19481, 19484, 797, 3}, {"minecraft:lever", 5802, 5811, 800, 3},
+			{"minecraft:light", 11264, 11295, 803, 2}, {"minecraft:light_blue_banner", 11704, 11704, 805, 1},
+			{"minecraft:light_blue_bed", 1779, 1782, 806, 3}, {"minecraft:light_blue_candle", 21825, 21828, 809, 3},
+			{"minecraft:light_blue_candle_cake", 22041, 22042, 812, 1}, {"minecraft:light_blue_carpet", 11628, 11628, 813, 0},
+			{"minecraft:light_blue_concrete", 13762, 13762, 813, 0}, {"minecraft:light_blue_concrete_powder", 13778, 13778, 813, 0},
+			{"minecraft:light_blue_glazed_terracotta", 13707, 13707, 813, 1}, {"minecraft:light_blue_shulker_box", 13617, 13621, 814, 1},
+			{"minecraft:light_blue_stained_glass", 6127, 6127, 815, 0}, {"minecraft:light_blue_stained_glass_pane", 10285, 10316, 815, 5},
+			{"minecraft:light_blue_terracotta", 10176, 10176, 820, 0}, {"minecraft:light_blue_wall_banner", 11924, 11924, 820, 1},
+			{"minecraft:light_blue_wool", 2096, 2096, 821, 0}, {"minecraft:light_gray_banner", 11784, 11784, 821, 1},
+			{"minecraft:light_gray_bed", 1859, 1862, 822, 3}, {"minecraft:light_gray_candle", 21905, 21908, 825, 3},
+			{"minecraft:light_gray_candle_cake", 22051, 22052, 828, 1}, {"minecraft:light_gray_carpet", 11633, 11633, 829, 0},
+			{"minecraft:light_gray_concrete", 13767, 13767, 829, 0}, {"minecraft:light_gray_concrete_powder", 13783, 13783, 829, 0},
+			{"minecraft:light_gray_glazed_terracotta", 13727, 13727, 829, 1}, {"minecraft:light_gray_shulker_box", 13647, 13651, 830, 1},
+			{"minecraft:light_gray_stained_glass", 6132, 6132, 831, 0}, {"minecraft:light_gray_stained_glass_pane", 10445, 10476, 831, 5},
+			{"minecraft:light_gray_terracotta", 10181, 10181, 836, 0}, {"minecraft:light_gray_wall_banner", 11944, 11944, 836, 1},
+			{"minecraft:light_gray_wool", 2101, 2101, 837, 0}, {"minecraft:light_weighted_pressure_plate", 9960, 9960, 837, 1},
+			{"minecraft:lightning_rod", 25760, 25779, 838, 3}, {"minecraft:lilac", 11646, 11647, 841, 1},
+			{"minecraft:lily_of_the_valley", 2134, 2134, 842, 0}, {"minecraft:lily_pad", 7642, 7642, 842, 0},
+			{"minecraft:lime_banner", 11736, 11736, 842, 1}, {"minecraft:lime_bed", 1811, 1814, 843, 3},
+			{"minecraft:lime_candle", 21857, 21860, 846, 3}, {"minecraft:lime_candle_cake", 22045, 22046, 849, 1},
+			{"minecraft:lime_carpet", 11630, 11630, 850, 0}, {"minecraft:lime_concrete", 13764, 13764, 850, 0},
+			{"minecraft:lime_concrete_powder", 13780, 13780, 850, 0}, {"minecraft:lime_glazed_terracotta", 13715, 13715, 850, 1},
+			{"minecraft:lime_shulker_box", 13629, 13633, 851, 1}, {"minecraft:lime_stained_glass", 6129, 6129, 852, 0},
+			{"minecraft:lime_stained_glass_pane", 10349, 10380, 852, 5}, {"minecraft:lime_terracotta", 10178, 10178, 857, 0},
+			{"minecraft:lime_wall_banner", 11932, 11932, 857, 1}, {"minecraft:lime_wool", 2098, 2098, 858, 0},
+			{"minecraft:lodestone", 20495, 20495, 858, 0}, {"minecraft:loom", 19435, 19435, 858, 1},
+			{"minecraft:magenta_banner", 11688, 11688, 859, 1}, {"minecraft:magenta_bed", 1763, 1766, 860, 3},
+			{"minecraft:magenta_candle", 21809, 21812, 863, 3}, {"minecraft:magenta_candle_cake", 22039, 22040, 866, 1},
+			{"minecraft:magenta_carpet", 11627, 11627, 867, 0}, {"minecraft:magenta_concrete", 13761, 13761, 867, 0},
+			{"minecraft:magenta_concrete_powder", 13777, 13777, 867, 0}, {"minecraft:magenta_glazed_terracotta", 13703, 13703, 867, 1},
+			{"minecraft:magenta_shulker_box", 13611, 13615, 868, 1}, {"minecraft:magenta_stained_glass", 6126, 6126, 869, 0},
+			{"minecraft:magenta_stained_glass_pane", 10253, 10284, 869, 5}, {"minecraft:magenta_terracotta", 10175, 10175, 874, 0},
+			{"minecraft:magenta_wall_banner", 11920, 11920, 874, 1}, {"minecraft:magenta_wool", 2095, 2095, 875, 0},
+			{"minecraft:magma_block", 13574, 13574, 875, 0}, {"minecraft:mangrove_button", 9596, 9605, 875, 3},
+			{"minecraft:mangrove_door", 13237, 13248, 878, 5}, {"minecraft:mangrove_fence", 12725, 12756, 883, 5},
+			{"minecraft:mangrove_fence_gate", 12437, 12444, 888, 4}, {"minecraft:mangrove_hanging_sign", 5578, 5611, 892, 3},
+			{"minecraft:mangrove_leaves", 476, 503, 895, 3}, {"minecraft:mangrove_log", 160, 161, 898, 1},
+			{"minecraft:mangrove_planks", 26, 26, 899, 0}, {"minecraft:mangrove_pressure_plate", 5908, 5909, 899, 1},
+			{"minecraft:mangrove_propagule", 45, 50, 900, 4}, {"minecraft:mangrove_roots", 163, 164, 904, 1},
+			{"minecraft:mangrove_sign", 4622, 4623, 905, 2}, {"minecraft:mangrove_slab", 12107, 12110, 907, 2},
+			{"minecraft:mangrove_stairs", 11021, 11032, 909, 4}, {"minecraft:mangrove_trapdoor", 6652, 6667, 913, 5},
+			{"minecraft:mangrove_wall_hanging_sign", 5770, 5771, 918, 2}, {"minecraft:mangrove_wall_sign", 4922, 4923, 920, 2},
+			{"minecraft:mangrove_wood", 222, 223, 922, 1}, {"minecraft:medium_amethyst_bud", 22093, 22102, 923, 2},
+			{"minecraft:melon", 7055, 7055, 925, 0}, {"minecraft:melon_stem", 7072, 7072, 925, 1}, {"minecraft:moss_block", 25911, 25911, 926, 0},
+			{"minecraft:moss_carpet", 25862, 25862, 926, 0}, {"minecraft:mossy_cobblestone", 2399, 2399, 926, 0},
+			{"minecraft:mossy_cobblestone_slab", 15137, 15140, 926, 2}, {"minecraft:mossy_cobblestone_stairs", 14313, 14324, 928, 4},
+			{"minecraft:mossy_cobblestone_wall", 9027, 9030, 932, 6}, {"minecraft:mossy_stone_brick_slab", 15125, 15128, 938, 2},
+			{"minecraft:mossy_stone_brick_stairs", 14153, 14164, 940, 4}, {"minecraft:mossy_stone_brick_wall", 16163, 16166, 944, 6},
+			{"minecraft:mossy_stone_bricks", 6781, 6781, 950, 0}, {"minecraft:moving_piston", 2109, 2109, 950, 2},
+			{"minecraft:mud", 25971, 25971, 952, 0}, {"minecraft:mud_brick_slab", 12173, 12176, 952, 2},
+			{"minecraft:mud_brick_stairs", 7560, 7571, 954, 4}, {"minecraft:mud_brick_wall", 17135, 17138, 958, 6},
+			{"minecraft:mud_bricks", 6785, 6785, 964, 0}, {"minecraft:muddy_mangrove_roots", 165, 166, 964, 1},
+			{"minecraft:mushroom_stem", 6920, 6920, 965, 6}, {"minecraft:mycelium", 7640, 7641, 971, 1},
+			{"minecraft:nether_brick_fence", 8057, 8088, 972, 5}, {"minecraft:nether_brick_slab", 12179, 12182, 977, 2},
+			{"minecraft:nether_brick_stairs", 8089, 8100, 979, 4}, {"minecraft:nether_brick_wall", 17459, 17462, 983, 6},
+			{"minecraft:nether_bricks", 8056, 8056, 989, 0}, {"minecraft:nether_gold_ore", 135, 135, 989, 0},
+			{"minecraft:nether_portal", 6043, 6043, 989, 1}, {"minecraft:nether_quartz_ore", 10041, 10041, 990, 0},
+			{"minecraft:nether_sprouts", 19626, 19626, 990, 0}, {"minecraft:nether_wart", 8169, 8169, 990, 1},
+			{"minecraft:nether_wart_block", 13575, 13575, 991, 0}, {"minecraft:netherite_block", 20483, 20483, 991, 0},
+			{"minecraft:netherrack", 6028, 6028, 991, 0}, {"minecraft:note_block", 581, 582, 991, 3}, {"minecraft:oak_button", 9404, 9413, 994, 3},
+			{"minecraft:oak_door", 4686, 4697, 997, 5}, {"minecraft:oak_fence", 5996, 6027, 1002, 5},
+			{"minecraft:oak_fence_gate", 7368, 7375, 1007, 4}, {"minecraft:oak_hanging_sign", 4938, 4971, 1011, 3},
+			{"minecraft:oak_leaves", 252, 279, 1014, 3}, {"minecraft:oak_log", 136, 137, 1017, 1}, {"minecraft:oak_planks", 15, 15, 1018, 0},
+			{"minecraft:oak_pressure_plate", 5892, 5893, 1018, 1}, {"minecraft:oak_sapling", 29, 29, 1019, 1},
+			{"minecraft:oak_sign", 4366, 4367, 1020, 2}, {"minecraft:oak_slab", 12059, 12062, 1022, 2},
+			{"minecraft:oak_stairs", 2938, 2949, 1024, 4}, {"minecraft:oak_trapdoor", 6140, 6155, 1028, 5},
+			{"minecraft:oak_wall_hanging_sign", 5706, 5707, 1033, 2}, {"minecraft:oak_wall_sign", 4858, 4859, 1035, 2},
+			{"minecraft:oak_wood", 201, 202, 1037, 1}, {"minecraft:observer", 13581, 13586, 1038, 2}, {"minecraft:obsidian", 2400, 2400, 1040, 0},
+			{"minecraft:ochre_froglight", 27631, 27632, 1040, 1}, {"minecraft:open_eyeblossom", 27917, 27917, 1041, 0},
+			{"minecraft:orange_banner", 11672, 11672, 1041, 1}, {"minecraft:orange_bed", 1747, 1750, 1042, 3},
+			{"minecraft:orange_candle", 21793, 21796, 1045, 3}, {"minecraft:orange_candle_cake", 22037, 22038, 1048, 1},
+			{"minecraft:orange_carpet", 11626, 11626, 1049, 0}, {"minecraft:orange_concrete", 13760, 13760, 1049, 0},
+			{"minecraft:orange_concrete_powder", 13776, 13776, 1049, 0}, {"minecraft:orange_glazed_terracotta", 13699, 13699, 1049, 1},
+			{"minecraft:orange_shulker_box", 13605, 13609, 1050, 1}, {"minecraft:orange_stained_glass", 6125, 6125, 1051, 0},
+			{"minecraft:orange_stained_glass_pane", 10221, 10252, 1051, 5}, {"minecraft:orange_terracotta", 10174, 10174, 1056, 0},
+			{"minecraft:orange_tulip", 2128, 2128, 1056, 0}, {"minecraft:orange_wall_banner", 11916, 11916, 1056, 1},
+			{"minecraft:orange_wool", 2094, 2094, 1057, 0}, {"minecraft:oxeye_daisy", 2131, 2131, 1057, 0},
+			{"minecraft:oxidized_chiseled_copper", 23984, 23984, 1057, 0}, {"minecraft:oxidized_copper", 23977, 23977, 1057, 0},
+			{"minecraft:oxidized_copper_bulb", 25740, 25743, 1057, 2}, {"minecraft:oxidized_copper_door", 24816, 24827, 1059, 5},
+			{"minecraft:oxidized_copper_grate", 25718, 25719, 1064, 1}, {"minecraft:oxidized_copper_trapdoor", 25328, 25343, 1065, 5},
+			{"minecraft:oxidized_cut_copper", 23980, 23980, 1070, 0}, {"minecraft:oxidized_cut_copper_slab", 24312, 24315, 1070, 2},
+			{"minecraft:oxidized_cut_copper_stairs", 23992, 24003, 1072, 4}, {"minecraft:packed_ice", 11643, 11643, 1076, 0},
+			{"minecraft:packed_mud", 6784, 6784, 1076, 0}, {"minecraft:pale_hanging_moss", 27915, 27915, 1076, 1},
+			{"minecraft:pale_moss_block", 27752, 27752, 1077, 0}, {"minecraft:pale_moss_carpet", 27753, 27753, 1077, 5},
+			{"minecraft:pale_oak_button", 9572, 9581, 1082, 3}, {"minecraft:pale_oak_door", 13173, 13184, 1085, 5},
+			{"minecraft:pale_oak_fence", 12693, 12724, 1090, 5}, {"minecraft:pale_oak_fence_gate", 12405, 12412, 1095, 4},
+			{"minecraft:pale_oak_hanging_sign", 5386, 5419, 1099, 3}, {"minecraft:pale_oak_leaves", 448, 475, 1102, 3},
+			{"minecraft:pale_oak_log", 157, 158, 1105, 1}, {"minecraft:pale_oak_planks", 25, 25, 1106, 0},
+			{"minecraft:pale_oak_pressure_plate", 5906, 5907, 1106, 1}, {"minecraft:pale_oak_sapling", 43, 43, 1107, 1},
+			{"minecraft:pale_oak_sign", 4590, 4591, 1108, 2}, {"minecraft:pale_oak_slab", 12101, 12104, 1110, 2},
+			{"minecraft:pale_oak_stairs", 10941, 10952, 1112, 4}, {"minecraft:pale_oak_trapdoor", 6588, 6603, 1116, 5},
+			{"minecraft:pale_oak_wall_hanging_sign", 5762, 5763, 1121, 2}, {"minecraft:pale_oak_wall_sign", 4914, 4915, 1123, 2},
+			{"minecraft:pale_oak_wood", 22, 23, 1125, 1}, {"minecraft:pearlescent_froglight", 27637, 27638, 1126, 1},
+			{"minecraft:peony", 11650, 11651, 1127, 1}, {"minecraft:petrified_oak_slab", 12149, 12152, 1128, 2},
+			{"minecraft:piglin_head", 9884, 9900, 1130, 2}, {"minecraft:piglin_wall_head", 9916, 9917, 1132, 2},
+			{"minecraft:pink_banner", 11752, 11752, 1134, 1}, {"minecraft:pink_bed", 1827, 1830, 1135, 3},
+			{"minecraft:pink_candle", 21873, 21876, 1138, 3}, {"minecraft:pink_candle_cake", 22047, 22048, 1141, 1},
+			{"minecraft:pink_carpet", 11631, 11631, 1142, 0}, {"minecraft:pink_concrete", 13765, 13765, 1142, 0},
+			{"minecraft:pink_concrete_powder", 13781, 13781, 1142, 0}, {"minecraft:pink_glazed_terracotta", 13719, 13719, 1142, 1},
+			{"minecraft:pink_petals", 25863, 25863, 1143, 2}, {"minecraft:pink_shulker_box", 13635, 13639, 1145, 1},
+			{"minecraft:pink_stained_glass", 6130, 6130, 1146, 0}, {"minecraft:pink_stained_glass_pane", 10381, 10412, 1146, 5},
+			{"minecraft:pink_terracotta", 10179, 10179, 1151, 0}, {"minecraft:pink_tulip", 2130, 2130, 1151, 0},
+			{"minecraft:pink_wall_banner", 11936, 11936, 1151, 1}, {"minecraft:pink_wool", 2099, 2099, 1152, 0},
+			{"minecraft:piston", 2057, 2063, 1152, 2}, {"minecraft:piston_head", 2069, 2071, 1154, 3},
+			{"minecraft:pitcher_crop", 13528, 13529, 1157, 2}, {"minecraft:pitcher_plant", 13538, 13539, 1159, 1},
+			{"minecraft:player_head", 9764, 9780, 1160, 2}, {"minecraft:player_wall_head", 9796, 9797, 1162, 2},
+			{"minecraft:podzol", 12, 13, 1164, 1}, {"minecraft:pointed_dripstone", 25784, 25789, 1165, 3},
+			{"minecraft:polished_andesite", 7, 7, 1168, 0}, {"minecraft:polished_andesite_slab", 15179, 15182, 1168, 2},
+			{"minecraft:polished_andesite_stairs", 14953, 14964, 1170, 4}, {"minecraft:polished_basalt", 6034, 6035, 1174, 1},
+			{"minecraft:polished_blackstone", 20907, 20907, 1175, 0}, {"minecraft:polished_blackstone_brick_slab", 20911, 20914, 1175, 2},
+			{"minecraft:polished_blackstone_brick_stairs", 20917, 20928, 1177, 4},
+			{"minecraft:polished_blackstone_brick_wall", 20997, 21000, 1181, 6}, {"minecraft:polished_blackstone_bricks", 20908, 20908, 1187, 0},
+			{"minecraft:polished_blackstone_button", 21410, 21419, 1187, 3},
+			{"minecraft:polished_blackstone_pressure_plate", 21408, 21409, 1190, 1}, {"minecraft:polished_blackstone_slab", 21402, 21405, 1191, 2},
+			{"minecraft:polished_blackstone_stairs", 21322, 21333, 1193, 4}, {"minecraft:polished_blackstone_wall", 21434, 21437, 1197, 6},
+			{"minecraft:polished_deepslate", 26386, 26386, 1203, 0}, {"minecraft:polished_deepslate_slab", 26467, 26470, 1203, 2},
+			{"minecraft:polished_deepslate_stairs", 26387, 26398, 1205, 4}, {"minecraft:polished_deepslate_wall", 26473, 26476, 1209, 6},
+			{"minecraft:polished_diorite", 5, 5, 1215, 0}, {"minecraft:polished_diorite_slab", 15131, 15134, 1215, 2},
+			{"minecraft:polished_diorite_stairs", 14233, 14244, 1217, 4}, {"minecraft:polished_granite", 3, 3, 1221, 0},
+			{"minecraft:polished_granite_slab", 15113, 15116, 1221, 2}, {"minecraft:polished_granite_stairs", 13993, 14004, 1223, 4},
+			{"minecraft:polished_tuff", 22528, 22528, 1227, 0}, {"minecraft:polished_tuff_slab", 22529, 22532, 1227, 2},
+			{"minecraft:polished_tuff_stairs", 22535, 22546, 1229, 4}, {"minecraft:polished_tuff_wall", 22615, 22618, 1233, 6},
+			{"minecraft:poppy", 2123, 2123, 1239, 0}, {"minecraft:potatoes", 9396, 9396, 1239, 1},
+			{"minecraft:potted_acacia_sapling", 9361, 9361, 1240, 1}, {"minecraft:potted_allium", 9374, 9374, 1241, 0},
+			{"minecraft:potted_azalea_bush", 27629, 27629, 1241, 0}, {"minecraft:potted_azure_bluet", 9375, 9375, 1241, 0},
+			{"minecraft:potted_bamboo", 13988, 13988, 1241, 0}, {"minecraft:potted_birch_sapling", 9357, 9357, 1241, 1},
+			{"minecraft:potted_blue_orchid", 9373, 9373, 1242, 0}, {"minecraft:potted_brown_mushroom", 9385, 9385, 1242, 0},
+			{"minecraft:potted_cactus", 9387, 9387, 1242, 0}, {"minecraft:potted_cherry_sapling", 9363, 9363, 1242, 1},
+			{"minecraft:potted_closed_eyeblossom", 27920, 27920, 1243, 0}, {"minecraft:potted_cornflower", 9381, 9381, 1243, 0},
+			{"minecraft:potted_crimson_fungus", 20491, 20491, 1243, 0}, {"minecraft:potted_crimson_roots", 20493, 20493, 1243, 0},
+			{"minecraft:potted_dandelion", 9371, 9371, 1243, 0}, {"minecraft:potted_dark_oak_sapling", 9365, 9365, 1243, 1},
+			{"minecraft:potted_dead_bush", 9386, 9386, 1244, 0}, {"minecraft:potted_fern", 9370, 9370, 1244, 0},
+			{"minecraft:potted_flowering_azalea_bush", 27630, 27630, 1244, 0}, {"minecraft:potted_jungle_sapling", 9359, 9359, 1244, 1},
+			{"minecraft:potted_lily_of_the_valley", 9382, 9382, 1245, 0}, {"minecraft:potted_mangrove_propagule", 9369, 9369, 1245, 0},
+			{"minecraft:potted_oak_sapling", 9353, 9353, 1245, 1}, {"minecraft:potted_open_eyeblossom", 27919, 27919, 1246, 0},
+			{"minecraft:potted_orange_tulip", 9377, 9377, 1246, 0}, {"minecraft:potted_oxeye_daisy", 9380, 9380, 1246, 0},
+			{"minecraft:potted_pale_oak_sapling", 9367, 9367, 1246, 1}, {"minecraft:potted_pink_tulip", 9379, 9379, 1247, 0},
+			{"minecraft:potted_poppy", 9372, 9372, 1247, 0}, {"minecraft:potted_red_mushroom", 9384, 9384, 1247, 0},
+			{"minecraft:potted_red_tulip", 9376, 9376, 1247, 0}, {"minecraft:potted_spruce_sapling", 9355, 9355, 1247, 1},
+			{"minecraft:potted_torchflower", 9352, 9352, 1248, 0}, {"minecraft:potted_warped_fungus", 20492, 20492, 1248, 0},
+			{"minecraft:potted_warped_roots", 20494, 20494, 1248, 0}, {"minecraft:potted_white_tulip", 9378, 9378, 1248, 0},
+			{"minecraft:potted_wither_rose", 9383, 9383, 1248, 0}, {"minecraft:powder_snow", 23354, 23354, 1248, 0},
+			{"minecraft:powder_snow_cauldron", 8187, 8187, 1248, 1}, {"minecraft:powered_rail", 1987, 2000, 1249, 3},
+			{"minecraft:prismarine", 11360, 11360, 1252, 0}, {"minecraft:prismarine_brick_slab", 11609, 11612, 1252, 2},
+			{"minecraft:prismarine_brick_stairs", 11443, 11454, 1254, 4}, {"minecraft:prismarine_bricks", 11361, 11361, 1258, 0},
+			{"minecraft:prismarine_slab", 11603, 11606, 1258, 2}, {"minecraft:prismarine_stairs", 11363, 11374, 1260, 4},
+			{"minecraft:prismarine_wall", 15515, 15518, 1264, 6}, {"minecraft:pumpkin", 7054, 7054, 1270, 0},
+			{"minecraft:pumpkin_stem", 7064, 7064, 1270, 1}, {"minecraft:purple_banner", 11816, 11816, 1271, 1},
+			{"minecraft:purple_bed", 1891, 1894, 1272, 3}, {"minecraft:purple_candle", 21937, 21940, 1275, 3},
+			{"minecraft:purple_candle_cake", 22055, 22056, 1278, 1}, {"minecraft:purple_carpet", 11635, 11635, 1279, 0},
+			{"minecraft:purple_concrete", 13769, 13769, 1279, 0}, {"minecraft:purple_concrete_powder", 13785, 13785, 1279, 0},
+			{"minecraft:purple_glazed_terracotta", 13735, 13735, 1279, 1}, {"minecraft:purple_shulker_box", 13659, 13663, 1280, 1},
+			{"minecraft:purple_stained_glass", 6134, 6134, 1281, 0}, {"minecraft:purple_stained_glass_pane", 10509, 10540, 1281, 5},
+			{"minecraft:purple_terracotta", 10183, 10183, 1286, 0}, {"minecraft:purple_wall_banner", 11952, 11952, 1286, 1},
+			{"minecraft:purple_wool", 2103, 2103, 1287, 0}, {"minecraft:purpur_block", 13441, 13441, 1287, 0},
+			{"minecraft:purpur_pillar", 13442, 13443, 1287, 1}, {"minecraft:purpur_slab", 12203, 12206, 1288, 2},
+			{"minecraft:purpur_stairs", 13445, 13456, 1290, 4}, {"minecraft:quartz_block", 10052, 10052, 1294, 0},
+			{"minecraft:quartz_bricks", 21760, 21760, 1294, 0}, {"minecraft:quartz_pillar", 10054, 10055, 1294, 1},
+			{"minecraft:quartz_slab", 12185, 12188, 1295, 2}, {"minecraft:quartz_stairs", 10057, 10068, 1297, 4},
+			{"minecraft:rail", 4758, 4759, 1301, 2}, {"minecraft:raw_copper_block", 27627, 27627, 1303, 0},
+			{"minecraft:raw_gold_block", 27628, 27628, 1303, 0}, {"minecraft:raw_iron_block", 27626, 27626, 1303, 0},
+			{"minecraft:red_banner", 11880, 11880, 1303, 1}, {"minecraft:red_bed", 1955, 1958, 1304, 3},
+			{"minecraft:red_candle", 22001, 22004, 1307, 3}, {"minecraft:red_candle_cake", 22063, 22064, 1310, 1},
+			{"minecraft:red_carpet", 11639, 11639, 1311, 0}, {"minecraft:red_concrete", 13773, 13773, 1311, 0},
+			{"minecraft:red_concrete_powder", 13789, 13789, 1311, 0}, {"minecraft:red_glazed_terracotta", 13751, 13751, 1311, 1},
+			{"minecraft:red_mushroom", 2136, 2136, 1312, 0}, {"minecraft:red_mushroom_block", 6856, 6856, 1312, 6},
+			{"minecraft:red_nether_brick_slab", 15173, 15176, 1318, 2}, {"minecraft:red_nether_brick_stairs", 14873, 14884, 1320, 4},
+			{"minecraft:red_nether_brick_wall", 18107, 18110, 1324, 6}, {"minecraft:red_nether_bricks", 13576, 13576, 1330, 0},
+			{"minecraft:red_sand", 123, 123, 1330, 0}, {"minecraft:red_sandstone", 11976, 11976, 1330, 0},
+			{"minecraft:red_sandstone_slab", 12191, 12194, 1330, 2}, {"minecraft:red_sandstone_stairs", 11979, 11990, 1332, 4},
+			{"minecraft:red_sandstone_wall", 15839, 15842, 1336, 6}, {"minecraft:red_shulker_box", 13683, 13687, 1342, 1},
+			{"minecraft:red_stained_glass", 6138, 6138, 1343, 0}, {"minecraft:red_stained_glass_pane", 10637, 10668, 1343, 5},
+			{"minecraft:red_terracotta", 10187, 10187, 1348, 0}, {"minecraft:red_tulip", 2127, 2127, 1348, 0},
+			{"minecraft:red_wall_banner", 11968, 11968, 1348, 1}, {"minecraft:red_wool", 2107, 2107, 1349, 0},
+			{"minecraft:redstone_block", 10040, 10040, 1349, 0}, {"minecraft:redstone_lamp", 8201, 8202, 1349, 1},
+			{"minecraft:redstone_ore", 5912, 5913, 1350, 1}, {"minecraft:redstone_torch", 5916, 5916, 1351, 1},
+			{"minecraft:redstone_wall_torch", 5918, 5918, 1352, 2}, {"minecraft:redstone_wire", 3042, 4202, 1354, 5},
+			{"minecraft:reinforced_deepslate", 27641, 27641, 1359, 0}, {"minecraft:repeater", 6060, 6063, 1359, 4},
+			{"minecraft:repeating_command_block", 13546, 13552, 1363, 2}, {"minecraft:resin_block", 7643, 7643, 1365, 0},
+			{"minecraft:resin_brick_slab", 7725, 7728, 1365, 2}, {"minecraft:resin_brick_stairs", 7645, 7656, 1367, 4},
+			{"minecraft:resin_brick_wall", 7731, 7734, 1371, 6}, {"minecraft:resin_bricks", 7644, 7644, 1377, 0},
+			{"minecraft:resin_clump", 7240, 7367, 1377, 7}, {"minecraft:respawn_anchor", 20486, 20486, 1384, 1},
+			{"minecraft:rooted_dirt", 25970, 25970, 1385, 0}, {"minecraft:rose_bush", 11648, 11649, 1385, 1}, {"minecraft:sand", 118, 118, 1386, 0},
+			{"minecraft:sandstone", 578, 578, 1386, 0}, {"minecraft:sandstone_slab", 12137, 12140, 1386, 2},
+			{"minecraft:sandstone_stairs", 8215, 8226, 1388, 4}, {"minecraft:sandstone_wall", 18431, 18434, 1392, 6},
+			{"minecraft:scaffolding", 19403, 19434, 1398, 3}, {"minecraft:sculk", 23835, 23835, 1401, 0},
+			{"minecraft:sculk_catalyst", 23964, 23965, 1401, 1}, {"minecraft:sculk_sensor", 23355, 23356, 1402, 3},
+			{"minecraft:sculk_shrieker", 23966, 23973, 1405, 3}, {"minecraft:sculk_vein", 23836, 23963, 1408, 7},
+			{"minecraft:sea_lantern", 11621, 11621, 1415, 0}, {"minecraft:sea_pickle", 13964, 13964, 1415, 2},
+			{"minecraft:seagrass", 2054, 2054, 1417, 0}, {"minecraft:short_dry_grass", 2052, 2052, 1417, 0},
+			{"minecraft:short_grass", 2048, 2048, 1417, 0}, {"minecraft:shroomlight", 19641, 19641, 1417, 0},
+			{"minecraft:shulker_box", 13593, 13597, 1417, 1}, {"minecraft:skeleton_skull", 9644, 9660, 1418, 2},
+			{"minecraft:skeleton_wall_skull", 9676, 9677, 1420, 2}, {"minecraft:slime_block", 11261, 11261, 1422, 0},
+			{"minecraft:small_amethyst_bud", 22105, 22114, 1422, 2}, {"minecraft:small_dripleaf", 25952, 25955, 1424, 3},
+			{"minecraft:smithing_table", 19497, 19497, 1427, 0}, {"minecraft:smoker", 19451, 19452, 1427, 2},
+			{"minecraft:smooth_basalt", 27625, 27625, 1429, 0}, {"minecraft:smooth_quartz", 12211, 12211, 1429, 0},
+			{"minecraft:smooth_quartz_slab", 15155, 15158, 1429, 2}, {"minecraft:smooth_quartz_stairs", 14633, 14644, 1431, 4},
+			{"minecraft:smooth_red_sandstone", 12212, 12212, 1435, 0}, {"minecraft:smooth_red_sandstone_slab", 15119, 15122, 1435, 2},
+			{"minecraft:smooth_red_sandstone_stairs", 14073, 14084, 1437, 4}, {"minecraft:smooth_sandstone", 12210, 12210, 1441, 0},
+			{"minecraft:smooth_sandstone_slab", 15149, 15152, 1441, 2}, {"minecraft:smooth_sandstone_stairs", 14553, 14564, 1443, 4},
+			{"minecraft:smooth_stone", 12209, 12209, 1447, 0}, {"minecraft:smooth_stone_slab", 12131, 12134, 1447, 2},
+			{"minecraft:sniffer_egg", 13831, 13831, 1449, 1}, {"minecraft:snow", 5950, 5950, 1450, 1},
+			{"minecraft:snow_block", 5959, 5959, 1451, 0}, {"minecraft:soul_campfire", 19574, 19577, 1451, 4},
+			{"minecraft:soul_fire", 2918, 2918, 1455, 0}, {"minecraft:soul_lantern", 19538, 19541, 1455, 2},
+			{"minecraft:soul_sand", 6029, 6029, 1457, 0}, {"minecraft:soul_soil", 6030, 6030, 1457, 0},
+			{"minecraft:soul_torch", 6037, 6037, 1457, 0}, {"minecraft:soul_wall_torch", 6038, 6038, 1457, 1},
+			{"minecraft:spawner", 2919, 2919, 1458, 0}, {"minecraft:sponge", 560, 560, 1458, 0}, {"minecraft:spore_blossom", 25859, 25859, 1458, 0},
+			{"minecraft:spruce_button", 9428, 9437, 1458, 3}, {"minecraft:spruce_door", 12789, 12800, 1461, 5},
+			{"minecraft:spruce_fence", 12501, 12532, 1466, 5}, {"minecraft:spruce_fence_gate", 12213, 12220, 1471, 4},
+			{"minecraft:spruce_hanging_sign", 5002, 5035, 1475, 3}, {"minecraft:spruce_leaves", 280, 307, 1478, 3},
+			{"minecraft:spruce_log", 139, 140, 1481, 1}, {"minecraft:spruce_planks", 16, 16, 1482, 0},
+			{"minecraft:spruce_pressure_plate", 5894, 5895, 1482, 1}, {"minecraft:spruce_sapling", 31, 31, 1483, 1},
+			{"minecraft:spruce_sign", 4398, 4399, 1484, 2}, {"minecraft:spruce_slab", 12065, 12068, 1486, 2},
+			{"minecraft:spruce_stairs", 8450, 8461, 1488, 4}, {"minecraft:spruce_trapdoor", 6204, 6219, 1492, 5},
+			{"minecraft:spruce_wall_hanging_sign", 5714, 5715, 1497, 2}, {"minecraft:spruce_wall_sign", 4866, 4867, 1499, 2},
+			{"minecraft:spruce_wood", 204, 205, 1501, 1}, {"minecraft:sticky_piston", 2035, 2041, 1502, 2}, {"minecraft:stone", 1, 1, 1504, 0},
+			{"minecraft:stone_brick_slab", 12167, 12170, 1504, 2}, {"minecraft:stone_brick_stairs", 7480, 7491, 1506, 4},
+			{"minecraft:stone_brick_wall", 16811, 16814, 1510, 6}, {"minecraft:stone_bricks", 6780, 6780, 1516, 0},
+			{"minecraft:stone_button", 5926, 5935, 1516, 3}, {"minecraft:stone_pressure_plate", 5826, 5827, 1519, 1},
+			{"minecraft:stone_slab", 12125, 12128, 1520, 2}, {"minecraft:stone_stairs", 14473, 14484, 1522, 4},
+			{"minecraft:stonecutter", 19498, 19498, 1526, 1}, {"minecraft:stripped_acacia_log", 180, 181, 1527, 1},
+			{"minecraft:stripped_acacia_wood", 237, 238, 1528, 1}, {"minecraft:stripped_bamboo_block", 198, 199, 1529, 1},
+			{"minecraft:stripped_birch_log", 174, 175, 1530, 1}, {"minecraft:stripped_birch_wood", 231, 232, 1531, 1},
+			{"minecraft:stripped_cherry_log", 183, 184, 1532, 1}, {"minecraft:stripped_cherry_wood", 240, 241, 1533, 1},
+			{"minecraft:stripped_crimson_hyphae", 19636, 19637, 1534, 1}, {"minecraft:stripped_crimson_stem", 19630, 19631, 1535, 1},
+			{"minecraft:stripped_dark_oak_log", 186, 187, 1536, 1}, {"minecraft:stripped_dark_oak_wood", 243, 244, 1537, 1},
+			{"minecraft:stripped_jungle_log", 177, 178, 1538, 1}, {"minecraft:stripped_jungle_wood", 234, 235, 1539, 1},
+			{"minecraft:stripped_mangrove_log", 195, 196, 1540, 1}, {"minecraft:stripped_mangrove_wood", 249, 250, 1541, 1},
+			{"minecraft:stripped_oak_log", 192, 193, 1542, 1}, {"minecraft:stripped_oak_wood", 225, 226, 1543, 1},
+			{"minecraft:stripped_pale_oak_log", 189, 190, 1544, 1}, {"minecraft:stripped_pale_oak_wood", 246, 247, 1545, 1},
+			{"minecraft:stripped_spruce_log", 171, 172, 1546, 1}, {"minecraft:stripped_spruce_wood", 228, 229, 1547, 1},
+			{"minecraft:stripped_warped_hyphae", 19619, 19620, 1548, 1}, {"minecraft:stripped_warped_stem", 19613, 19614, 1549, 1},
+			{"minecraft:structure_block", 20387, 20388, 1550, 1}, {"minecraft:structure_void", 13580, 13580, 1551, 0},
+			{"minecraft:sugar_cane", 5978, 5978, 1551, 1}, {"minecraft:sunflower", 11644, 11645, 1552, 1},
+			{"minecraft:suspicious_gravel", 125, 125, 1553, 1}, {"minecraft:suspicious_sand", 119, 119, 1554, 1},
+			{"minecraft:sweet_berry_bush", 19606, 19606, 1555, 1}, {"minecraft:tall_dry_grass", 2053, 2053, 1556, 0},
+			{"minecraft:tall_grass", 11652, 11653, 1556, 1}, {"minecraft:tall_seagrass", 2055, 2056, 1557, 1},
+			{"minecraft:target", 20417, 20417, 1558, 1}, {"minecraft:terracotta", 11641, 11641, 1559, 0},
+			{"minecraft:test_block", 20403, 20403, 1559, 1}, {"minecraft:test_instance_block", 20407, 20407, 1560, 0},
+			{"minecraft:tinted_glass", 23353, 23353, 1560, 0}, {"minecraft:tnt", 2140, 2141, 1560, 1}, {"minecraft:torch", 2401, 2401, 1561, 0},
+			{"minecraft:torchflower", 2122, 2122, 1561, 0}, {"minecraft:torchflower_crop", 13526, 13526, 1561, 1},
+			{"minecraft:trapped_chest", 9936, 9937, 1562, 3}, {"minecraft:trial_spawner", 27706, 27712, 1565, 2},
+			{"minecraft:tripwire", 8321, 8448, 1567, 7}, {"minecraft:tripwire_hook", 8305, 8314, 1574, 3},
+			{"minecraft:tube_coral", 13854, 13854, 1577, 1}, {"minecraft:tube_coral_block", 13839, 13839, 1578, 0},
+			{"minecraft:tube_coral_fan", 13874, 13874, 1578, 1}, {"minecraft:tube_coral_wall_fan", 13924, 13924, 1579, 2},
+			{"minecraft:tuff", 22117, 22117, 1581, 0}, {"minecraft:tuff_brick_slab", 22941, 22944, 1581, 2},
+			{"minecraft:tuff_brick_stairs", 22947, 22958, 1583, 4}, {"minecraft:tuff_brick_wall", 23027, 23030, 1587, 6},
+			{"minecraft:tuff_bricks", 22940, 22940, 1593, 0}, {"minecraft:tuff_slab", 22118, 22121, 1593, 2},
+			{"minecraft:tuff_stairs", 22124, 22135, 1595, 4}, {"minecraft:tuff_wall", 22204, 22207, 1599, 6},
+			{"minecraft:turtle_egg", 13819, 13819, 1605, 2}, {"minecraft:twisting_vines", 19669, 19669, 1607, 1},
+			{"minecraft:twisting_vines_plant", 19695, 19695, 1608, 0}, {"minecraft:vault", 27718, 27722, 1608, 3},
+			{"minecraft:verdant_froglight", 27634, 27635, 1611, 1}, {"minecraft:vine", 7080, 7111, 1612, 5},
+			{"minecraft:void_air", 13989, 13989, 1617, 0}, {"minecraft:wall_torch", 2402, 2402, 1617, 1},
+			{"minecraft:warped_button", 20155, 20164, 1618, 3}, {"minecraft:warped_door", 20243, 20254, 1621, 5},
+			{"minecraft:warped_fence", 19747, 19778, 1626, 5}, {"minecraft:warped_fence_gate", 19939, 19946, 1631, 4},
+			{"minecraft:warped_fungus", 19623, 19623, 1635, 0}, {"minecraft:warped_hanging_sign", 5514, 5547, 1635, 3},
+			{"minecraft:warped_hyphae", 19616, 19617, 1638, 1}, {"minecraft:warped_nylium", 19622, 19622, 1639, 0},
+			{"minecraft:warped_planks", 19698, 19698, 1639, 0}, {"minecraft:warped_pressure_plate", 19713, 19714, 1639, 1},
+			{"minecraft:warped_roots", 19625, 19625, 1640, 0}, {"minecraft:warped_sign", 20339, 20340, 1640, 2},
+			{"minecraft:warped_slab", 19705, 19708, 1642, 2}, {"minecraft:warped_stairs", 20051, 20062, 1644, 4},
+			{"minecraft:warped_stem", 19610, 19611, 1648, 1}, {"minecraft:warped_trapdoor", 19843, 19858, 1649, 5},
+			{"minecraft:warped_wall_hanging_sign", 5786, 5787, 1654, 2}, {"minecraft:warped_wall_sign", 20379, 20380, 1656, 2},
+			{"minecraft:warped_wart_block", 19624, 19624, 1658, 0}, {"minecraft:water", 86, 86, 1658, 1},
+			{"minecraft:water_cauldron", 8183, 8183, 1659, 1}, {"minecraft:waxed_chiseled_copper", 23991, 23991, 1660, 0},
+			{"minecraft:waxed_copper_block", 24336, 24336, 1660, 0}, {"minecraft:waxed_copper_bulb", 25744, 25747, 1660, 2},
+			{"minecraft:waxed_copper_door", 24944, 24955, 1662, 5}, {"minecraft:waxed_copper_grate", 25720, 25721, 1667, 1},
+			{"minecraft:waxed_copper_trapdoor", 25456, 25471, 1668, 5}, {"minecraft:waxed_cut_copper", 24343, 24343, 1673, 0},
+			{"minecraft:waxed_cut_copper_slab", 24682, 24685, 1673, 2}, {"minecraft:waxed_cut_copper_stairs", 24584, 24595, 1675, 4},
+			{"minecraft:waxed_exposed_chiseled_copper", 23990, 23990, 1679, 0}, {"minecraft:waxed_exposed_copper", 24338, 24338, 1679, 0},
+			{"minecraft:waxed_exposed_copper_bulb", 25748, 25751, 1679, 2}, {"minecraft:waxed_exposed_copper_door", 25008, 25019, 1681, 5},
+			{"minecraft:waxed_exposed_copper_grate", 25722, 25723, 1686, 1}, {"minecraft:waxed_exposed_copper_trapdoor", 25520, 25535, 1687, 5},
+			{"minecraft:waxed_exposed_cut_copper", 24342, 24342, 1692, 0}, {"minecraft:waxed_exposed_cut_copper_slab", 24676, 24679, 1692, 2},
+			{"minecraft:waxed_exposed_cut_copper_stairs", 24504, 24515, 1694, 4},
+			{"minecraft:waxed_oxidized_chiseled_copper", 23988, 23988, 1698, 0}, {"minecraft:waxed_oxidized_copper", 24339, 24339, 1698, 0},
+			{"minecraft:waxed_oxidized_copper_bulb", 25756, 25759, 1698, 2}, {"minecraft:waxed_oxidized_copper_door", 25072, 25083, 1700, 5},
+			{"minecraft:waxed_oxidized_copper_grate", 25726, 25727, 1705, 1}, {"minecraft:waxed_oxidized_copper_trapdoor", 25584, 25599, 1706, 5},
+			{"minecraft:waxed_oxidized_cut_copper", 24340, 24340, 1711, 0}, {"minecraft:waxed_oxidized_cut_copper_slab", 24664, 24667, 1711, 2},
+			{"minecraft:waxed_oxidized_cut_copper_stairs", 24344, 24355, 1713, 4},
+			{"minecraft:waxed_weathered_chiseled_copper", 23989, 23989, 1717, 0}, {"minecraft:waxed_weathered_copper", 24337, 24337, 1717, 0},
+			{"minecraft:waxed_weathered_copper_bulb", 25752, 25755, 1717, 2}, {"minecraft:waxed_weathered_copper_door", 25136, 25147, 1719, 5},
+			{"minecraft:waxed_weathered_copper_grate", 25724, 25725, 1724, 1}, {"minecraft:waxed_weathered_copper_trapdoor", 25648, 25663, 1725, 5},
+			{"minecraft:waxed_weathered_cut_copper", 24341, 24341, 1730, 0}, {"minecraft:waxed_weathered_cut_copper_slab", 24670, 24673, 1730, 2},
+			{"minecraft:waxed_weathered_cut_copper_stairs", 24424, 24435, 1732, 4}, {"minecraft:weathered_chiseled_copper", 23985, 23985, 1736, 0},
+			{"minecraft:weathered_copper", 23976, 23976, 1736, 0}, {"minecraft:weathered_copper_bulb", 25736, 25739, 1736, 2},
+			{"minecraft:weathered_copper_door", 24880, 24891, 1738, 5}, {"minecraft:weathered_copper_grate", 25716, 25717, 1743, 1},
+			{"minecraft:weathered_copper_trapdoor", 25392, 25407, 1744, 5}, {"minecraft:weathered_cut_copper", 23981, 23981, 1749, 0},
+			{"minecraft:weathered_cut_copper_slab", 24318, 24321, 1749, 2}, {"minecraft:weathered_cut_copper_stairs", 24072, 24083, 1751, 4},
+			{"minecraft:weeping_vines", 19642, 19642, 1755, 1}, {"minecraft:weeping_vines_plant", 19668, 19668, 1756, 0},
+			{"minecraft:wet_sponge", 561, 561, 1756, 0}, {"minecraft:wheat", 4342, 4342, 1756, 1},
+			{"minecraft:white_banner", 11656, 11656, 1757, 1}, {"minecraft:white_bed", 1731, 1734, 1758, 3},
+			{"minecraft:white_candle", 21777, 21780, 1761, 3}, {"minecraft:white_candle_cake", 22035, 22036, 1764, 1},
+			{"minecraft:white_carpet", 11625, 11625, 1765, 0}, {"minecraft:white_concrete", 13759, 13759, 1765, 0},
+			{"minecraft:white_concrete_powder", 13775, 13775, 1765, 0}, {"minecraft:white_glazed_terracotta", 13695, 13695, 1765, 1},
+			{"minecraft:white_shulker_box", 13599, 13603, 1766, 1}, {"minecraft:white_stained_glass", 6124, 6124, 1767, 0},
+			{"minecraft:white_stained_glass_pane", 10189, 10220, 1767, 5}, {"minecraft:white_terracotta", 10173, 10173, 1772, 0},
+			{"minecraft:white_tulip", 2129, 2129, 1772, 0}, {"minecraft:white_wall_banner", 11912, 11912, 1772, 1},
+			{"minecraft:white_wool", 2093, 2093, 1773, 0}, {"minecraft:wildflowers", 25879, 25879, 1773, 2},
+			{"minecraft:wither_rose", 2133, 2133, 1775, 0}, {"minecraft:wither_skeleton_skull", 9684, 9700, 1775, 2},
+			{"minecraft:wither_skeleton_wall_skull", 9716, 9717, 1777, 2}, {"minecraft:yellow_banner", 11720, 11720, 1779, 1},
+			{"minecraft:yellow_bed", 1795, 1798, 1780, 3}, {"minecraft:yellow_candle", 21841, 21844, 1783, 3},
+			{"minecraft:yellow_candle_cake", 22043, 22044, 1786, 1}, {"minecraft:yellow_carpet", 11629, 11629, 1787, 0},
+			{"minecraft:yellow_concrete", 13763, 13763, 1787, 0}, {"minecraft:yellow_concrete_powder", 13779, 13779, 1787, 0},
+			{"minecraft:yellow_glazed_terracotta", 13711, 13711, 1787, 1}, {"minecraft:yellow_shulker_box", 13623, 13627, 1788, 1},
+			{"minecraft:yellow_stained_glass", 6128, 6128, 1789, 0}, {"minecraft:yellow_stained_glass_pane", 10317, 10348, 1789, 5},
+			{"minecraft:yellow_terracotta", 10177, 10177, 1794, 0}, {"minecraft:yellow_wall_banner", 11928, 11928, 1794, 1},
+			{"minecraft:yellow_wool", 2097, 2097, 1795, 0}, {"minecraft:zombie_head", 9724, 9740, 1795, 2},
+			{"minecraft:zombie_wall_head", 9756, 9757, 1797, 2},
+	};
+	inline constexpr uint32_t SEEDS[] = {
+			71, 5, 14, 47, 13, 27, 7, 22, 1, 10, 34, 2, 1, 7, 2, 16, 45, 75, 134, 71, 8, 252, 9, 72, 34, 18, 170, 138, 66, 31, 1, 46, 47, 1, 6, 14,
+			71, 2, 270, 87, 31, 3, 98, 5, 1, 46, 9, 11, 1, 262, 48, 26, 5, 2, 34, 1, 1, 129, 78, 9, 8, 80, 14, 1, 81, 188, 1, 19, 3, 355, 122, 9,
+			369, 23, 21, 2, 1, 123, 14, 254, 6, 349, 0, 232, 1, 82, 9, 1, 61, 1, 1, 232, 40, 2, 50, 91, 23, 262, 19, 8, 156, 173, 439, 38, 79, 747,
+			1, 18, 45, 699, 14, 105, 1174, 16, 162, 82, 20, 1481, 8, 616, 8, 20, 2, 1, 113, 28, 68, 2, 584, 2, 952, 27, 57, 7, 41, 380, 3, 131, 148,
+			1, 23, 27, 9, 134, 16, 441, 155, 2, 33, 35, 27, 38, 43, 50, 46, 2, 228, 292, 343, 461, 99, 41, 9, 91, 302, 2, 1, 6, 5, 743, 0, 145, 5,
+			28, 0, 102, 70, 286, 23, 5, 46, 5, 107, 1, 283, 29, 33, 539, 134, 3, 387, 141, 9, 159, 5, 92, 9, 216, 5, 6, 10, 139, 20, 420, 48, 2, 21,
+			322, 2, 86, 284, 76, 520, 227, 468, 111, 9, 18, 72, 25, 59, 41, 1287, 12, 18, 0, 38, 67, 3, 0, 271, 22, 4, 313, 45, 455, 164, 4192, 8,
+			1, 3, 1370, 142, 214, 2672, 27, 0, 71, 2530, 1, 787, 19, 2043, 13, 55, 9353, 444, 43, 1, 2385, 23, 1143, 629, 242, 27, 53, 105, 5328,
+			4730, 3, 373, 3082, 264, 623, 6, 46,
+	};
+	inline constexpr uint16_t SLOTS[] = {
+			731, 392, 609, 588, 264, 1027, 877, 796, 516, 96, 552, 885, 702, 682, 171, 616, 232, 495, 837, 874, 712, 880, 302, 603, 151, 1003, 263,
+			830, 678, 1061, 511, 182, 161, 197, 923, 536, 504, 721, 183, 480, 73, 389, 11, 1069, 556, 894, 599, 486, 1006, 906, 328, 559, 462, 526,
+			768, 1055, 824, 191, 714, 49, 734, 149, 410, 727, 876, 657, 446, 196, 976, 694, 604, 802, 289, 5, 185, 1072, 200, 665, 1083, 541, 769,
+			987, 300, 498, 8, 349, 726, 813, 433, 555, 502, 189, 376, 958, 70, 924, 525, 650, 881, 993, 602, 214, 261, 467, 474, 1001, 753, 532,
+			943, 673, 427, 84, 1048, 557, 956, 600, 565, 873, 839, 282, 980, 601, 912, 143, 478, 704, 945, 69, 430, 188, 379, 247, 512, 625, 1002,
+			369, 1101, 805, 548, 377, 308, 799, 400, 573, 654, 454, 321, 651, 428, 1102, 121, 845, 342, 587, 243, 641, 241, 39, 445, 403, 542, 717,
+			1026, 998, 453, 417, 37, 576, 533, 633, 759, 626, 113, 499, 260, 391, 338, 136, 319, 762, 1019, 819, 1011, 1034, 222, 162, 173, 157,
+			670, 492, 803, 471, 408, 255, 545, 807, 304, 1037, 986, 954, 249, 897, 543, 43, 89, 611, 1050, 85, 217, 184, 947, 634, 590, 439, 386,
+			204, 160, 464, 429, 972, 175, 36, 691, 715, 959, 397, 65, 461, 290, 1103, 1098, 710, 597, 158, 347, 549, 648, 448, 240, 355, 1093, 775,
+			820, 78, 251, 23, 828, 964, 581, 612, 332, 466, 129, 739, 979, 658, 388, 72, 28, 905, 438, 348, 992, 1063, 473, 847, 476, 313, 1099,
+			359, 368, 770, 269, 666, 607, 755, 447, 975, 487, 146, 455, 1010, 176, 364, 645, 1030, 38, 944, 1079, 256, 591, 822, 850, 274, 443, 962,
+			955, 528, 586, 170, 605, 34, 763, 1096, 233, 614, 167, 776, 296, 832, 696, 31, 179, 752, 500, 711, 1064, 928, 854, 887, 357, 4, 218,
+			853, 578, 888, 628, 207, 781, 1066, 32, 115, 424, 772, 229, 24, 147, 458, 655, 783, 784, 999, 306, 918, 868, 952, 522, 977, 268, 293,
+			893, 660, 1038, 810, 259, 589, 817, 531, 719, 15, 1056, 595, 656, 393, 344, 1, 164, 883, 1097, 351, 496, 896, 582, 19, 911, 644, 350,
+			26, 235, 875, 193, 942, 736, 199, 860, 20, 82, 908, 778, 431, 706, 272, 698, 936, 664, 638, 1100, 459, 546, 1044, 563, 103, 1018, 997,
+			792, 913, 104, 1070, 919, 821, 100, 713, 280, 973, 33, 1028, 637, 826, 835, 62, 863, 295, 846, 878, 703, 363, 848, 742, 619, 676, 1015,
+			192, 358, 1008, 940, 1017, 468, 938, 404, 71, 635, 647, 353, 220, 206, 782, 396, 594, 375, 109, 252, 238, 187, 250, 13, 932, 882, 780,
+			904, 1082, 76, 401, 523, 288, 352, 90, 245, 422, 55, 248, 314, 984, 119, 985, 166, 1047, 777, 870, 60, 617, 663, 996, 744, 112, 680,
+			684, 895, 1065, 1078, 534, 659, 53, 419, 798, 278, 253, 907, 785, 661, 390, 298, 653, 632, 679, 51, 153, 624, 414, 128, 441, 1087, 271,
+			315, 107, 482, 491, 1036, 1013, 1091, 1007, 927, 855, 1058, 98, 485, 61, 50, 579, 946, 574, 494, 615, 316, 1052, 475, 515, 865, 154,
+			508, 21, 748, 124, 1084, 1057, 1023, 957, 239, 700, 1073, 858, 765, 569, 672, 345, 398, 110, 553, 510, 405, 420, 643, 1021, 80, 44, 198,
+			509, 208, 1094, 960, 416, 285, 519, 982, 81, 1020, 331, 566, 767, 939, 94, 683, 305, 297, 1080, 45, 1053, 914, 226, 640, 472, 1090, 224,
+			132, 774, 1046, 380, 1060, 488, 671, 686, 773, 303, 451, 730, 484, 524, 432, 692, 40, 950, 884, 537, 921, 426, 324, 812, 1022, 795, 423,
+			754, 622, 148, 159, 866, 550, 1014, 343, 174, 456, 210, 312, 971, 418, 1059, 856, 469, 221, 1025, 139, 111, 872, 787, 1041, 538, 123,
+			925, 899, 716, 564, 687, 793, 620, 518, 257, 1024, 1068, 1029, 1039, 931, 385, 10, 99, 705, 63, 294, 790, 219, 978, 750, 934, 86, 442,
+			190, 91, 953, 325, 48, 402, 125, 852, 87, 951, 58, 900, 728, 568, 1009, 118, 22, 507, 902, 213, 629, 330, 1074, 720, 1092, 747, 871,
+			362, 786, 815, 1016, 746, 898, 859, 354, 283, 540, 114, 212, 583, 593, 41, 1005, 273, 127, 737, 610, 539, 156, 990, 630, 327, 501, 729,
+			105, 372, 346, 920, 761, 922, 814, 1095, 831, 804, 668, 460, 68, 935, 117, 1081, 811, 497, 745, 126, 520, 102, 0, 406, 970, 366, 681,
+			52, 437, 254, 917, 1012, 310, 514, 879, 1051, 244, 463, 46, 1042, 891, 797, 929, 969, 544, 27, 267, 333, 618, 75, 825, 230, 592, 493,
+			83, 741, 30, 74, 869, 201, 381, 425, 18, 806, 64, 560, 236, 838, 329, 130, 12, 356, 567, 718, 688, 861, 326, 337, 309, 558, 317, 234,
+			116, 627, 155, 373, 138, 186, 449, 948, 3, 57, 1043, 983, 1033, 202, 892, 857, 66, 141, 440, 760, 505, 93, 506, 800, 279, 690, 67, 339,
+			177, 1000, 54, 122, 450, 709, 596, 677, 901, 178, 383, 1004, 286, 88, 816, 180, 788, 7, 1067, 6, 1035, 909, 667, 699, 371, 17, 1077,
+			227, 106, 360, 25, 131, 367, 152, 150, 292, 382, 1071, 562, 733, 140, 842, 749, 844, 937, 95, 108, 991, 209, 740, 374, 59, 743, 886,
+			570, 722, 336, 766, 580, 409, 407, 205, 674, 79, 281, 527, 995, 489, 961, 47, 577, 384, 483, 613, 287, 137, 707, 479, 142, 864, 701,
+			181, 994, 675, 1040, 1085, 521, 841, 470, 689, 215, 963, 14, 968, 2, 966, 370, 270, 723, 413, 35, 791, 834, 941, 833, 434, 435, 465,
+			652, 623, 575, 561, 341, 529, 237, 318, 725, 903, 1089, 101, 340, 436, 598, 862, 195, 477, 965, 323, 421, 926, 513, 411, 284, 621, 572,
+			490, 265, 457, 789, 1086, 225, 584, 216, 444, 77, 801, 399, 165, 930, 415, 228, 547, 135, 988, 757, 242, 120, 771, 949, 585, 56, 843,
+			203, 724, 530, 823, 890, 738, 849, 981, 697, 974, 827, 378, 840, 194, 172, 92, 365, 551, 412, 1031, 361, 851, 669, 291, 144, 29, 299,
+			708, 481, 695, 818, 246, 867, 168, 571, 223, 732, 42, 387, 779, 262, 642, 1049, 334, 1075, 808, 631, 517, 606, 649, 662, 134, 301, 756,
+			535, 794, 1032, 758, 608, 452, 1076, 395, 829, 639, 1054, 915, 211, 335, 277, 967, 764, 836, 1045, 693, 910, 503, 322, 320, 145, 97,
+			275, 735, 809, 636, 169, 685, 163, 1062, 276, 16, 1088, 266, 231, 554, 916, 646, 9, 394, 133, 889, 258, 751, 933, 307, 989, 311,
+	};
+	inline constexpr uint16_t BLOCK_PROPERTIES[] = {
+			0, 1, 2, 1, 3, 4, 5, 2, 6, 7, 8, 9, 10, 1, 11, 5, 2, 12, 13, 9, 14, 15, 9, 16, 2, 17, 13, 9, 18, 9, 1, 19, 20, 9, 1, 19, 5, 2, 9, 1, 9,
+			1, 9, 16, 2, 21, 9, 22, 9, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 1, 1, 1, 14, 15, 9, 28, 29, 17, 16, 0, 1, 2, 1, 3, 4, 5, 2, 6, 7,
+			8, 9, 10, 1, 11, 5, 2, 12, 13, 9, 18, 9, 1, 19, 20, 9, 2, 13, 9, 18, 9, 1, 19, 20, 9, 1, 19, 5, 2, 9, 1, 9, 1, 9, 22, 5, 9, 16, 1, 30,
+			1, 30, 31, 32, 1, 2, 1, 33, 9, 1, 9, 0, 1, 2, 1, 3, 4, 5, 2, 6, 7, 8, 9, 10, 1, 11, 5, 2, 12, 13, 9, 14, 15, 9, 16, 2, 17, 13, 9, 18, 9,
+			1, 19, 20, 9, 1, 19, 5, 2, 9, 1, 9, 1, 9, 16, 13, 1, 34, 35, 36, 37, 9, 37, 1, 22, 6, 7, 8, 9, 10, 1, 18, 9, 1, 19, 20, 9, 23, 24, 25,
+			26, 9, 27, 1, 37, 13, 1, 34, 35, 36, 37, 9, 37, 1, 22, 6, 7, 8, 9, 10, 1, 16, 9, 9, 1, 9, 38, 39, 40, 18, 9, 1, 19, 20, 9, 23, 24, 25,
+			26, 9, 27, 13, 1, 34, 35, 36, 37, 9, 37, 1, 41, 6, 7, 8, 26, 10, 22, 6, 7, 8, 9, 10, 1, 42, 9, 9, 1, 9, 43, 44, 1, 45, 46, 9, 1, 37, 47,
+			9, 36, 37, 9, 37, 48, 1, 49, 50, 50, 16, 9, 51, 22, 0, 1, 2, 1, 3, 4, 5, 2, 6, 7, 8, 9, 10, 1, 11, 5, 2, 12, 13, 9, 14, 15, 9, 16, 2,
+			17, 13, 9, 18, 9, 1, 19, 20, 9, 1, 19, 5, 2, 9, 1, 9, 1, 9, 16, 1, 52, 9, 1, 1, 53, 54, 55, 56, 57, 58, 59, 41, 6, 7, 8, 26, 10, 18, 9,
+			1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 60, 1, 51, 22, 1, 61, 2, 62, 9, 37, 2, 1, 3, 4, 5, 2,
+			9, 1, 19, 5, 2, 9, 63, 64, 65, 16, 66, 67, 2, 13, 1, 2, 0, 1, 2, 1, 3, 4, 5, 2, 6, 7, 8, 9, 10, 1, 11, 5, 2, 12, 13, 9, 16, 2, 13, 9,
+			18, 9, 1, 19, 20, 9, 16, 1, 19, 5, 2, 9, 1, 9, 1, 9, 18, 9, 1, 19, 20, 9, 18, 9, 18, 9, 13, 1, 34, 35, 36, 37, 9, 37, 1, 22, 6, 7, 8, 9,
+			10, 1, 1, 0, 1, 2, 1, 3, 4, 5, 2, 6, 7, 8, 9, 10, 1, 11, 5, 2, 12, 13, 9, 14, 15, 9, 16, 2, 17, 13, 9, 18, 9, 1, 19, 20, 9, 1, 19, 5, 2,
+			9, 1, 9, 1, 9, 16, 18, 9, 1, 19, 20, 9, 68, 45, 9, 9, 1, 9, 9, 9, 1, 9, 9, 9, 1, 9, 9, 9, 1, 9, 9, 9, 1, 9, 69, 1, 9, 16, 18, 9, 1, 19,
+			20, 9, 23, 24, 25, 26, 9, 27, 37, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 2, 21, 9, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 22,
+			65, 2, 13, 1, 2, 22, 65, 70, 1, 22, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 1, 9, 37, 2, 1, 3, 4, 5, 2, 9, 1, 19, 5, 2, 9, 18, 9, 1,
+			19, 20, 9, 71, 43, 6, 7, 8, 26, 10, 9, 9, 1, 9, 14, 15, 9, 31, 1, 37, 6, 7, 8, 9, 10, 41, 6, 7, 8, 26, 9, 10, 18, 9, 1, 19, 20, 9, 23,
+			24, 25, 26, 9, 27, 72, 13, 1, 34, 35, 36, 37, 9, 37, 1, 22, 6, 7, 8, 9, 10, 1, 13, 1, 34, 35, 36, 37, 9, 37, 1, 22, 6, 7, 8, 9, 10, 1,
+			0, 1, 9, 16, 9, 45, 73, 74, 9, 9, 1, 9, 16, 6, 7, 8, 9, 10, 1, 3, 4, 5, 2, 1, 19, 5, 2, 9, 1, 64, 75, 0, 1, 2, 1, 3, 4, 5, 2, 6, 7, 8,
+			9, 10, 1, 11, 5, 2, 12, 13, 9, 14, 15, 9, 16, 2, 17, 13, 9, 18, 9, 1, 19, 20, 9, 1, 19, 5, 2, 9, 1, 9, 1, 9, 16, 49, 1, 9, 76, 9, 22, 9,
+			3, 77, 1, 78, 1, 79, 2, 0, 1, 2, 77, 9, 13, 1, 34, 35, 36, 37, 9, 37, 1, 22, 6, 7, 8, 9, 10, 1, 13, 1, 34, 35, 36, 37, 9, 37, 1, 22, 6,
+			7, 8, 9, 10, 1, 45, 22, 2, 9, 3, 13, 1, 34, 35, 36, 37, 9, 37, 1, 22, 6, 7, 8, 9, 10, 1, 1, 13, 1, 34, 35, 36, 37, 9, 37, 1, 22, 6, 7,
+			8, 9, 10, 1, 0, 1, 2, 1, 3, 4, 5, 2, 6, 7, 8, 9, 10, 1, 11, 5, 2, 12, 13, 9, 14, 15, 9, 16, 2, 80, 76, 17, 9, 9, 13, 9, 18, 9, 1, 19,
+			20, 9, 1, 19, 5, 2, 9, 1, 9, 1, 9, 16, 22, 9, 48, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9,
+			27, 22, 81, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 16, 41, 6, 7, 8, 26, 10, 72, 6, 7, 8, 9, 10, 18, 9, 1, 19, 20, 9, 23, 24, 25,
+			26, 9, 27, 82, 31, 83, 84, 2, 0, 1, 2, 1, 3, 4, 5, 2, 6, 7, 8, 9, 10, 1, 11, 5, 2, 12, 13, 9, 14, 15, 9, 16, 2, 17, 13, 9, 18, 9, 1, 19,
+			20, 9, 1, 19, 5, 2, 9, 1, 9, 1, 9, 16, 22, 2, 16, 13, 1, 34, 35, 36, 37, 9, 37, 1, 22, 6, 7, 8, 9, 10, 1, 37, 2, 1, 3, 4, 5, 2, 9, 1,
+			19, 5, 2, 9, 18, 9, 1, 19, 20, 9, 85, 86, 23, 24, 25, 27, 0, 1, 2, 1, 3, 4, 5, 2, 6, 7, 8, 9, 10, 1, 11, 5, 2, 12, 13, 9, 14, 15, 9, 16,
+			2, 17, 13, 9, 18, 9, 1, 19, 20, 9, 1, 19, 5, 2, 9, 1, 9, 1, 9, 16, 16, 3, 18, 9, 2, 13, 1, 2, 13, 1, 34, 35, 36, 37, 9, 37, 1, 1, 87,
+			22, 6, 7, 8, 9, 10, 1, 88, 22, 22, 89, 81, 80, 3, 3, 2, 13, 1, 2, 72, 90, 91, 9, 18, 9, 1, 19, 20, 9, 16, 18, 9, 1, 19, 20, 9, 23, 24,
+			25, 26, 9, 27, 0, 1, 2, 2, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 18, 9, 1, 19, 20, 9,
+			18, 9, 1, 19, 20, 9, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 48, 17, 17, 17, 17, 17, 17, 17, 17, 92, 2, 21, 9, 18, 9, 1, 19, 20, 9,
+			18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 48, 13, 1, 34, 35, 36, 37, 9, 37, 1, 22, 6, 7, 8, 9, 10, 1, 16, 18, 9, 1, 19, 20, 9, 16, 18,
+			9, 1, 19, 20, 9, 93, 9, 13, 1, 34, 35, 36, 37, 9, 37, 1, 41, 6, 7, 8, 26, 10, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 18, 9, 1, 19,
+			20, 9, 23, 24, 25, 26, 9, 27, 22, 6, 7, 8, 9, 10, 1, 37, 37, 37, 1, 37, 94, 95, 45, 96, 97, 98, 1, 99, 2, 51, 22, 18, 9, 1, 19, 20, 9,
+			23, 24, 25, 26, 9, 27, 41, 6, 7, 8, 26, 9, 10, 100, 3, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 86, 101, 9, 102, 45, 46, 9, 103, 104,
+			9, 41, 6, 7, 8, 26, 9, 10, 105, 9, 22, 2, 13, 1, 2, 22, 9, 1, 3, 9, 1, 37, 18, 9, 1, 19, 20, 9, 18, 9, 1, 19, 20, 9, 18, 9, 1, 19, 20,
+			9, 18, 9, 106, 107, 1, 37, 47, 9, 76, 9, 1, 0, 1, 2, 1, 3, 4, 5, 2, 6, 7, 8, 9, 10, 1, 11, 5, 2, 12, 13, 9, 14, 15, 9, 16, 2, 17, 13, 9,
+			18, 9, 1, 19, 20, 9, 1, 19, 5, 2, 9, 1, 9, 1, 9, 16, 88, 22, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 0, 1, 2, 2, 18, 9, 1, 19, 20,
+			9, 1, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 108, 43, 3, 109, 109, 31, 3, 3, 45,
+			110, 111, 28, 1, 52, 9, 112, 113, 12, 114, 6, 7, 2, 8, 10, 12, 1, 2, 9, 9, 1, 9, 18, 9, 1, 19, 20, 9, 23, 24, 25, 26, 9, 27, 18, 9, 1,
+			19, 20, 9, 23, 24, 25, 26, 9, 27, 115, 106, 49, 1, 112, 116, 16, 6, 7, 8, 26, 10, 1, 0, 1, 2, 1, 3, 4, 5, 2, 6, 7, 8, 9, 10, 1, 11, 5,
+			2, 12, 13, 9, 16, 2, 13, 9, 18, 9, 1, 19, 20, 9, 16, 1, 19, 5, 2, 9, 1, 9, 1, 9, 77, 92, 37, 2, 1, 3, 4, 5, 2, 9, 1, 19, 5, 2, 9, 18, 9,
+			1, 19, 20, 9, 37, 2, 1, 3, 4, 5, 2, 9, 1, 19, 5, 2, 9, 18, 9, 1, 19, 20, 9, 37, 2, 1, 3, 4, 5, 2, 9, 1, 19, 5, 2, 9, 18, 9, 1, 19, 20,
+			9, 37, 2, 1, 3, 4, 5, 2, 9, 1, 19, 5, 2, 9, 18, 9, 1, 19, 20, 9, 37, 2, 1, 3, 4, 5, 2, 9, 1, 19, 5, 2, 9, 18, 9, 1, 19, 20, 9, 49, 48,
+			13, 1, 34, 35, 36, 37, 9, 37, 1, 22, 6, 7, 8, 9, 10, 1, 1, 87, 2, 13, 1, 2, 13, 1, 34, 35, 36, 37, 9, 37, 1, 22, 6, 7, 8, 9, 10, 1, 2,
+			13, 1, 2,
+	};
+	// name, first entry in VALUES, value count
+	inline constexpr BlockStateProperty PROPERTIES[] = {
+			{"face", 0, 3}, {"facing", 3, 4}, {"powered", 7, 2}, {"half", 9, 2}, {"hinge", 11, 2}, {"open", 7, 2}, {"east", 7, 2}, {"north", 7, 2},
+			{"south", 7, 2}, {"waterlogged", 7, 2}, {"west", 7, 2}, {"in_wall", 7, 2}, {"attached", 7, 2}, {"rotation", 13, 16},
+			{"distance", 29, 7}, {"persistent", 7, 2}, {"axis", 36, 3}, {"stage", 39, 2}, {"type", 41, 3}, {"half", 44, 2}, {"shape", 46, 5},
+			{"shape", 51, 6}, {"facing", 57, 6}, {"east", 63, 3}, {"north", 63, 3}, {"south", 63, 3}, {"up", 7, 2}, {"west", 63, 3}, {"age", 39, 2},
+			{"leaves", 66, 3}, {"honey_level", 69, 6}, {"age", 75, 4}, {"attachment", 79, 4}, {"tilt", 83, 4}, {"occupied", 7, 2}, {"part", 87, 2},
+			{"candles", 89, 4}, {"lit", 7, 2}, {"has_bottle_0", 7, 2}, {"has_bottle_1", 7, 2}, {"has_bottle_2", 7, 2}, {"down", 7, 2},
+			{"drag", 7, 2}, {"age", 13, 16}, {"bites", 93, 7}, {"power", 13, 16}, {"sculk_sensor_phase", 100, 3}, {"signal_fire", 7, 2},
+			{"age", 103, 8}, {"age", 111, 26}, {"berries", 7, 2}, {"conditional", 7, 2}, {"type", 137, 3}, {"slot_0_occupied", 7, 2},
+			{"slot_1_occupied", 7, 2}, {"slot_2_occupied", 7, 2}, {"slot_3_occupied", 7, 2}, {"slot_4_occupied", 7, 2}, {"slot_5_occupied", 7, 2},
+			{"age", 69, 6}, {"age", 140, 3}, {"mode", 143, 2}, {"level", 145, 9}, {"crafting", 7, 2}, {"orientation", 154, 12}, {"triggered", 7, 2},
+			{"creaking_heart_state", 166, 3}, {"natural", 7, 2}, {"inverted", 7, 2}, {"cracked", 7, 2}, {"eye", 7, 2}, {"moisture", 103, 8},
+			{"snowy", 7, 2}, {"enabled", 7, 2}, {"facing", 169, 5}, {"has_record", 7, 2}, {"hanging", 7, 2}, {"level", 13, 16},
+			{"segment_amount", 89, 4}, {"has_book", 7, 2}, {"age", 174, 5}, {"type", 179, 2}, {"axis", 181, 2}, {"instrument", 183, 23},
+			{"note", 206, 25}, {"tip", 7, 2}, {"bottom", 7, 2}, {"flower_amount", 89, 4}, {"extended", 7, 2}, {"short", 7, 2},
+			{"thickness", 231, 5}, {"vertical_direction", 236, 2}, {"level", 238, 3}, {"shape", 241, 10}, {"east", 251, 3}, {"north", 251, 3},
+			{"south", 251, 3}, {"west", 251, 3}, {"delay", 89, 4}, {"locked", 7, 2}, {"charges", 174, 5}, {"distance", 103, 8}, {"bloom", 7, 2},
+			{"can_summon", 7, 2}, {"shrieking", 7, 2}, {"pickles", 89, 4}, {"hatch", 140, 3}, {"layers", 254, 8}, {"mode", 262, 4},
+			{"dusted", 75, 4}, {"mode", 266, 4}, {"unstable", 7, 2}, {"ominous", 7, 2}, {"trial_spawner_state", 270, 6}, {"disarmed", 7, 2},
+			{"eggs", 89, 4}, {"vault_state", 276, 4},
+	};
+	inline constexpr std::string_view VALUES[] = {
+			"floor", "wall", "ceiling", "north", "east", "south", "west", "true", "false", "upper", "lower", "left", "right", "0", "1", "2", "3",
+			"4", "5", "6", "7", "8", "9", "10", "11", "12", "13", "14", "15", "1", "2", "3", "4", "5", "6", "7", "x", "y", "z", "0", "1", "top",
+			"bottom", "double", "top", "bottom", "straight", "inner_left", "inner_right", "outer_left", "outer_right", "north_south", "east_west",
+			"ascending_east", "ascending_west", "ascending_north", "ascending_south", "north", "east", "south", "west", "up", "down", "none", "low",
+			"tall", "none", "small", "large", "0", "1", "2", "3", "4", "5", "0", "1", "2", "3", "floor", "ceiling", "single_wall", "double_wall",
+			"none", "unstable", "partial", "full", "head", "foot", "1", "2", "3", "4", "0", "1", "2", "3", "4", "5", "6", "inactive", "active",
+			"cooldown", "0", "1", "2", "3", "4", "5", "6", "7", "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "10", "11", "12", "13", "14",
+			"15", "16", "17", "18", "19", "20", "21", "22", "23", "24", "25", "single", "left", "right", "0", "1", "2", "compare", "subtract", "0",
+			"1", "2", "3", "4", "5", "6", "7", "8", "down_east", "down_north", "down_south", "down_west", "up_east", "up_north", "up_south",
+			"up_west", "west_up", "east_up", "north_up", "south_up", "uprooted", "dormant", "awake", "down", "north", "south", "west", "east", "0",
+			"1", "2", "3", "4", "normal", "sticky", "x", "z", "harp", "basedrum", "snare", "hat", "bass", "flute", "bell", "guitar", "chime",
+			"xylophone", "iron_xylophone", "cow_bell", "didgeridoo", "bit", "banjo", "pling", "zombie", "skeleton", "creeper", "dragon",
+			"wither_skeleton", "piglin", "custom_head", "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "10", "11", "12", "13", "14", "15", "16",
+			"17", "18", "19", "20", "21", "22", "23", "24", "tip_merge", "tip", "frustum", "middle", "base", "up", "down", "1", "2", "3",
+			"north_south", "east_west", "ascending_east", "ascending_west", "ascending_north", "ascending_south", "south_east", "south_west",
+			"north_west", "north_east", "up", "side", "none", "1", "2", "3", "4", "5", "6", "7", "8", "save", "load", "corner", "data", "start",
+			"log", "fail", "accept", "inactive", "waiting_for_players", "active", "waiting_for_reward_ejection", "ejecting_reward", "cooldown",
+			"inactive", "active", "unlocking", "ejecting",
+	};
+} // namespace BlockStatesData
+
+class BlockStates {
+  public:
+	static constexpr uint32_t STATE_COUNT = 27922;
+
+	static constexpr BlockStateTable TABLE = BlockStateTable(BlockStatesData::BLOCKS, BlockStatesData::SEEDS, BlockStatesData::SLOTS,
+															  BlockStatesData::BLOCK_PROPERTIES, BlockStatesData::PROPERTIES, BlockStatesData::VALUES);
+
+	static constexpr const BlockStateTable& get() { return TABLE; }
+};
+
+#endif // BLOCK_STATES_HPP
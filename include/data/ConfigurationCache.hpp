@@ -0,0 +1,45 @@
+#ifndef MC_CPP_SERVER_DATA_CONFIGURATION_CACHE_HPP
+#define MC_CPP_SERVER_DATA_CONFIGURATION_CACHE_HPP
+
+#include "network/buffer.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Data pack advertised in Clientbound Known Packs. A client that echoes it back already holds every vanilla
+// registry entry, so Registry Data only has to carry the entry IDs.
+inline constexpr std::string_view CORE_PACK_NAMESPACE = "minecraft";
+inline constexpr std::string_view CORE_PACK_ID		  = "core";
+inline constexpr std::string_view CORE_PACK_VERSION	  = "1.21.5";
+
+// Configuration phase frames that are the same for every client (Registry Data x N + Update Tags), encoded once at
+// startup and queued by reference on each login. The registry sources only carry entry names, so Registry Data
+// always holds entry IDs: a client without the core pack has nothing to resolve them against.
+class ConfigurationCache {
+  public:
+	using Blob = std::shared_ptr<const std::vector<uint8_t>>;
+
+  private:
+	Blob   _frames;
+	size_t _registryCount;
+
+  public:
+	ConfigurationCache();
+
+	// Throws std::runtime_error when the registries cannot be encoded
+	void build();
+
+	bool		isBuilt() const { return _frames != nullptr; }
+	const Blob& getFrames() const { return _frames; }
+	size_t		getRegistryCount() const { return _registryCount; }
+
+	// True when the client's Serverbound Known Packs list contains the core pack at our version
+	static bool sharesCorePack(const std::vector<Buffer::KnownPack>& clientPacks);
+};
+
+// Appends the complete Update Tags (0x0D) frame to out
+void encodeUpdateTagsFrame(Buffer& out);
+
+#endif // MC_CPP_SERVER_DATA_CONFIGURATION_CACHE_HPP
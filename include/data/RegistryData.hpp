@@ -8,6 +8,8 @@
 #include <string>
 #include <vector>
 
+class Buffer;
+
 struct RegistryDataEntry {
 	std::string								 entry_id;
 	bool									 has_data;
@@ -42,7 +44,8 @@ class RegistryData {
 
 	void addEntry(const std::string& entryId, bool hasData = false, std::optional<std::shared_ptr<nbt::Tag>> data = std::nullopt);
 
-	std::vector<uint8_t> serialize() const;
+	// Appends the Registry Data body (without length prefix and packet ID) to buffer.
+	void serialize(Buffer& buffer) const;
 
 	static constexpr uint8_t PACKET_ID = 0x07;
 
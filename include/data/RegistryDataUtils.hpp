@@ -2,25 +2,31 @@
 #define MC_CPP_SERVER_DATA_REGISTRY_UTILS_HPP
 
 #include "RegistryData.hpp"
-#include "network/packet.hpp"
-#include "network/server.hpp"
+#include "RegistryTable.hpp"
+#include "network/buffer.hpp"
 
-#include <map>
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <vector>
 
 std::vector<RegistryData> parseMinecraftRegistries();
 
-void sendRegistryData(Packet& packet, Server& server);
-
 bool validateRegistryData(const RegistryData& registry);
 
-RegistryData createRegistryFromMap(const std::string& registryName, const std::map<std::string, uint32_t>& registryData, bool addNamespace = true);
+RegistryData createRegistryFromTable(const std::string& registryName, const RegistryTable& registryData, bool addNamespace = true);
 
-std::vector<uint8_t> serializeRegistryPacket(const RegistryData& registry);
+void serializeRegistryPacket(const RegistryData& registry, Buffer& out);
 
-void sendRegistryDataBatch(Packet& packet, Server& server, const std::vector<RegistryData>& registries);
+// Appends one complete Registry Data frame per valid registry to out, returns how many were written
+size_t encodeRegistryFrames(const std::vector<RegistryData>& registries, Buffer& out);
 
 std::vector<RegistryData> createAllEssentialRegistries();
 
+// Network id of `entry` in a registry synced by parseMinecraftRegistries: its position in the Registry Data sent,
+// -1 when the registry or the entry is unknown
+int getSyncedEntryId(const std::string& registry, std::string_view entry);
+// Number of entries of a registry synced by parseMinecraftRegistries, 0 when it is unknown
+size_t getSyncedEntryCount(const std::string& registry);
+
 #endif // MC_CPP_SERVER_DATA_REGISTRY_UTILS_HPP
@@ -0,0 +1,68 @@
+#ifndef REGISTRY_TABLE_HPP
+#define REGISTRY_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+struct RegistryIdEntry {
+	std::string_view name;
+	uint32_t		 id;
+};
+
+// Immutable name <-> protocol id table, data generated by tools/gen_registry_ids.py.
+// name -> id: minimal perfect hash (hash and displace), one bucket seed, one slot, one string compare.
+// id -> name: dense array. Everything is constexpr and lookups never allocate.
+class RegistryTable {
+  private:
+	std::span<const RegistryIdEntry>  _entries; // sorted by name
+	std::span<const uint32_t>		  _seeds;	// displacement seed per bucket
+	std::span<const uint16_t>		  _slots;	// hash slot -> index in _entries
+	std::span<const std::string_view> _names;	// id -> name
+
+  public:
+	// Must match rt_hash() in tools/gen_registry_ids.py
+	static constexpr uint32_t hash(uint32_t seed, std::string_view key) {
+		uint32_t h = 2166136261u ^ seed;
+		for (char c : key) {
+			h ^= static_cast<uint8_t>(c);
+			h *= 16777619u;
+		}
+		h ^= h >> 15;
+		h *= 0x2c1b3c6du;
+		h ^= h >> 12;
+		return h;
+	}
+
+	constexpr RegistryTable(std::span<const RegistryIdEntry>  entries,
+							std::span<const uint32_t>		  seeds,
+							std::span<const uint16_t>		  slots,
+							std::span<const std::string_view> names)
+		: _entries(entries), _seeds(seeds), _slots(slots), _names(names) {}
+
+	constexpr std::optional<uint32_t> find(std::string_view name) const {
+		if (_entries.empty()) return std::nullopt;
+		uint32_t			   bucket = hash(0, name) % _seeds.size();
+		uint32_t			   slot	  = hash(_seeds[bucket], name) % _slots.size();
+		const RegistryIdEntry& entry  = _entries[_slots[slot]];
+		if (entry.name != name) return std::nullopt;
+		return entry.id;
+	}
+
+	constexpr uint32_t getId(std::string_view name, uint32_t fallback = 0) const { return find(name).value_or(fallback); }
+	constexpr bool	   contains(std::string_view name) const { return find(name).has_value(); }
+
+	// Empty view for ids outside the registry
+	constexpr std::string_view getName(uint32_t id) const { return id < _names.size() ? _names[id] : std::string_view(); }
+
+	constexpr size_t size() const { return _entries.size(); }
+	constexpr bool	 empty() const { return _entries.empty(); }
+
+	// Iteration in name order
+	constexpr const RegistryIdEntry* begin() const { return _entries.data(); }
+	constexpr const RegistryIdEntry* end() const { return _entries.data() + _entries.size(); }
+};
+
+#endif
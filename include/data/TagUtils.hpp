@@ -1,13 +1,40 @@
 #pragma once
 
-#include "RegistriesTag.hpp"
-
+#include <atomic>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <vector>
 
+// Defined in RegistriesTag.hpp; include it where the tag lists themselves are needed, the table is large
+struct Tag;
+
+// Interned tag: a dense bitset over its registry's id space inside the shared tag index.
+// The default handle is empty and contains nothing.
+struct TagHandle {
+	uint32_t offset = 0; // first 64-bit word in the index
+	uint32_t bits	= 0; // registry id space covered
+
+	bool isValid() const { return bits != 0; }
+};
+
 class TagUtils {
+  private:
+	// Set by buildIndex(), which resolve() may call from any worker: atomic so the bits are seen built
+	static inline std::atomic<const uint64_t*> s_tagBits = nullptr;
+
   public:
+	// Builds the bitset index over every tag; idempotent, resolve() calls it as well
+	static void buildIndex();
+
+	// Slow path, meant for startup: look the handle up once and keep it
+	static TagHandle resolve(const std::string& registryName, const std::string& tagName);
+
+	// Hot path: one bounds check and one bit test
+	static bool contains(TagHandle tag, uint32_t entryId) {
+		return entryId < tag.bits && ((s_tagBits.load(std::memory_order_acquire)[tag.offset + (entryId >> 6)] >> (entryId & 63)) & 1u);
+	}
+
 	static std::optional<std::vector<Tag>> getTagsForRegistry(const std::string& registryName);
 
 	static std::optional<Tag> getTag(const std::string& registryName, const std::string& tagName);
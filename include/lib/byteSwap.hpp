@@ -0,0 +1,30 @@
+#ifndef BYTE_SWAP_HPP
+#define BYTE_SWAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace nbt {
+
+	// Bulk conversion between big endian (NBT) and host order for Int and Long arrays: copies `count` elements from
+	// `src` to `dst`, reversing the bytes of each. Neither pointer needs to be aligned, and `dst == src` swaps in
+	// place (partial overlap is not supported). The kernel (AVX2 or SSSE3 pshufb, else scalar) is picked once
+	// from the CPU; on a big endian host this is a memcpy.
+	void byteSwapCopy32(void* dst, const void* src, size_t count);
+	void byteSwapCopy64(void* dst, const void* src, size_t count);
+
+	template <typename T> void byteSwapCopy(T* dst, const void* src, size_t count) {
+		static_assert(sizeof(T) == 4 || sizeof(T) == 8, "byteSwapCopy handles 32 and 64-bit elements");
+		if constexpr (sizeof(T) == 4) {
+			byteSwapCopy32(dst, src, count);
+		} else {
+			byteSwapCopy64(dst, src, count);
+		}
+	}
+
+	// "avx2", "ssse3" or "scalar" ("none" on a big endian host)
+	const char* byteSwapKernel();
+
+} // namespace nbt
+
+#endif // BYTE_SWAP_HPP
@@ -6,18 +6,28 @@ Compatible with older C++ compilers
 #ifndef NBT_HPP
 #define NBT_HPP
 
+// Container of TagCompound entries, instantiated as NBT_MAP_TYPE<TagString, Tag>. It must be constructible from a
+// polymorphic allocator and offer FlatMap's interface (find/at/operator[] by string_view, appendUnsorted, sortEntries).
 #ifndef NBT_MAP_TYPE
-#include <map>
-#define NBT_MAP_TYPE std::map
+#define NBT_MAP_TYPE ::nbt::FlatMap
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <bit>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
-#include <map>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -54,18 +64,183 @@ namespace std {
 
 namespace nbt {
 
-	// Basic NBT types
-	typedef std::nullptr_t		 TagEnd;
-	typedef std::int8_t			 TagByte;
-	typedef std::int16_t		 TagShort;
-	typedef std::int32_t		 TagInt;
-	typedef std::int64_t		 TagLong;
-	typedef float				 TagFloat;
-	typedef double				 TagDouble;
-	typedef std::string			 TagString;
-	typedef std::vector<TagByte> TagByteArray;
-	typedef std::vector<TagInt>	 TagIntArray;
-	typedef std::vector<TagLong> TagLongArray;
+	// Memory of one parsed document: the nodes, keys, strings and arrays of the tree are bump-allocated from it and
+	// released in one go. Lists and compounds made by make() are ordinary shared_ptrs whose control block lives on
+	// the arena and holds a reference to it: the arena deletes itself with its last node, so a node copied out of
+	// the tree keeps the document alive and the tree never owns its own arena. Copies of strings and arrays land on
+	// the heap; moving one out of the tree keeps it on the arena.
+	class Arena final : public std::pmr::memory_resource {
+	  private:
+		struct alignas(std::max_align_t) Block {
+			Block* next;
+		};
+
+		// Allocates the control block of a node and counts it as a reference to the arena
+		template <typename T> struct NodeAllocator {
+			using value_type = T;
+
+			Arena* arena;
+
+			explicit NodeAllocator(Arena* owner) noexcept : arena(owner) {}
+			template <typename U> NodeAllocator(const NodeAllocator<U>& other) noexcept : arena(other.arena) {}
+
+			T* allocate(size_t count) {
+				T* memory = static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+				arena->_nodes.fetch_add(1, std::memory_order_relaxed);
+				return memory;
+			}
+			void deallocate(T*, size_t) noexcept { arena->releaseNode(); }
+
+			template <typename U> bool operator==(const NodeAllocator<U>& other) const noexcept { return arena == other.arena; }
+		};
+
+		Block*				_blocks;
+		std::byte*			_cursor;
+		std::byte*			_end;
+		size_t				_growth; // size of the blocks after the first one
+		std::atomic<size_t> _nodes;
+
+		void addBlock(size_t size) {
+			Block* block = static_cast<Block*>(::operator new(sizeof(Block) + size));
+			block->next	 = _blocks;
+			_blocks		 = block;
+			_cursor		 = reinterpret_cast<std::byte*>(block + 1);
+			_end		 = _cursor + size;
+		}
+
+		void releaseNode() noexcept {
+			if (_nodes.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+		}
+
+		void* do_allocate(size_t bytes, size_t alignment) override {
+			auto aligned = [this, alignment]() { return (reinterpret_cast<std::uintptr_t>(_cursor) + alignment - 1) & ~(alignment - 1); };
+			if (aligned() + bytes > reinterpret_cast<std::uintptr_t>(_end)) addBlock(std::max(_growth, bytes + alignment));
+			std::byte* memory = reinterpret_cast<std::byte*>(aligned());
+			_cursor			  = memory + bytes;
+			return memory;
+		}
+		// Released with the arena
+		void do_deallocate(void*, size_t, size_t) override {}
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+	  public:
+		// Create it with new and make() its first node straight away: from then on the nodes own it.
+		// `initialSize` is the first block, later ones take `growth` bytes.
+		Arena(size_t initialSize, size_t growth)
+			: _blocks(nullptr), _cursor(nullptr), _end(nullptr), _growth(std::max<size_t>(growth, 256)), _nodes(0) {
+			addBlock(std::max<size_t>(initialSize, 256));
+		}
+		~Arena() {
+			while (_blocks) {
+				Block* next = _blocks->next;
+				::operator delete(_blocks);
+				_blocks = next;
+			}
+		}
+
+		Arena(const Arena&)			   = delete;
+		Arena& operator=(const Arena&) = delete;
+
+		// A T (TagList or TagCompound) built on the arena's allocator
+		template <typename T> std::shared_ptr<T> make() { return std::allocate_shared<T>(NodeAllocator<T>(this), typename T::allocator_type(this)); }
+	};
+
+	// Sorted vector of (key, value): one allocation per compound instead of one node per key, and lookups are a
+	// binary search over contiguous entries. Built in bulk by the parser (appendUnsorted, then sortEntries once).
+	template <typename Key, typename Value> class FlatMap {
+	  public:
+		using value_type	 = std::pair<Key, Value>;
+		using allocator_type = std::pmr::polymorphic_allocator<value_type>;
+		using iterator		 = typename std::pmr::vector<value_type>::iterator;
+		using const_iterator = typename std::pmr::vector<value_type>::const_iterator;
+
+	  private:
+		std::pmr::vector<value_type> _entries;
+
+		static bool keyLess(const value_type& entry, std::string_view key) { return std::string_view(entry.first) < key; }
+
+	  public:
+		FlatMap() = default;
+		explicit FlatMap(const allocator_type& alloc) : _entries(alloc) {}
+		FlatMap(const FlatMap& other, const allocator_type& alloc) : _entries(other._entries, alloc) {}
+
+		iterator find(std::string_view key) {
+			auto it = std::lower_bound(_entries.begin(), _entries.end(), key, keyLess);
+			return it != _entries.end() && std::string_view(it->first) == key ? it : _entries.end();
+		}
+		const_iterator find(std::string_view key) const {
+			auto it = std::lower_bound(_entries.begin(), _entries.end(), key, keyLess);
+			return it != _entries.end() && std::string_view(it->first) == key ? it : _entries.end();
+		}
+
+		Value& at(std::string_view key) {
+			auto it = find(key);
+			if (it == _entries.end()) throw std::out_of_range("nbt::FlatMap::at: no key " + std::string(key));
+			return it->second;
+		}
+		const Value& at(std::string_view key) const {
+			auto it = find(key);
+			if (it == _entries.end()) throw std::out_of_range("nbt::FlatMap::at: no key " + std::string(key));
+			return it->second;
+		}
+
+		// Inserts a default Value when missing, like std::map
+		Value& operator[](std::string_view key) {
+			auto it = std::lower_bound(_entries.begin(), _entries.end(), key, keyLess);
+			if (it == _entries.end() || std::string_view(it->first) != key) it = _entries.emplace(it, key, Value());
+			return it->second;
+		}
+
+		size_t erase(std::string_view key) {
+			auto it = find(key);
+			if (it == _entries.end()) return 0;
+			_entries.erase(it);
+			return 1;
+		}
+
+		void appendUnsorted(Key&& key, Value&& value) { _entries.emplace_back(std::move(key), std::move(value)); }
+		// Sorts what appendUnsorted() added; on duplicate keys the last one appended wins
+		void sortEntries() {
+			auto less = [](const value_type& a, const value_type& b) { return a.first < b.first; };
+			// Compounds are small: insertion sort is stable too and, unlike stable_sort, needs no scratch buffer
+			if (_entries.size() <= 32) {
+				for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+					for (auto hole = it; hole != _entries.begin() && less(*hole, *std::prev(hole)); --hole) std::iter_swap(hole, std::prev(hole));
+				}
+			} else {
+				std::stable_sort(_entries.begin(), _entries.end(), less);
+			}
+			auto out = _entries.begin();
+			for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+				if (std::next(it) != _entries.end() && std::next(it)->first == it->first) continue;
+				if (out != it) *out = std::move(*it);
+				++out;
+			}
+			_entries.erase(out, _entries.end());
+		}
+
+		void   reserve(size_t size) { _entries.reserve(size); }
+		size_t size() const { return _entries.size(); }
+		bool   empty() const { return _entries.empty(); }
+
+		iterator	   begin() { return _entries.begin(); }
+		iterator	   end() { return _entries.end(); }
+		const_iterator begin() const { return _entries.begin(); }
+		const_iterator end() const { return _entries.end(); }
+	};
+
+	// Basic NBT types. Strings and arrays take the allocator of their document (the heap when built by hand).
+	typedef std::nullptr_t				TagEnd;
+	typedef std::int8_t					TagByte;
+	typedef std::int16_t				TagShort;
+	typedef std::int32_t				TagInt;
+	typedef std::int64_t				TagLong;
+	typedef float						TagFloat;
+	typedef double						TagDouble;
+	typedef std::pmr::string			TagString;
+	typedef std::pmr::vector<TagByte>	TagByteArray;
+	typedef std::pmr::vector<TagInt>	TagIntArray;
+	typedef std::pmr::vector<TagLong>	TagLongArray;
 
 	// Forward declaration for recursive types
 	struct Tag;
@@ -92,11 +267,26 @@ namespace nbt {
 		// Constructors
 		Tag() : data(TagEnd{}) {}
 
-		template <typename T> Tag(const T& value) : data(value) {}
+		// Values are moved in as is: a TagString or array keeps the allocator (arena) it was built with
+		template <typename T>
+			requires(!std::is_same_v<std::remove_cvref_t<T>, Tag> &&
+					 (std::is_same_v<std::remove_cvref_t<T>, TagString> || !std::is_convertible_v<T, std::string_view>))
+		Tag(T&& value) : data(std::forward<T>(value)) {}
+
+		// std::string, literals: copied to a heap TagString
+		Tag(std::string_view value) : data(TagString(value)) {}
 
 		// Assignment operators
-		template <typename T> Tag& operator=(const T& value) {
-			data = value;
+		template <typename T>
+			requires(!std::is_same_v<std::remove_cvref_t<T>, Tag> &&
+					 (std::is_same_v<std::remove_cvref_t<T>, TagString> || !std::is_convertible_v<T, std::string_view>))
+		Tag& operator=(T&& value) {
+			data = std::forward<T>(value);
+			return *this;
+		}
+
+		Tag& operator=(std::string_view value) {
+			data = TagString(value);
 			return *this;
 		}
 
@@ -105,17 +295,18 @@ namespace nbt {
 
 		template <typename T> const T& get() const { return std::get<T>(data); }
 
-		void encode(std::ostream& os) const {
-			// Simplified encoding - just write placeholder data
-			(void)os; // Suppress unused parameter warning
-		}
+		// Nameless (network format) binary NBT, see nbt::Writer
+		void encode(std::ostream& os) const;
 	};
 
 	// TagList implementation
 	struct TagList {
-		std::vector<Tag> data;
+		using allocator_type = std::pmr::polymorphic_allocator<Tag>;
+
+		std::pmr::vector<Tag> data;
 
 		TagList() = default;
+		explicit TagList(const allocator_type& alloc) : data(alloc) {}
 
 		template <typename T> TagList(const std::vector<T>& vec) {
 			for (const auto& item : vec) {
@@ -124,6 +315,7 @@ namespace nbt {
 		}
 
 		void push_back(const Tag& tag) { data.push_back(tag); }
+		void push_back(Tag&& tag) { data.push_back(std::move(tag)); }
 
 		size_t size() const { return data.size(); }
 
@@ -131,23 +323,24 @@ namespace nbt {
 
 		const Tag& operator[](size_t index) const { return data[index]; }
 
-		void encode(std::ostream& os) const {
-			// Simplified encoding
-			(void)os; // Suppress unused parameter warning
-		}
+		void encode(std::ostream& os) const; // nameless, see nbt::Writer
 	};
 
 	// TagCompound implementation
 	struct TagCompound {
-		std::map<std::string, Tag> data;
+		using Map			 = NBT_MAP_TYPE<TagString, Tag>;
+		using allocator_type = typename Map::allocator_type;
+
+		Map data;
 
 		TagCompound() = default;
+		explicit TagCompound(const allocator_type& alloc) : data(alloc) {}
 
-		Tag& operator[](const std::string& key) { return data[key]; }
+		Tag& operator[](std::string_view key) { return data[key]; }
 
-		const Tag& at(const std::string& key) const { return data.at(key); }
+		const Tag& at(std::string_view key) const { return data.at(key); }
 
-		bool contains(const std::string& key) const { return data.find(key) != data.end(); }
+		bool contains(std::string_view key) const { return data.find(key) != data.end(); }
 
 		size_t size() const { return data.size(); }
 
@@ -156,10 +349,7 @@ namespace nbt {
 		auto begin() const { return data.begin(); }
 		auto end() const { return data.end(); }
 
-		void encode(std::ostream& os) const {
-			// Simplified encoding
-			(void)os; // Suppress unused parameter warning
-		}
+		void encode(std::ostream& os) const; // nameless, see nbt::Writer
 	};
 
 	// Helper functions for creating tags
@@ -169,26 +359,68 @@ namespace nbt {
 	inline TagLong	 createLong(std::int64_t value) { return value; }
 	inline TagFloat	 createFloat(float value) { return value; }
 	inline TagDouble createDouble(double value) { return value; }
-	inline TagString createString(const std::string& value) { return value; }
+	inline TagString createString(const std::string& value) { return TagString(value); }
+
+	// Heap copy of a compound and of every list and compound below it
+	inline std::shared_ptr<TagCompound> deepCopy(const TagCompound& compound);
+
+	inline std::shared_ptr<TagList> deepCopy(const TagList& list) {
+		auto copy = std::make_shared<TagList>(list);
+		for (Tag& tag : copy->data) {
+			if (auto* child = std::get_if<std::shared_ptr<TagCompound>>(&tag.data); child && *child) *child = deepCopy(**child);
+			if (auto* child = std::get_if<std::shared_ptr<TagList>>(&tag.data); child && *child) *child = deepCopy(**child);
+		}
+		return copy;
+	}
+
+	inline std::shared_ptr<TagCompound> deepCopy(const TagCompound& compound) {
+		auto copy = std::make_shared<TagCompound>(compound);
+		for (auto& entry : *copy) {
+			Tag& tag = entry.second;
+			if (auto* child = std::get_if<std::shared_ptr<TagCompound>>(&tag.data); child && *child) *child = deepCopy(**child);
+			if (auto* child = std::get_if<std::shared_ptr<TagList>>(&tag.data); child && *child) *child = deepCopy(**child);
+		}
+		return copy;
+	}
 
 	// Utility class for NBT data
 	class NBT {
 	  private:
-		std::string name;
-		TagCompound root;
+		std::string					 name;
+		std::shared_ptr<TagCompound> root; // on the document arena when parsed, and then keeps the arena alive; null once moved from
+
+		TagCompound& checkedRoot() const {
+			if (!root) throw std::runtime_error("NBT: document was moved from");
+			return *root;
+		}
 
 	  public:
-		NBT() = default;
-		NBT(const std::string& name) : name(name) {}
-		NBT(const std::string& name, const TagCompound& tags) : name(name), root(tags) {}
+		NBT() : name(), root(std::make_shared<TagCompound>()) {}
+		NBT(const std::string& name) : name(name), root(std::make_shared<TagCompound>()) {}
+		// `tags` may belong to a parsed tree, its lists and compounds are copied too
+		NBT(const std::string& name, const TagCompound& tags) : name(name), root(deepCopy(tags)) {}
+		// Takes a root built on an Arena (what Parser returns), moving this NBT never copies the tree
+		NBT(const std::string& name, std::shared_ptr<TagCompound> tags) : name(name), root(std::move(tags)) {}
+
+		// Copies are deep and land on the heap: they outlive the arena of a parsed source
+		NBT(const NBT& other) : name(other.name), root(deepCopy(other.checkedRoot())) {}
+		NBT& operator=(const NBT& other) {
+			name = other.name;
+			root = deepCopy(other.checkedRoot());
+			return *this;
+		}
+		NBT(NBT&&) noexcept			   = default;
+		NBT& operator=(NBT&&) noexcept = default;
 
 		void		setName(const std::string& n) { name = n; }
 		std::string getName() const { return name; }
 
-		TagCompound&	   getRoot() { return root; }
-		const TagCompound& getRoot() const { return root; }
+		// Throw std::runtime_error on a moved-from NBT
+		TagCompound&	   getRoot() { return checkedRoot(); }
+		const TagCompound& getRoot() const { return checkedRoot(); }
 
-		void encode(std::ostream& os) const { root.encode(os); }
+		// Named document, as stored on disk (uncompressed)
+		void encode(std::ostream& os) const;
 
 		void decode(std::istream& is) {
 			// Simplified decoding
@@ -5,28 +5,40 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace nbt {
 
 	// NBT binary parser for Minecraft's Named Binary Tag format.
-	// This class parses a binary NBT buffer into the simplified NBT model in lib/nbt.hpp.
+	// This class parses a binary NBT buffer into the simplified NBT model in lib/nbt.hpp. Each document gets its
+	// own Arena: the whole tree (nodes, keys, strings, arrays) is allocated from it and freed with its last node.
+	// The parser keeps no state between calls, one instance can parse on several threads at once.
+	// Read-only consumers of large documents (chunks) should use nbt::View, which builds no tree at all.
 	class Parser {
 	  public:
 		Parser() = default;
 
 		// Parse an NBT payload (binary) into an NBT object.
 		// Expects the data to start with a root tag type and name.
-		NBT parse(const std::vector<uint8_t>& data);
+		NBT parse(const std::vector<uint8_t>& data) const;
 
 	  private:
+		// State of one parse()
+		struct Document {
+			Arena&								   arena;
+			std::vector<std::pair<TagString, Tag>> pending; // entries of the open compounds, innermost last
+		};
+
 		// Helper utilities for decoding the binary stream (big-endian).
-		template <typename T> T read(const std::vector<uint8_t>& data, size_t& cursor);
-		std::string				parseTagName(const std::vector<uint8_t>& data, size_t& cursor);
-		TagCompound				parseCompound(const std::vector<uint8_t>& data, size_t& cursor);
-		TagList					parseList(const std::vector<uint8_t>& data, size_t& cursor);
-		Tag						parseTag(const std::vector<uint8_t>& data, size_t& cursor, uint8_t tagType);
+		template <typename T> T read(const std::vector<uint8_t>& data, size_t& cursor) const;
+		TagString				parseTagName(Document& document, const std::vector<uint8_t>& data, size_t& cursor) const;
+		void					parseCompound(Document& document, const std::vector<uint8_t>& data, size_t& cursor, TagCompound& compound) const;
+		void					parseList(Document& document, const std::vector<uint8_t>& data, size_t& cursor, TagList& list) const;
+		Tag						parseTag(Document& document, const std::vector<uint8_t>& data, size_t& cursor, uint8_t tagType) const;
+		void					need(const std::vector<uint8_t>& data, size_t cursor, size_t bytes) const;
 	};
 
 } // namespace nbt
@@ -0,0 +1,172 @@
+#ifndef NBT_VIEW_HPP
+#define NBT_VIEW_HPP
+
+#include "lib/byteSwap.hpp"
+#include "lib/nbt.hpp" // std::byteswap fallback
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace nbt {
+
+	class View;
+
+	// Big-endian numeric array living in the NBT buffer, elements are swapped when read
+	template <typename T> class BigEndianArray {
+	  private:
+		std::span<const uint8_t> _bytes;
+
+	  public:
+		BigEndianArray() = default;
+		explicit BigEndianArray(std::span<const uint8_t> bytes) : _bytes(bytes) {}
+
+		size_t					 size() const { return _bytes.size() / sizeof(T); }
+		bool					 empty() const { return _bytes.empty(); }
+		std::span<const uint8_t> bytes() const { return _bytes; }
+
+		T operator[](size_t index) const {
+			T value;
+			std::memcpy(&value, _bytes.data() + index * sizeof(T), sizeof(T));
+			if constexpr (std::endian::native == std::endian::little) value = std::byteswap(value);
+			return value;
+		}
+
+		// Host order copy into `out` (size() elements, no alignment requirement)
+		void copyTo(void* out) const { byteSwapCopy(static_cast<T*>(out), _bytes.data(), size()); }
+	};
+
+	// Handle to one tag of a View, cheap to copy. An invalid handle (missing key, out of range index) answers
+	// isValid() false, contains() false and size() 0; the typed accessors throw std::runtime_error on a type mismatch.
+	class TagView {
+	  private:
+		const View* _view  = nullptr;
+		uint32_t	_index = 0;
+
+		friend class View;
+		TagView(const View* view, uint32_t index) : _view(view), _index(index) {}
+
+		const uint8_t* payload(uint8_t expectedType) const;
+
+	  public:
+		TagView() = default;
+
+		bool			 isValid() const { return _view != nullptr; }
+		uint8_t			 getType() const;
+		std::string_view getName() const;
+
+		int8_t			 asByte() const;
+		int16_t			 asShort() const;
+		int32_t			 asInt() const;
+		int64_t			 asLong() const;
+		float			 asFloat() const;
+		double			 asDouble() const;
+		std::string_view asString() const;
+
+		std::span<const int8_t>	 asByteArray() const;
+		BigEndianArray<int32_t>	 asIntArray() const;
+		BigEndianArray<int64_t>	 asLongArray() const;
+
+		// Compounds: child by name
+		TagView operator[](std::string_view name) const;
+		bool	contains(std::string_view name) const { return (*this)[name].isValid(); }
+
+		// Lists: element by position, and the type of the elements
+		TagView at(size_t index) const;
+		uint8_t getElementType() const;
+
+		// Children of a compound or elements of a list, arrays count as 0
+		size_t size() const;
+
+		// Payload bytes as stored in the document, without the tag header (for a compound: its children and the
+		// closing TAG_END). Equal payloads give equal bytes, which makes them usable as cache keys.
+		std::span<const uint8_t> getRawPayload() const;
+
+		class Iterator {
+		  private:
+			const View* _view;
+			uint32_t	_index;
+
+		  public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type		= TagView;
+			using difference_type	= std::ptrdiff_t;
+
+			Iterator(const View* view, uint32_t index) : _view(view), _index(index) {}
+
+			TagView	  operator*() const { return TagView(_view, _index); }
+			Iterator& operator++();
+			bool	  operator==(const Iterator& other) const { return _index == other._index; }
+			bool	  operator!=(const Iterator& other) const { return _index != other._index; }
+		};
+
+		Iterator begin() const;
+		Iterator end() const;
+	};
+
+	// Read-only view of a binary NBT document that never copies its payloads.
+	// The constructor walks the buffer once and records, per tag, where its name and payload are; arrays are
+	// skipped over, not indexed. Accessors then return spans and string_views into the buffer and swap numbers
+	// only when they are read. The buffer must outlive the View and every TagView or span taken from it.
+	class View {
+	  public:
+		static constexpr uint8_t TAG_END		= 0;
+		static constexpr uint8_t TAG_BYTE		= 1;
+		static constexpr uint8_t TAG_SHORT		= 2;
+		static constexpr uint8_t TAG_INT		= 3;
+		static constexpr uint8_t TAG_LONG		= 4;
+		static constexpr uint8_t TAG_FLOAT		= 5;
+		static constexpr uint8_t TAG_DOUBLE		= 6;
+		static constexpr uint8_t TAG_BYTE_ARRAY = 7;
+		static constexpr uint8_t TAG_STRING		= 8;
+		static constexpr uint8_t TAG_LIST		= 9;
+		static constexpr uint8_t TAG_COMPOUND	= 10;
+		static constexpr uint8_t TAG_INT_ARRAY	= 11;
+		static constexpr uint8_t TAG_LONG_ARRAY = 12;
+
+		// Same bound as vanilla, deeper documents are rejected instead of overflowing the stack
+		static constexpr int MAX_DEPTH = 512;
+
+	  private:
+		static constexpr uint32_t NONE = UINT32_MAX;
+
+		struct Node {
+			uint32_t nameOffset;
+			uint32_t payload;	  // offset of the payload in the buffer
+			uint32_t length;	  // elements of a list or array, bytes of a string, children of a compound
+			uint32_t firstChild;  // compounds and lists
+			uint32_t nextSibling; // next entry of the parent compound or list
+			uint16_t nameLength;
+			uint8_t	 type;
+			uint8_t	 elementType; // lists
+		};
+
+		std::span<const uint8_t> _data;
+		std::vector<Node>		 _nodes;
+
+		friend class TagView;
+
+		uint32_t addNode(uint8_t type, size_t nameOffset, uint16_t nameLength);
+		void	 indexPayload(uint32_t node, size_t& cursor, int depth);
+		void	 need(size_t cursor, size_t bytes) const;
+		size_t	 payloadEnd(uint32_t node) const;
+
+	  public:
+		// Throws std::runtime_error on malformed or truncated data, or when the root is not a compound
+		explicit View(std::span<const uint8_t> data);
+
+		View(const View&)			 = delete;
+		View& operator=(const View&) = delete;
+
+		TagView getRoot() const { return TagView(this, 0); }
+		size_t	getTagCount() const { return _nodes.size(); }
+	};
+
+} // namespace nbt
+
+#endif // NBT_VIEW_HPP
@@ -0,0 +1,140 @@
+#ifndef NBT_WRITER_HPP
+#define NBT_WRITER_HPP
+
+#include "lib/nbt.hpp"
+#include "lib/nbtView.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <vector>
+
+class Buffer;
+
+namespace nbt {
+
+	// Streaming encoder for binary NBT: every tag goes to the output as soon as it is written, no tree is built.
+	//
+	//   nbt::Writer out(buffer, nbt::Writer::Format::Network);
+	//   out.beginCompound();                                  // root
+	//   out.writeLongArray("MOTION_BLOCKING", heights);
+	//   out.beginList("Items", nbt::Writer::TAG_COMPOUND, items.size());
+	//   for (...) { out.beginCompound(); out.writeString("id", id); out.endCompound(); }
+	//   out.endList();
+	//   out.endCompound();
+	//   out.finish();
+	//
+	// Values inside a compound take a name, list elements and network roots do not. Lists announce their element
+	// type and count up front. Misuse (a name on a list element, a wrong element type or count, a tag left open
+	// at finish()) throws std::runtime_error. Existing trees are written with writeTag()/writeCompound().
+	class Writer {
+	  public:
+		enum class Format {
+			Disk,	 // root named, u16 length + name (level.dat, region chunks, player data)
+			Network, // root without a name, as sent since 1.20.2
+		};
+
+		static constexpr uint8_t TAG_END		= 0;
+		static constexpr uint8_t TAG_BYTE		= 1;
+		static constexpr uint8_t TAG_SHORT		= 2;
+		static constexpr uint8_t TAG_INT		= 3;
+		static constexpr uint8_t TAG_LONG		= 4;
+		static constexpr uint8_t TAG_FLOAT		= 5;
+		static constexpr uint8_t TAG_DOUBLE		= 6;
+		static constexpr uint8_t TAG_BYTE_ARRAY = 7;
+		static constexpr uint8_t TAG_STRING		= 8;
+		static constexpr uint8_t TAG_LIST		= 9;
+		static constexpr uint8_t TAG_COMPOUND	= 10;
+		static constexpr uint8_t TAG_INT_ARRAY	= 11;
+		static constexpr uint8_t TAG_LONG_ARRAY = 12;
+
+		static constexpr size_t MAX_DEPTH = 512; // same bound as the readers
+
+	  private:
+		// Stream sinks are written through this buffer in blocks of about this size
+		static constexpr size_t STREAM_BLOCK = 64 * 1024;
+
+		struct Frame {
+			uint8_t type;		 // TAG_COMPOUND or TAG_LIST
+			uint8_t elementType; // lists
+			int32_t remaining;	 // lists: elements still to write
+		};
+
+		std::pmr::vector<uint8_t>* _out;
+		std::ostream*			   _stream;
+		std::pmr::vector<uint8_t>  _staging; // stream sinks only
+		Format					   _format;
+		std::vector<Frame>		   _stack;
+		bool					   _rootWritten;
+
+		void header(uint8_t type, std::string_view name);
+		void pushFrame(uint8_t type, uint8_t elementType, int32_t count);
+		void popFrame(uint8_t type);
+		void putName(std::string_view name);
+		void putString(std::string_view value);
+		void putPayload(const Tag& tag);
+		void putCompound(const TagCompound& compound);
+		void putList(const TagList& list);
+		void flush();
+		void flushIfFull();
+
+		template <typename T> void put(T value);
+		template <typename T> void putArray(std::span<const T> values);
+		void					   putBytes(const void* data, size_t size);
+
+	  public:
+		// Appends to the buffer's data
+		Writer(Buffer& out, Format format);
+		// Buffered, written to `out` in blocks and on finish()/destruction
+		Writer(std::ostream& out, Format format);
+		~Writer();
+
+		Writer(const Writer&)			 = delete;
+		Writer& operator=(const Writer&) = delete;
+
+		void beginCompound(std::string_view name = {});
+		void endCompound();
+		// `count` elements of `elementType` must follow (TAG_END is allowed for an empty list)
+		void beginList(std::string_view name, uint8_t elementType, size_t count);
+		void beginList(uint8_t elementType, size_t count) { beginList({}, elementType, count); }
+		void endList();
+
+		void writeByte(std::string_view name, int8_t value);
+		void writeShort(std::string_view name, int16_t value);
+		void writeInt(std::string_view name, int32_t value);
+		void writeLong(std::string_view name, int64_t value);
+		void writeFloat(std::string_view name, float value);
+		void writeDouble(std::string_view name, double value);
+		void writeString(std::string_view name, std::string_view value);
+		void writeByteArray(std::string_view name, std::span<const int8_t> values);
+		void writeIntArray(std::string_view name, std::span<const int32_t> values);
+		void writeLongArray(std::string_view name, std::span<const int64_t> values);
+		// Arrays read from an nbt::View are already big endian: copied as is
+		void writeIntArray(std::string_view name, const BigEndianArray<int32_t>& values);
+		void writeLongArray(std::string_view name, const BigEndianArray<int64_t>& values);
+
+		// List elements
+		void writeByte(int8_t value) { writeByte({}, value); }
+		void writeShort(int16_t value) { writeShort({}, value); }
+		void writeInt(int32_t value) { writeInt({}, value); }
+		void writeLong(int64_t value) { writeLong({}, value); }
+		void writeFloat(float value) { writeFloat({}, value); }
+		void writeDouble(double value) { writeDouble({}, value); }
+		void writeString(std::string_view value) { writeString({}, value); }
+
+		// Whole trees
+		void writeTag(std::string_view name, const Tag& tag);
+		void writeTag(const Tag& tag) { writeTag({}, tag); }
+		void writeCompound(std::string_view name, const TagCompound& compound);
+		void writeList(std::string_view name, const TagList& list);
+
+		// Checks that every tag was closed and flushes a stream sink
+		void finish();
+	};
+
+} // namespace nbt
+
+#endif // NBT_WRITER_HPP
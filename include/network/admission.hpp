@@ -0,0 +1,97 @@
+#ifndef ADMISSION_HPP
+#define ADMISSION_HPP
+
+#include "../player.hpp"
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class NetworkManager;
+class Packet;
+
+// Login admission: every joining connection takes one of the `max-players` seats at Login Start, and at most
+// `maxConcurrent` of them run Login/Configuration at the same time. The others wait in FIFO order, before any
+// configuration work is done for them, and get their queue position every QUEUE_UPDATE_INTERVAL as a
+// Login Plugin Request (which also keeps the client's read timeout from firing).
+class AdmissionController {
+  public:
+	enum class Seat { Admitted, Queued, ServerFull };
+
+	static constexpr size_t		 DEFAULT_MAX_CONCURRENT = 8;
+	static constexpr auto		 QUEUE_UPDATE_INTERVAL	= std::chrono::seconds(5);
+	static constexpr const char* QUEUE_CHANNEL			= "mc-server:queue";
+
+  private:
+	enum class Phase { Queued, Configuring, Playing };
+
+	struct Entry {
+		Phase					phase;
+		ConnectionToken			connection;
+		std::unique_ptr<Packet> route; // template for the queue position updates
+		std::coroutine_handle<> waiter;
+	};
+
+	// A parked login sequence and the strand it resumes on
+	using Waiter = std::pair<ConnectionToken, std::coroutine_handle<>>;
+
+	NetworkManager&				   _network;
+	size_t						   _maxPlayers;
+	size_t						   _maxConcurrent;
+	std::mutex					   _lock;
+	std::unordered_map<int, Entry> _entries; // by player id
+	std::deque<int>				   _queue;
+	size_t						   _configuring;
+	uint32_t					   _messageId;
+
+	// Hands free configuration slots to the head of the queue, returns the sequences to resume
+	std::vector<Waiter> promoteLocked();
+	void				resumeAll(const std::vector<Waiter>& waiters);
+
+  public:
+	AdmissionController(NetworkManager& network, size_t maxPlayers, size_t maxConcurrent = DEFAULT_MAX_CONCURRENT);
+	~AdmissionController();
+
+	AdmissionController(const AdmissionController&)			   = delete;
+	AdmissionController& operator=(const AdmissionController&) = delete;
+
+	// Called at Login Start, `route` is the packet used to reach the connection while it waits
+	Seat reserve(Player& player, const Packet& route);
+
+	// The player reached Play: its configuration slot goes to the next in line, the seat stays taken
+	void finishConfiguration(const Player& player);
+
+	// The connection is gone (Player destructor): frees everything it held
+	void release(int playerId);
+
+	// Sends every queued connection its current position, called by the admission thread
+	void broadcastQueuePositions();
+
+	size_t getQueueLength();
+
+	// co_await admission.waitForTurn(player): returns once the player holds a configuration slot
+	class Awaiter {
+	  private:
+		AdmissionController& _controller;
+		int					 _playerId;
+		ConnectionToken		 _connection;
+
+	  public:
+		Awaiter(AdmissionController& controller, Player& player);
+
+		bool await_ready();
+		bool await_suspend(std::coroutine_handle<> handle);
+		void await_resume() const;
+	};
+
+	Awaiter waitForTurn(Player& player) { return Awaiter(*this, player); }
+};
+
+#endif
@@ -6,18 +6,25 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+namespace nbt {
+	struct Tag;
+}
+
 class Buffer {
   private:
-	std::vector<uint8_t> _data;
-	size_t				 _pos;
+	std::pmr::vector<uint8_t> _data;
+	size_t					  _pos;
 
   public:
 	Buffer();
 	explicit Buffer(const std::vector<uint8_t>& data);
+	// Allocates from the given resource (e.g. ScratchArena::current()); copies of it use the heap.
+	explicit Buffer(std::pmr::memory_resource* resource);
 
 	int	 readVarInt();
 	void writeVarInt(int value);
@@ -50,25 +57,29 @@ class Buffer {
 	// Boolean reading methods
 	bool readBool();
 
-	std::vector<uint8_t>& getData();
-	size_t				  remaining() const;
-	uint16_t			  readUShort();
-	void				  writeUShort(uint16_t value);
-	uint64_t			  readUInt64();
-	long				  readLong();
-	int32_t				  readInt();
-	void				  writeLong(long value);
-	uint8_t				  readByte();
-	void				  writeByte(uint8_t byte);
-	void				  writeBytes(const std::string& data);
-	void				  writeBytes(const std::vector<uint8_t>& data);
-	void				  writeUUID(const UUID& uuid);
+	std::pmr::vector<uint8_t>& getData();
+	size_t					   remaining() const;
+	void					   reserve(size_t capacity);
+	uint16_t				   readUShort();
+	void					   writeUShort(uint16_t value);
+	uint64_t				   readUInt64();
+	long					   readLong();
+	int32_t					   readInt();
+	void					   writeLong(long value);
+	uint8_t					   readByte();
+	void					   writeByte(uint8_t byte);
+	void					   writeBytes(const std::string& data);
+	void					   writeBytes(const std::vector<uint8_t>& data);
+	void					   writeBytes(const std::pmr::vector<uint8_t>& data);
+	void					   writeBytes(const uint8_t* data, size_t size);
+	void					   writeUUID(const UUID& uuid);
 
 	void	writeBool(bool value);
-	void	writeNBT(const std::string& nbtData);
+	void	writeNBT(const nbt::Tag& tag); // network format: type id + payload, no root name
 	void	writePosition(int32_t x, int32_t y, int32_t z);
 	void	writeFloat(float value);
 	void	writeDouble(double value);
+	double	readDouble();
 	void	writeIdentifier(const std::string& id);
 	void	writeVarLong(int64_t value);
 	int64_t readVarLong();
@@ -0,0 +1,92 @@
+#ifndef CHUNK_VIEW_HPP
+#define CHUNK_VIEW_HPP
+
+#include "../world/chunkCache.hpp"
+#include "../world/chunkLoader.hpp"
+#include "packet.hpp"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class Server;
+
+// Chunks the client of one player holds: the (2r + 1)^2 square around the chunk the player stands in, r being the
+// view distance the client asked for in Client Information, capped by the server one (config "view-distance").
+// Every change of center or radius is a diff of the old and new squares: Set Center Chunk, Forget Level Chunk for
+// the chunks leaving the view, then one chunk batch with the chunks entering it, requested from the chunk loader
+// closest first (spiral order). Walking into the next chunk costs 2r + 1 forgets and 2r + 1 chunks.
+// Loader callbacks keep the view alive; a chunk that left the view while it was loading is dropped, not sent.
+class ChunkView : public std::enable_shared_from_this<ChunkView> {
+  public:
+	struct Offset {
+		int dx, dz;
+	};
+
+	static constexpr int MIN_VIEW_DISTANCE = 2;
+	static constexpr int MAX_VIEW_DISTANCE = 32;
+
+  private:
+	// Chunks of one update still loading, Chunk Batch Finished goes out with the last one
+	struct Batch {
+		Packet route;
+		int	   pending;
+		int	   sent;
+
+		explicit Batch(const Packet& packet) : route(packet), pending(0), sent(0) {}
+	};
+
+	struct Loading {
+		World::ChunkTicket	   ticket; // invalid until request() returned
+		std::shared_ptr<Batch> batch;
+	};
+
+	using ChunkSet	 = std::unordered_set<World::ChunkKey, World::ChunkKeyHash>;
+	using LoadingMap = std::unordered_map<World::ChunkKey, Loading, World::ChunkKeyHash>;
+
+	std::mutex _lock; // also orders the frames of the view: a chunk is never forgotten before it was sent
+	bool	   _started;
+	bool	   _closed;
+	int		   _centerX;
+	int		   _centerZ;
+	int		   _radius;
+	uint64_t   _lastMove; // sequence of the newest position applied, older ones handled late are dropped
+	ChunkSet   _sent;	  // chunks the client holds
+	LoadingMap _loading;  // requested, not sent yet
+
+	// Moves the view to the square of `radius` around the chunk. Called with `lock` held, returns with it released:
+	// the loader calls back inline for cached chunks.
+	void update(std::unique_lock<std::mutex>& lock, const Packet& route, Server& server, int centerX, int centerZ, int radius);
+	void chunkLoaded(Server& server, const std::shared_ptr<Batch>& batch, const World::ChunkKey& key, World::ChunkCache::ChunkRef chunk);
+	// Chunk Batch Finished of a batch whose last chunk was answered, `_lock` held
+	void finishBatch(Server& server, Batch& batch);
+
+  public:
+	ChunkView();
+
+	ChunkView(const ChunkView&)			   = delete;
+	ChunkView& operator=(const ChunkView&) = delete;
+
+	// View distance of a client asking for `requested` chunks: MIN_VIEW_DISTANCE..min(serverMax, MAX_VIEW_DISTANCE)
+	static int getViewDistance(int requested, int serverMax);
+	// Every offset of the square of MAX_VIEW_DISTANCE, closest to the center first and turning around it at equal
+	// distance. A smaller square is the offsets of this order that fall inside it.
+	static const std::vector<Offset>& spiralOrder();
+
+	// The spawn batch put the square of `sentRadius` around the chunk on the client: records it, then streams the rest
+	// of the view (or forgets what the view does not cover)
+	void start(const Packet& route, Server& server, int centerX, int centerZ, int sentRadius);
+	// Block position from Set Player Position; nothing is sent while the player stays in the same chunk and the view
+	// distance did not change. Ignored before start(), and when a position the client sent later (route sequence)
+	// was already applied: position packets are handled in parallel.
+	void moveTo(const Packet& route, Server& server, double x, double z);
+	// The player left: pending loads are cancelled and later callbacks dropped
+	void close(World::ChunkLoader& loader);
+
+	bool contains(int chunkX, int chunkZ);
+	int	 getRadius();
+};
+
+#endif
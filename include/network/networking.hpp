@@ -3,19 +3,27 @@
 
 #include "../lib/UUID.hpp"
 #include "../player.hpp"
+#include "admission.hpp"
 #include "packet.hpp"
+#include "spawn_preload.hpp"
+#include "task.hpp"
 
 // Forward declaration to avoid circular dependency
 class Server;
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <coroutine>
 #include <cstddef>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <sys/types.h>
 #include <thread>
 #include <unistd.h>
+#include <unordered_map>
 #include <vector>
 
 template <typename T> class ThreadSafeQueue {
@@ -65,28 +73,58 @@ template <typename T> class ThreadSafeQueue {
 	}
 };
 
+// Unit of work for the worker pool: a received packet to route, or a suspended connection sequence to resume.
+// An empty job is the shutdown sentinel.
+struct WorkerJob {
+	Packet*							  packet = nullptr;
+	std::coroutine_handle<>			  resume = nullptr;
+	std::shared_ptr<ConnectionStrand> strand; // the connection `resume` runs on
+};
+
 class NetworkManager {
   private:
-	ThreadSafeQueue<Packet*> _incomingPackets;
-	ThreadSafeQueue<Packet*> _outgoingPackets;
+	// Frames of a connection whose socket buffer is full, finished once epoll reports the socket writable again so
+	// a client that stops reading only holds up its own frames
+	struct SendQueue {
+		std::deque<Packet*>					  frames;
+		size_t								  sent;		// bytes of the front frame already written
+		ino_t								  socket;	// identity of the socket: a closed descriptor number gets reused
+		std::chrono::steady_clock::time_point progress; // last time any byte went out
+	};
+
+	ThreadSafeQueue<WorkerJob>			   _workerJobs;
+	ThreadSafeQueue<Packet*>			   _outgoingPackets;
+	ThreadSafeQueue<std::function<void()>> _blockingJobs;
 
 	std::vector<std::thread> _workerThreads;
+	std::vector<std::thread> _blockingThreads;
 	std::atomic<bool>		 _shutdownFlag;
 	std::thread				 _receiverThread;
 	std::thread				 _senderThread;
+	std::thread				 _admissionThread;
 	char					 _receiverThreadInit;
 	char					 _senderThreadInit;
 	Server&					 _server;
+	AdmissionController		 _admission;
 	int						 _epollFd;
 	int						 _serverSocket;
 
+	std::unordered_map<int, SendQueue> _sendQueues;	 // sender thread only, by socket
+	int								   _sendEpollFd; // sockets with a SendQueue, waited for EPOLLOUT
+
   public:
+	// Threads that run offloaded slow work (disk reads, chunk loads) for connection sequences
+	static constexpr size_t BLOCKING_THREAD_COUNT = 2;
+
 	NetworkManager(size_t  worker_count,
 				   Server& s); // Could use std::thread::hardware_concurrency() for the worker size;
 	~NetworkManager() {
 		if (_epollFd != -1) {
 			close(_epollFd);
 		}
+		if (_sendEpollFd != -1) {
+			close(_sendEpollFd);
+		}
 	}
 
 	void start();
@@ -98,16 +136,35 @@ class NetworkManager {
 	void					  removePlayerConnection(UUID id);
 	ThreadSafeQueue<Packet*>* getOutgoingQueue() { return &_outgoingPackets; }
 
-	Server& getServer() { return _server; }
+	Server&				 getServer() { return _server; }
+	AdmissionController& getAdmission() { return _admission; }
 
 	void enqueueOutgoingPacket(Packet* p);
 
+	// Connection sequences: resume on the worker pool, on the strand of their connection / run slow work (disk,
+	// chunk loads) off it
+	void resumeOnStrand(std::shared_ptr<ConnectionStrand> strand, std::coroutine_handle<> handle) {
+		_workerJobs.push(WorkerJob{nullptr, handle, std::move(strand)});
+	}
+	void runBlocking(std::function<void()> job) { _blockingJobs.push(std::move(job)); }
+
   private:
 	void receiverThreadLoop();
 	void senderThreadLoop();
 	void workerThreadLoop();
+	void blockingThreadLoop();
+	void admissionThreadLoop();
 
 	void setupEpoll();
+	// Sender thread: writes a frame, or queues it behind the ones still waiting for its socket
+	void sendFrame(Packet* p);
+	// Sender thread: writes what a socket reported writable takes of its queued frames
+	void drainSendQueue(int socket);
+	// Sender thread: a frame went out completely
+	void frameSent(Packet* p);
+	// Sender thread: drops the connection and the frames still queued for it
+	void sendFailed(int socket, int error);
+	void dropSendQueue(int socket);
 	void handleIncomingData(Player* connection);
 	void handleIncomingData(int socket);
 };
@@ -118,21 +175,35 @@ void handleStatusPacket(Packet& packet, Server& server);
 void handlePingPacket(Packet& packet, Server& server);
 void handleClientInformation(Packet& packet, Server& server);
 void handleLoginStartPacket(Packet& packet, Server& server);
+void writeLoginSuccess(Packet& packet, Player& player);
+void writeLoginDisconnect(Packet& packet, const std::string& reason);
 void handleLoginAcknowledged(Packet& packet, Server& server);
 void handleCookieRequest(Packet& packet, Server& server);
 void handleFinishConfiguration(Packet& packet, Server& server);
 void handleAcknowledgeFinishConfiguration(Packet& packet, Server& server);
 void writePlayPacket(Packet& packet, Server& server);
 void writeSetCenterPacket(Packet& packet, Server& server);
+void writeSetCenterFrame(Buffer& out, int chunkX, int chunkZ);
+void writeForgetLevelChunkFrame(Buffer& out, int chunkX, int chunkZ);
 
 // Chunk batch functions
 void sendChunkBatchStart(Packet& packet, Server& server);
 void sendChunkBatchFinished(Packet& packet, Server& server, int batchSize);
-void sendChunkBatchSequence(Packet& packet, Server& server);
+// Starts the chunk view of the player once its spawn batch is queued, streaming what the batch did not cover
+void sendChunkBatchSequence(Packet& packet, Server& server, const SpawnPreload& spawnArea);
+// Append one complete frame (length, id, payload) to `out`
+void writeChunkBatchStartFrame(Buffer& out);
+void writeChunkBatchFinishedFrame(Buffer& out, int batchSize);
 
 // Chunk data functions
 void sendChunkData(Packet& packet, Server& server, int chunkX, int chunkZ);
-void sendPlayerPositionAndLook(Packet& packet, Server& server);
+// Chunk Data and Update Light frame of a chunk, encoded on the first send of each chunk version and shared by every
+// later one; nullptr when the chunk cannot be encoded
+std::shared_ptr<const std::vector<uint8_t>> getChunkDataFrame(const World::ChunkData& chunkData);
+// Appends the cached frame, false (nothing written) when the chunk cannot be encoded
+bool writeChunkDataFrame(Buffer& out, const World::ChunkData& chunkData);
+bool writeChunkDataFrame(Buffer& out, Server& server, int chunkX, int chunkZ);
+void sendPlayerPositionAndLook(Packet& packet, Server& server, const SpawnPoint& spawn);
 void sendSpawnPosition(Packet& packet, Server& server);
 
 // Spawn sequence functions
@@ -142,16 +213,28 @@ void sendSetExperience(Packet& packet, Server& server);
 void sendUpdateTime(Packet& packet, Server& server);
 void sendSetHeldItem(Packet& packet, Server& server);
 void handleConfirmTeleportation(Packet& packet, Server& server);
+void handleSetPlayerPosition(Packet& packet, Server& server);
 void completeSpawnSequence(Packet& packet, Server& server);
 void sendDisconnectPacket(Packet* packet, const std::string& reason, Server& server);
 
-Buffer generateEmptyChunkSections();
-void   writeLightData(Buffer& buf, const World::ChunkData& chunkData);
-void   writeActualLightData(Buffer& buf, const World::ChunkData& chunkData);
-void   writeEmptyLightData(Buffer& buf);
+// Login Success once admitted, started at Login Start
+Task runLoginSequence(Packet packet, Server& server);
+// Configuration -> Play sequence, started once the client sent its known packs
+Task runConfigurationSequence(Packet packet, Server& server, bool clientHasCorePack);
+
+// Constant Chunk Data fragments, built once: the length-prefixed sections of a chunk without any, and the light
+// data of a chunk under open sky
+const std::vector<uint8_t>& emptyChunkSections();
+const std::vector<uint8_t>& fullBrightLightData();
+// Length-prefixed Chunk Data sections of a decoded chunk, all air when it has none
+void writeChunkSections(Buffer& buf, const World::ChunkData& chunkData);
+void writeLightData(Buffer& buf, const World::ChunkData& chunkData);
+void writeActualLightData(Buffer& buf, const World::ChunkData& chunkData);
+void writeEmptyLightData(Buffer& buf);
 
 void clientboundKnownPacks(Packet& packet);
-void serverboundKnownPacks(Packet& packet);
+// Returns the packs the client reported
+std::vector<Buffer::KnownPack> serverboundKnownPacks(Packet& packet);
 
 void gameEventPacket(Packet& packet, Server& server);
 void levelChunkWithLight(Packet& packet, Server& server);
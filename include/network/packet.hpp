@@ -7,22 +7,28 @@
 #include "server.hpp"
 
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
 enum PacketResult { PACKET_OK = 0, PACKET_SEND = 1, PACKET_DISCONNECT = 2, PACKET_ERROR = -1 };
 
 class Packet {
   private:
-	int32_t _size;
-	int32_t _id;
-	Buffer	_data;
-	Player* _player;
-	int		_socketFd;
-	int		_returnPacket;
+	int32_t										_size;
+	int32_t										_id;
+	Buffer										_data;
+	Player*										_player;
+	int											_socketFd;
+	int											_returnPacket;
+	std::shared_ptr<const std::vector<uint8_t>> _shared;
+	uint64_t									_sequence; // Player::nextPacketSequence() when read from a player, 0 otherwise
 
   public:
 	Packet(Player* player);
 	Packet(int socketFd, Server& server);
+	// Outgoing packet to the same connection as `route`, sending `payload` (complete frames) as is
+	Packet(const Packet& route, std::shared_ptr<const std::vector<uint8_t>> payload);
 	Packet(const Packet& other);
 	Packet& operator=(const Packet& other);
 	~Packet();
@@ -35,7 +41,10 @@ class Packet {
 	uint32_t	getSize();
 	uint32_t	getId();
 	Buffer&		getData();
+	// Bytes handed to send(): the shared payload when there is one, the packet's own buffer otherwise
+	const uint8_t* getWireData();
 	int			getSocket() const;
+	uint64_t	getSequence() const;
 	void		setReturnPacket(int value);
 	int			getReturnPacket();
 	int			getVarintSize(int32_t value);
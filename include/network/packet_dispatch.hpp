@@ -0,0 +1,34 @@
+#ifndef PACKET_DISPATCH_HPP
+#define PACKET_DISPATCH_HPP
+
+#include "../player.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+class Packet;
+class Server;
+
+// Scheduling class of a serverbound packet, coarsest first.
+// Control packets keep the connection alive (keep alive, acks, teleport confirm),
+// Movement is the high rate position stream, Bulk carries large client payloads.
+// Worker jobs are still taken in arrival order: packets of one connection must not overtake each other.
+enum class PacketPriority : uint8_t { Control, Movement, Normal, Bulk };
+
+using PacketHandler = void (*)(Packet* packet, Server& server);
+
+struct PacketRoute {
+	PacketHandler  handler;
+	uint32_t	   maxSize; // packet length (id + payload) above which the client is dropped
+	bool		   allowed;
+	PacketPriority priority;
+};
+
+constexpr size_t PLAYER_STATE_COUNT = static_cast<size_t>(PlayerState::Play) + 1;
+// Every serverbound id of protocol 770 fits below this bound
+constexpr size_t PACKET_ID_COUNT = 0x80;
+
+// O(1) lookup in the (state, id) table; unknown ids return a route with allowed == false
+const PacketRoute& lookupPacketRoute(PlayerState state, uint32_t id);
+
+#endif
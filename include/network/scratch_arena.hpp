@@ -0,0 +1,58 @@
+#ifndef SCRATCH_ARENA_HPP
+#define SCRATCH_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+// Monotonic scratch memory owned by a worker thread.
+// Handlers build their temporary Buffers/containers from ScratchArena::current(); the worker
+// calls reset() once the packet has been routed, so nothing allocated here may outlive that.
+// Copying a scratch Buffer into a Packet's Buffer lands the bytes in the packet's own storage.
+class ScratchArena {
+  private:
+	// Upstream of the monotonic resource: records how much spilled past the inline block so the
+	// next reset can grow it and keep the steady state free of malloc/free.
+	class OverflowResource : public std::pmr::memory_resource {
+	  private:
+		size_t _spilled;
+
+	  public:
+		OverflowResource() : _spilled(0) {}
+		size_t spilled() const { return _spilled; }
+		void   clear() { _spilled = 0; }
+
+	  private:
+		void* do_allocate(size_t bytes, size_t alignment) override;
+		void  do_deallocate(void* p, size_t bytes, size_t alignment) override;
+		bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+	};
+
+	std::unique_ptr<std::byte[]>					   _storage;
+	size_t											   _capacity;
+	OverflowResource								   _upstream;
+	std::optional<std::pmr::monotonic_buffer_resource> _resource;
+	ScratchArena*									   _previous;
+
+  public:
+	static constexpr size_t DEFAULT_CAPACITY = 256 * 1024;
+	static constexpr size_t MAX_CAPACITY	 = 16 * 1024 * 1024;
+
+	explicit ScratchArena(size_t capacity = DEFAULT_CAPACITY);
+	~ScratchArena();
+
+	ScratchArena(const ScratchArena&)			 = delete;
+	ScratchArena& operator=(const ScratchArena&) = delete;
+
+	std::pmr::memory_resource* resource() { return &*_resource; }
+	size_t					   capacity() const { return _capacity; }
+
+	// Drop everything allocated since the last reset.
+	void reset();
+
+	// Arena installed on the calling thread, or the default heap resource when there is none.
+	static std::pmr::memory_resource* current();
+};
+
+#endif
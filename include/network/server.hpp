@@ -3,7 +3,9 @@
 
 class NetworkManager;
 #include "../config.hpp"
+#include "../data/ConfigurationCache.hpp"
 #include "../player.hpp"
+#include "../world/chunkLoader.hpp"
 #include "../world/world.hpp"
 #include "id_manager.hpp"
 #include "lib/json.hpp"
@@ -28,6 +30,8 @@ class Server {
 	World::Manager					 _worldManager;
 	World::LevelDat					 _worldData;
 	World::Query					 _worldQuery;
+	World::ChunkLoader				 _chunkLoader;
+	ConfigurationCache				 _configurationCache;
 
   public:
 	Server();
@@ -51,10 +55,13 @@ class Server {
 	json	   getPlayerSample();
 	IdManager& getIdManager() { return (_idManager); }
 
-	NetworkManager&	 getNetworkManager() { return *_networkManager; }
-	World::Manager&	 getWorldManager() { return _worldManager; }
-	World::LevelDat& getWorldData() { return _worldData; }
-	World::Query&	 getWorldQuery() { return _worldQuery; }
+	NetworkManager&		getNetworkManager() { return *_networkManager; }
+	World::Manager&		getWorldManager() { return _worldManager; }
+	World::LevelDat&	getWorldData() { return _worldData; }
+	World::Query&		getWorldQuery() { return _worldQuery; }
+	World::ChunkLoader& getChunkLoader() { return _chunkLoader; }
+
+	const ConfigurationCache& getConfigurationCache() const { return _configurationCache; }
 
 	void printChunkInfo(const World::ChunkData& chunk);
 };
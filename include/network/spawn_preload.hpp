@@ -0,0 +1,90 @@
+#ifndef SPAWN_PRELOAD_HPP
+#define SPAWN_PRELOAD_HPP
+
+#include "../lib/UUID.hpp"
+#include "../player.hpp"
+#include "../world/chunkCache.hpp"
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class Server;
+
+struct SpawnPoint {
+	double x;
+	double y;
+	double z;
+	float  yaw;
+	float  pitch;
+};
+
+// Spawn area of a joining player, prepared while the configuration phase runs.
+// Started from Login Start: reads the saved position from <world>/playerdata/<uuid>.dat (world spawn
+// otherwise) on the blocking pool, requests the chunk ring around it from the chunk loader (closest ring
+// first), then encodes it on the blocking pool once the last chunk arrived. The configuration sequence
+// co_awaits ready() after Acknowledge Finish Configuration and queues the first chunk batch as one shared payload.
+class SpawnPreload {
+  private:
+	std::mutex									_lock;
+	bool										_ready;
+	std::coroutine_handle<>						_waiter;
+	ConnectionToken								_waiterConnection; // strand the waiter resumes on
+	SpawnPoint									_spawn;
+	int											_centerX;
+	int											_centerZ;
+	std::chrono::steady_clock::time_point		_startTime;
+	std::vector<World::ChunkCache::ChunkRef>	_chunks;  // ring order, filled in by the chunk loader
+	size_t										_pending; // chunks still loading
+	size_t										_chunkCount;
+	std::shared_ptr<const std::vector<uint8_t>>	_chunkFrames; // Set Center, Chunk Batch Start, chunks, Chunk Batch Finished
+
+	static void requestChunks(Server& server, const std::shared_ptr<SpawnPreload>& preload);
+	static void chunkLoaded(Server& server, const std::shared_ptr<SpawnPreload>& preload, size_t index, World::ChunkCache::ChunkRef chunk);
+	void		encode(Server& server);
+	void		finish();
+
+  public:
+	// Chebyshev radius of the first batch, (2r + 1)^2 chunks
+	static constexpr int SPAWN_CHUNK_RADIUS = 3;
+
+	SpawnPreload();
+
+	SpawnPreload(const SpawnPreload&)			 = delete;
+	SpawnPreload& operator=(const SpawnPreload&) = delete;
+
+	// Queues the preload on the blocking pool and returns immediately
+	static std::shared_ptr<SpawnPreload> start(Server& server, const UUID& uuid);
+
+	class Awaiter {
+	  private:
+		std::shared_ptr<SpawnPreload> _preload;
+		ConnectionToken				  _connection;
+
+	  public:
+		Awaiter(std::shared_ptr<SpawnPreload> preload, ConnectionToken connection);
+
+		bool await_ready() const;
+		bool await_suspend(std::coroutine_handle<> handle);
+		void await_resume() const;
+	};
+
+	// co_await SpawnPreload::ready(preload, token): resumes on the strand of the connection once the spawn area is encoded
+	static Awaiter ready(std::shared_ptr<SpawnPreload> preload, ConnectionToken connection);
+	// The connection closed (Player destructor): a sequence parked in ready() resumes now and unwinds. Loading goes
+	// on, its jobs own the preload.
+	void close();
+
+	// Only valid once ready() completed
+	const SpawnPoint&								   getSpawnPoint() const { return _spawn; }
+	int												   getCenterX() const { return _centerX; }
+	int												   getCenterZ() const { return _centerZ; }
+	size_t											   getChunkCount() const { return _chunkCount; }
+	const std::shared_ptr<const std::vector<uint8_t>>& getChunkFrames() const { return _chunkFrames; }
+};
+
+#endif
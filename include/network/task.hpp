@@ -0,0 +1,155 @@
+#ifndef TASK_HPP
+#define TASK_HPP
+
+#include "../player.hpp"
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+class NetworkManager;
+
+// Thrown out of a co_await when the connection went away while the sequence was suspended.
+// Task swallows it: the sequence simply ends.
+class ConnectionClosed : public std::runtime_error {
+  public:
+	ConnectionClosed() : std::runtime_error("connection closed") {}
+};
+
+// Connection of a Player as seen by its sequences, shared with them: it outlives the Player.
+// Everything the worker pool does for a connection holds the strand lock: received packets are routed under it
+// (handlers, and the start of a sequence up to its first co_await), and sequences resume through resume(), on the
+// worker pool, one at a time. The Player destructor closes the strand under that same lock, so it waits for a
+// running handler or sequence to finish or suspend, and a sequence resumed afterwards sees isOpen() == false and
+// unwinds: between two co_awaits the Player of a sequence is pinned.
+class ConnectionStrand : public std::enable_shared_from_this<ConnectionStrand> {
+  private:
+	// Client packet a suspended connection sequence is waiting for
+	struct ExpectedPacket {
+		PlayerState				state;
+		uint32_t				id;
+		bool					armed;
+		bool					arrived;
+		std::coroutine_handle<> waiter;
+	};
+
+	NetworkManager&		 _network;
+	std::recursive_mutex _strand; // held while a sequence of the connection runs
+	std::mutex			 _lock;	  // guards _expected
+	std::atomic<bool>	 _open;
+	ExpectedPacket		 _expected;
+
+  public:
+	explicit ConnectionStrand(NetworkManager& network);
+
+	ConnectionStrand(const ConnectionStrand&)			 = delete;
+	ConnectionStrand& operator=(const ConnectionStrand&) = delete;
+
+	bool isOpen() const { return _open.load(); }
+
+	// Queues `handle` on the worker pool, to run on this strand
+	void resume(std::coroutine_handle<> handle);
+	// Worker side of resume()
+	void run(std::coroutine_handle<> handle);
+	// Worker side of a received packet of the connection
+	void route(const std::function<void()>& handler);
+	// The Player is going away: waits for a running sequence to suspend, then wakes up a parked one to unwind
+	void close();
+
+	// ClientPacketAwaiter support, see below
+	void expectPacket(PlayerState state, uint32_t id);
+	bool parkUntilExpectedPacket(std::coroutine_handle<> waiter);
+	void deliverPacket(PlayerState state, uint32_t id);
+};
+
+// Detached coroutine for per-connection sequences (configuration -> play, spawn, ...).
+// It starts running on the worker routing the packet that started it, and after each co_await continues on the
+// worker pool; both on the strand of its connection.
+// Rules for the body:
+//  - do not keep ScratchArena backed Buffers alive across a co_await, the worker resets the arena between jobs
+//  - take the Packet used as template by value, the incoming packet is deleted once routed
+class Task {
+  public:
+	struct promise_type {
+		Task				get_return_object() noexcept { return {}; }
+		std::suspend_never	initial_suspend() noexcept { return {}; }
+		std::suspend_never	final_suspend() noexcept { return {}; }
+		void				return_void() noexcept {}
+		void				unhandled_exception() noexcept;
+	};
+};
+
+// Blocking pool entry point, implemented by NetworkManager
+void runOnBlockingPool(NetworkManager& network, std::function<void()> job);
+
+// co_await offload(network, token, fn): runs fn on the blocking pool (disk reads, chunk loads) and resumes the
+// sequence on its strand with the result. The worker that was running the sequence is free in the meantime.
+template <typename F> class OffloadAwaiter {
+  private:
+	using Result = std::invoke_result_t<F&>;
+	using Stored = std::conditional_t<std::is_void_v<Result>, bool, Result>;
+
+	NetworkManager&		  _network;
+	ConnectionToken		  _connection;
+	F					  _fn;
+	std::optional<Stored> _result;
+	std::exception_ptr	  _error;
+
+  public:
+	OffloadAwaiter(NetworkManager& network, ConnectionToken connection, F fn)
+		: _network(network), _connection(std::move(connection)), _fn(std::move(fn)) {}
+
+	bool await_ready() const noexcept { return false; }
+
+	void await_suspend(std::coroutine_handle<> handle) {
+		runOnBlockingPool(_network, [this, handle]() {
+			try {
+				if constexpr (std::is_void_v<Result>) {
+					_fn();
+					_result.emplace(true);
+				} else {
+					_result.emplace(_fn());
+				}
+			} catch (...) {
+				_error = std::current_exception();
+			}
+			_connection->resume(handle);
+		});
+	}
+
+	Result await_resume() {
+		if (!_connection->isOpen()) throw ConnectionClosed();
+		if (_error) std::rethrow_exception(_error);
+		if constexpr (!std::is_void_v<Result>) return std::move(*_result);
+	}
+};
+
+template <typename F> OffloadAwaiter<std::decay_t<F>> offload(NetworkManager& network, ConnectionToken connection, F&& fn) {
+	return OffloadAwaiter<std::decay_t<F>>(network, std::move(connection), std::forward<F>(fn));
+}
+
+// Suspends the sequence until the client sends packet `id` in `state`.
+// The expectation is registered on construction, so create the awaiter before queuing the packet the
+// client answers to: an answer routed before the co_await is not lost. The expectation lives on the strand, not
+// on the Player: parking never touches a Player that may be going away.
+class ClientPacketAwaiter {
+  private:
+	ConnectionToken _connection;
+
+  public:
+	ClientPacketAwaiter(Player& player, PlayerState state, uint32_t id);
+
+	bool await_ready() const;
+	bool await_suspend(std::coroutine_handle<> handle);
+	void await_resume() const;
+};
+
+#endif
@@ -4,11 +4,19 @@
 #include "lib/UUID.hpp"
 
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
+class ChunkView;
+class ConnectionStrand;
 class Server;
+class SpawnPreload;
 
 enum class PlayerState { None, Configuration, Handshake, Status, Login, Play };
 
+// Shared with suspended connection sequences, closed once the Player is destroyed (see network/task.hpp)
+using ConnectionToken = std::shared_ptr<ConnectionStrand>;
+
 class PlayerConfig {
   private:
 	int			_chatMode;
@@ -47,15 +55,19 @@ class PlayerConfig {
 
 class Player {
   private:
-	std::string	  _name;
-	PlayerState	  _state;
-	int			  _socketFd;
-	int			  x, y, z;
-	int			  health;
-	UUID		  _uuid;
-	int			  _playerId;
-	Server&		  _server;
-	PlayerConfig* _config;
+	std::string					  _name;
+	PlayerState					  _state;
+	int							  _socketFd;
+	int							  x, y, z;
+	int							  health;
+	UUID						  _uuid;
+	int							  _playerId;
+	Server&						  _server;
+	PlayerConfig*				  _config;
+	ConnectionToken				  _connection;
+	std::shared_ptr<SpawnPreload> _spawnPreload;
+	std::shared_ptr<ChunkView>	  _chunkView;
+	uint64_t					  _packetsRead; // receiver thread only
 
   public:
 	Player(Server& server);
@@ -74,6 +86,23 @@ class Player {
 	PlayerConfig* getPlayerConfig() { return _config; }
 	int			  getPlayerID() const;
 	void		  setUUID(UUID uuid);
+	UUID		  getUUID() const { return _uuid; }
+
+	// Connection sequence support (see network/task.hpp)
+	ConnectionToken getConnectionToken() const { return _connection; }
+	// A client packet a connection sequence may be waiting for was routed
+	void deliverPacket(PlayerState state, uint32_t id);
+
+	// Spawn area loading since Login Start (see network/spawn_preload.hpp)
+	void								 setSpawnPreload(std::shared_ptr<SpawnPreload> preload) { _spawnPreload = std::move(preload); }
+	const std::shared_ptr<SpawnPreload>& getSpawnPreload() const { return _spawnPreload; }
+
+	// Arrival order of the packets read from the connection, 1 for the first one. Workers may handle them in any
+	// order; handlers that must not go back in time compare it (see ChunkView::moveTo).
+	uint64_t nextPacketSequence() { return ++_packetsRead; }
+
+	// Chunks the client holds (see network/chunk_view.hpp)
+	const std::shared_ptr<ChunkView>& getChunkView() const { return _chunkView; }
 };
 
 #endif
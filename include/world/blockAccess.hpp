@@ -0,0 +1,154 @@
+#ifndef WORLD_BLOCK_ACCESS_HPP
+#define WORLD_BLOCK_ACCESS_HPP
+
+#include "chunkCache.hpp"
+#include "palettedContainer.hpp"
+#include "world.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace World {
+
+	// Inclusive block-coordinate box
+	struct BlockBox {
+		int minX, minY, minZ;
+		int maxX, maxY, maxZ;
+	};
+
+	// Random access to blocks and biomes of the decoded chunks in the chunk cache, in world coordinates.
+	// A read is a coordinate -> section lookup plus one palette index read. The chunk last used stays pinned, so
+	// reads that stay in one chunk skip the cache entirely: keep an accessor for one task (a tick of physics, a
+	// lighting pass) rather than holding it, and never share it between threads.
+	// Chunks missing on disk read as air and the default biome, positions outside MIN_Y..MAX_Y as air.
+	//
+	// The box kernels walk each section in storage order (y, then z, then x) and handle a single valued section
+	// in one step; positions outside the build height are not visited.
+	class BlockAccess {
+	  private:
+		Query&				 _query;
+		Dimension			 _dimension;
+		ChunkCache::ChunkRef _chunk;
+
+		// Air sections stand in for chunks without sections
+		static const ChunkSection& emptySection();
+
+		// The accessor's pinned chunk, replaced by the next lookup of another chunk: copy the ref to keep it longer
+		const ChunkCache::ChunkRef& chunkAt(int chunkX, int chunkZ);
+		const ChunkSection&			sectionAt(int x, int y, int z);
+
+		// fn(section, world origin of the section, local box) for every section the box overlaps, clipped to the
+		// build height; stops when fn returns false
+		template <typename Fn> bool forEachSection(const BlockBox& box, Fn&& fn) {
+			int minY = std::max(box.minY, MIN_Y);
+			int maxY = std::min(box.maxY, MAX_Y);
+			if (box.minX > box.maxX || box.minZ > box.maxZ || minY > maxY) return true;
+
+			for (int chunkX = box.minX >> 4; chunkX <= box.maxX >> 4; chunkX++) {
+				for (int chunkZ = box.minZ >> 4; chunkZ <= box.maxZ >> 4; chunkZ++) {
+					// Pinned here: fn may read other chunks through this accessor
+					ChunkCache::ChunkRef pin   = chunkAt(chunkX, chunkZ);
+					const ChunkData&	 chunk = *pin;
+					for (int sectionY = minY >> 4; sectionY <= maxY >> 4; sectionY++) {
+						const ChunkSection& section =
+								chunk.isEmpty() ? emptySection() : chunk.sections[static_cast<size_t>(sectionY - MIN_SECTION_Y)];
+						int		 originX = chunkX * 16;
+						int		 originY = sectionY * 16;
+						int		 originZ = chunkZ * 16;
+						BlockBox local{std::max(box.minX - originX, 0), std::max(minY - originY, 0), std::max(box.minZ - originZ, 0),
+									   std::min(box.maxX - originX, 15), std::min(maxY - originY, 15), std::min(box.maxZ - originZ, 15)};
+						if (!fn(section, originX, originY, originZ, local)) return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		static size_t volume(const BlockBox& local) {
+			return static_cast<size_t>(local.maxX - local.minX + 1) * (local.maxY - local.minY + 1) * (local.maxZ - local.minZ + 1);
+		}
+
+	  public:
+		explicit BlockAccess(Query& query, Dimension dimension = Dimension::Overworld);
+
+		// Global block state id
+		uint32_t getBlock(int x, int y, int z);
+		// Biome network id of the 4x4x4 cell holding the block
+		uint32_t getBiome(int x, int y, int z);
+		// World y above the highest block of the column counting for `type` (any non-air block by default), MIN_Y
+		// when there is none: one heightmap read
+		int getHeight(int x, int z, Heightmaps::Type type = Heightmaps::Type::WorldSurface);
+
+		// fn(x, y, z, state) for every block of the box
+		template <typename Fn> void forEachBlock(const BlockBox& box, Fn&& fn) {
+			forEachSection(box, [&](const ChunkSection& section, int originX, int originY, int originZ, const BlockBox& local) {
+				for (int y = local.minY; y <= local.maxY; y++) {
+					for (int z = local.minZ; z <= local.maxZ; z++) {
+						size_t row = ChunkSection::blockIndex(0, y, z);
+						section.blocks.forEach(row + local.minX, row + local.maxX + 1, [&](size_t entry, uint32_t state) {
+							fn(originX + static_cast<int>(entry - row), originY + y, originZ + z, state);
+						});
+					}
+				}
+				return true;
+			});
+		}
+
+		// Number of blocks of the box whose state matches. `match` runs once for a single valued section and once
+		// per palette entry for an indirect one.
+		template <typename Pred> size_t countBlocks(const BlockBox& box, Pred&& match) {
+			size_t				 count = 0;
+			std::vector<uint8_t> matches;
+			forEachSection(box, [&](const ChunkSection& section, int, int, int, const BlockBox& local) {
+				const PalettedContainer& blocks = section.blocks;
+				if (blocks.getMode() == PalettedContainer::Mode::Single) {
+					if (match(blocks.get(0))) count += volume(local);
+					return true;
+				}
+
+				bool indirect = blocks.getMode() == PalettedContainer::Mode::Indirect;
+				if (indirect) {
+					matches.clear();
+					for (uint32_t state : blocks.getPalette()) matches.push_back(match(state) ? 1 : 0);
+					if (std::find(matches.begin(), matches.end(), 1) == matches.end()) return true;
+				}
+				for (int y = local.minY; y <= local.maxY; y++) {
+					for (int z = local.minZ; z <= local.maxZ; z++) {
+						size_t row = ChunkSection::blockIndex(0, y, z);
+						for (int x = local.minX; x <= local.maxX; x++) {
+							count += indirect ? matches[blocks.getPaletteIndex(row + x)] : match(blocks.get(row + x));
+						}
+					}
+				}
+				return true;
+			});
+			return count;
+		}
+
+		// Whether any block of the box matches, stopping at the first one (collision tests)
+		template <typename Pred> bool anyBlock(const BlockBox& box, Pred&& match) {
+			return !forEachSection(box, [&](const ChunkSection& section, int, int, int, const BlockBox& local) {
+				const PalettedContainer& blocks = section.blocks;
+				if (blocks.getMode() == PalettedContainer::Mode::Single) return !match(blocks.get(0));
+
+				if (blocks.getMode() == PalettedContainer::Mode::Indirect &&
+					std::none_of(blocks.getPalette().begin(), blocks.getPalette().end(), [&](uint32_t state) { return match(state); }))
+					return true;
+				for (int y = local.minY; y <= local.maxY; y++) {
+					for (int z = local.minZ; z <= local.maxZ; z++) {
+						size_t row = ChunkSection::blockIndex(0, y, z);
+						for (int x = local.minX; x <= local.maxX; x++) {
+							if (match(blocks.get(row + x))) return false;
+						}
+					}
+				}
+				return true;
+			});
+		}
+	};
+
+} // namespace World
+
+#endif
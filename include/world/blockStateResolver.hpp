@@ -0,0 +1,52 @@
+#ifndef WORLD_BLOCK_STATE_RESOLVER_HPP
+#define WORLD_BLOCK_STATE_RESOLVER_HPP
+
+#include "lib/nbtView.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace World {
+
+	// Section palette entry ({Name, Properties} compound) -> global block state id, through the generated
+	// BlockStates table. Neighbouring sections repeat the same palettes, so results are cached per thread in a
+	// direct-mapped table keyed on the raw bytes of the entry: a hit costs one hash and one compare of ~30-80 bytes.
+	// Not thread-safe by design, always go through local().
+	class BlockStateResolver {
+	  private:
+		struct Slot {
+			std::string key; // raw payload of the entry, empty when unused
+			uint32_t	state;
+		};
+
+		std::array<Slot, 256> _slots;
+		size_t				  _hits;
+		size_t				  _misses;
+
+		BlockStateResolver();
+
+	  public:
+		// Sent for blocks the table does not know, logged once per cached entry
+		static constexpr uint32_t FALLBACK_STATE = 1; // minecraft:stone
+
+		BlockStateResolver(const BlockStateResolver&)			 = delete;
+		BlockStateResolver& operator=(const BlockStateResolver&) = delete;
+
+		static BlockStateResolver& local();
+
+		uint32_t resolve(const nbt::TagView& entry);
+
+		// Uncached lookup; cave_air and void_air fall back to air when the table lacks them
+		static uint32_t lookup(const nbt::TagView& entry);
+		// air, cave_air and void_air
+		static bool isAir(uint32_t state);
+
+		size_t getHits() const { return _hits; }
+		size_t getMisses() const { return _misses; }
+	};
+
+} // namespace World
+
+#endif
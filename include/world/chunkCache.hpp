@@ -0,0 +1,116 @@
+#ifndef WORLD_CHUNK_CACHE_HPP
+#define WORLD_CHUNK_CACHE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace World {
+
+	struct ChunkData;
+
+	enum class Dimension : int32_t { Overworld = 0, Nether = -1, End = 1 };
+
+	struct ChunkKey {
+		Dimension dimension;
+		int32_t	  x;
+		int32_t	  z;
+
+		bool operator==(const ChunkKey& other) const { return dimension == other.dimension && x == other.x && z == other.z; }
+	};
+
+	struct ChunkKeyHash {
+		size_t operator()(const ChunkKey& key) const {
+			uint64_t h = (static_cast<uint64_t>(static_cast<uint32_t>(key.x)) << 32) | static_cast<uint32_t>(key.z);
+			h ^= static_cast<uint64_t>(static_cast<int64_t>(key.dimension)) * 0x9E3779B97F4A7C15ull;
+			h ^= h >> 31;
+			h *= 0xBF58476D1CE4E5B9ull;
+			h ^= h >> 29;
+			return static_cast<size_t>(h);
+		}
+	};
+
+	// Decoded chunks shared by every reader, bounded by a byte budget.
+	// Lock-striped: a key only ever touches its own shard. Each shard evicts with CLOCK (second chance) until it is
+	// back under its share of the budget. A ChunkRef pins its entry: pinned entries are never evicted, so the
+	// budget can be exceeded for as long as readers hold them.
+	class ChunkCache {
+	  public:
+		using ChunkRef = std::shared_ptr<const ChunkData>;
+		// Writers only, they change the chunk with ChunkData::lock held exclusively
+		using MutableChunkRef = std::shared_ptr<ChunkData>;
+
+		struct Stats {
+			uint64_t hits;
+			uint64_t misses;
+			uint64_t evictions;
+			size_t	 entries;
+			size_t	 bytes;
+
+			double hitRate() const { return hits + misses ? static_cast<double>(hits) / static_cast<double>(hits + misses) : 0.0; }
+		};
+
+		static constexpr size_t SHARD_COUNT	   = 16;
+		static constexpr size_t DEFAULT_BUDGET = 256ull * 1024 * 1024;
+
+	  private:
+		struct Slot {
+			ChunkKey		key;
+			MutableChunkRef chunk; // null when the slot is free
+			size_t			bytes;
+			bool			referenced;
+		};
+
+		struct Shard {
+			std::mutex											lock;
+			std::unordered_map<ChunkKey, size_t, ChunkKeyHash>	index; // key -> slot
+			std::vector<Slot>									slots;
+			std::vector<size_t>									freeSlots;
+			size_t												hand  = 0;
+			size_t												bytes = 0;
+		};
+
+		std::array<Shard, SHARD_COUNT> _shards;
+		std::atomic<size_t>			   _shardBudget;
+		std::atomic<uint64_t>		   _hits;
+		std::atomic<uint64_t>		   _misses;
+		std::atomic<uint64_t>		   _evictions;
+
+		Shard& shardFor(const ChunkKey& key) { return _shards[ChunkKeyHash()(key) % SHARD_COUNT]; }
+		void   evictLocked(Shard& shard);
+
+	  public:
+		explicit ChunkCache(size_t budgetBytes = DEFAULT_BUDGET);
+
+		ChunkCache(const ChunkCache&)			 = delete;
+		ChunkCache& operator=(const ChunkCache&) = delete;
+
+		void setBudget(size_t budgetBytes);
+
+		// Cached chunk or nullptr, counts a hit or a miss
+		ChunkRef find(const ChunkKey& key);
+		// find() for a writer, the chunk is pinned the same way
+		MutableChunkRef findMutable(const ChunkKey& key);
+		// Caches `chunk` unless another thread got there first, returns the cached one either way
+		ChunkRef insert(const ChunkKey& key, ChunkData&& chunk);
+		// find(), then load() and insert() on a miss. load runs without any lock held.
+		ChunkRef getOrLoad(const ChunkKey& key, const std::function<ChunkData()>& load);
+		// Drop a chunk that changed on disk; current holders keep their copy
+		void erase(const ChunkKey& key);
+
+		Stats getStats();
+
+		// Approximate heap footprint of a decoded chunk, with the encoded packet it will hold once sent
+		static size_t footprint(const ChunkData& chunk);
+	};
+
+} // namespace World
+
+#endif
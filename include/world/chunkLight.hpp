@@ -0,0 +1,94 @@
+#ifndef WORLD_CHUNK_LIGHT_HPP
+#define WORLD_CHUNK_LIGHT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class Buffer;
+
+namespace World {
+
+	// Light sections: one below and one above the block sections (overworld: section y -5..20)
+	constexpr int LIGHT_SECTION_COUNT = 24 + 2;
+	constexpr int MIN_LIGHT_SECTION_Y = -4 - 1;
+
+	// Light levels (0..15) of a 16x16x16 section, two per byte with the even entry in the low nibble, indexed like
+	// the block states ((y * 16 + z) * 16 + x). A section where every entry holds the same level (open sky, solid
+	// rock, no block light) stores only that level: most of a chunk never allocates its 2048 bytes.
+	class NibbleArray {
+	  private:
+		std::vector<uint8_t> _data; // SIZE bytes, empty while uniform
+		uint8_t				 _fill;
+
+	  public:
+		static constexpr size_t SIZE = 2048;
+
+		explicit NibbleArray(uint8_t fill = 0) : _data(), _fill(fill) {}
+
+		uint8_t get(size_t index) const {
+			if (_data.empty()) return _fill;
+			return (_data[index >> 1] >> ((index & 1) << 2)) & 0x0F;
+		}
+
+		void set(size_t index, uint8_t level) {
+			if (_data.empty()) {
+				if (level == _fill) return;
+				_data.assign(SIZE, static_cast<uint8_t>(_fill * 0x11));
+			}
+			uint8_t& byte  = _data[index >> 1];
+			int		 shift = (index & 1) << 2;
+			byte		   = static_cast<uint8_t>((byte & ~(0x0F << shift)) | (level << shift));
+		}
+
+		// Every entry set to `level`, the storage is released
+		void fill(uint8_t level);
+		// Copies a stored SkyLight / BlockLight array, kept uniform when it is. Throws std::runtime_error when it is
+		// not SIZE bytes.
+		void assign(std::span<const uint8_t> bytes);
+		// Packs one level per byte (4096 entries)
+		void pack(const uint8_t* levels);
+		// Unpacks to one level per byte (4096 entries)
+		void unpack(uint8_t* levels) const;
+
+		bool	isUniform() const { return _data.empty(); }
+		uint8_t getFill() const { return _fill; }
+
+		// The 2048 bytes as sent and stored, uniform arrays expanded
+		std::span<const uint8_t> bytes() const;
+
+		size_t memoryUsage() const { return _data.capacity(); }
+	};
+
+	// Sky and block light of a chunk, one NibbleArray per light section. A new chunk is lit as open sky: full sky
+	// light, no block light.
+	struct ChunkLight {
+		std::array<NibbleArray, LIGHT_SECTION_COUNT> sky;
+		std::array<NibbleArray, LIGHT_SECTION_COUNT> block;
+
+		ChunkLight();
+
+		// World y -> light section index, -1 outside the light sections
+		static int sectionIndex(int y) {
+			int index = (y >> 4) - MIN_LIGHT_SECTION_Y;
+			return index >= 0 && index < LIGHT_SECTION_COUNT ? index : -1;
+		}
+
+		// Sections of the stored chunk lacking a SkyLight array (bit i: light section i) are filled like vanilla
+		// reads them: each column continues with the bottom level of the closest stored section above, 15 when
+		// there is none.
+		void fillMissingSky(uint32_t storedMask);
+
+		// Light masks and arrays of the Chunk Data / Update Light packets. Sections uniformly dark go in the empty
+		// masks without an array, every other section is sent.
+		void   encode(Buffer& out) const;
+		size_t networkSize() const;
+
+		size_t memoryUsage() const;
+	};
+
+} // namespace World
+
+#endif
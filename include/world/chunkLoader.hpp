@@ -0,0 +1,109 @@
+#ifndef WORLD_CHUNK_LOADER_HPP
+#define WORLD_CHUNK_LOADER_HPP
+
+#include "chunkCache.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace World {
+
+	class Query;
+
+	// Identifies one requester of a chunk, used to cancel it
+	struct ChunkTicket {
+		ChunkKey key;
+		uint64_t id = 0;
+
+		bool isValid() const { return id != 0; }
+	};
+
+	// Loads chunks (region read, inflate, NBT decode) on its own I/O threads so network workers never touch the disk.
+	// Pending requests are served closest first: the priority of a chunk is the smallest distance any of its
+	// requesters gave. Requests for a chunk already pending or loading are coalesced into one load, and a chunk
+	// whose requesters all cancelled is dropped before it is read.
+	// Callbacks run on an I/O thread (or inline when the chunk is already cached) and must not block. They get a null
+	// ChunkRef only when the load itself failed or the loader stopped (a missing chunk is an empty ChunkData, not an
+	// error): every request is answered exactly once, or cancelled.
+	class ChunkLoader {
+	  public:
+		using Callback = std::function<void(ChunkCache::ChunkRef)>;
+
+		static constexpr size_t DEFAULT_THREAD_COUNT = 2;
+
+	  private:
+		struct Waiter {
+			uint64_t id;
+			Callback callback;
+		};
+
+		struct Request {
+			uint32_t			priority;
+			bool				loading;
+			std::vector<Waiter> waiters;
+		};
+
+		// Heap entries are not updated in place: a stale one (priority raised since, or request gone) is skipped
+		struct QueueEntry {
+			uint32_t priority;
+			uint64_t sequence;
+			ChunkKey key;
+
+			bool operator>(const QueueEntry& other) const {
+				return priority != other.priority ? priority > other.priority : sequence > other.sequence;
+			}
+		};
+
+		using RequestQueue = std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>>;
+
+		Query&												_query;
+		ChunkCache&											_cache;
+		std::mutex											_lock;
+		std::condition_variable								_wakeup;
+		std::unordered_map<ChunkKey, Request, ChunkKeyHash>	_requests;
+		RequestQueue										_queue;
+		std::vector<std::thread>							_threads;
+		bool												_stopping;
+		uint64_t											_nextId;
+		uint64_t											_sequence;
+		std::atomic<uint64_t>								_loaded;
+		std::atomic<uint64_t>								_coalesced;
+		std::atomic<uint64_t>								_cancelled;
+
+		void		ioThreadLoop();
+		static void notify(std::vector<Waiter>& waiters, const ChunkCache::ChunkRef& chunk);
+
+	  public:
+		ChunkLoader(Query& query, ChunkCache& cache);
+		~ChunkLoader();
+
+		ChunkLoader(const ChunkLoader&)			   = delete;
+		ChunkLoader& operator=(const ChunkLoader&) = delete;
+
+		void start(size_t threadCount = DEFAULT_THREAD_COUNT);
+		// Pending requests are answered with a null ChunkRef, as are the ones made afterwards
+		void stop();
+
+		// `priority` is a distance, lower is served first
+		ChunkTicket request(const ChunkKey& key, uint32_t priority, Callback callback);
+		// Returns false when the callback already ran or is running
+		bool cancel(const ChunkTicket& ticket);
+
+		size_t	 getPendingCount();
+		uint64_t getLoadedCount() const { return _loaded.load(); }
+		uint64_t getCoalescedCount() const { return _coalesced.load(); }
+		uint64_t getCancelledCount() const { return _cancelled.load(); }
+	};
+
+} // namespace World
+
+#endif
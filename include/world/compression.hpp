@@ -0,0 +1,51 @@
+#ifndef WORLD_COMPRESSION_HPP
+#define WORLD_COMPRESSION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <zlib.h>
+
+namespace World {
+
+	enum class ZlibFormat : uint8_t { Zlib, Gzip };
+
+	// zlib contexts of the calling thread, initialised once and reset between payloads.
+	// Inflating appends to the caller's vector: no staging buffer, no copy. Output is sized up front from the
+	// gzip trailer (exact) or from the ratio of the previous payloads on this thread, so growing is the exception.
+	// Not thread-safe by design, always go through local().
+	class ZlibCodec {
+	  private:
+		z_stream			 _inflate;
+		z_stream			 _deflate[2]; // indexed by ZlibFormat, initialised on first use
+		bool				 _deflateReady[2];
+		double				 _ratio;   // running average of inflated / compressed size
+		std::vector<uint8_t> _scratch; // capacity kept across payloads
+
+		ZlibCodec();
+
+	  public:
+		// Scratch buffers above this are released after use instead of being kept for the next payload
+		static constexpr size_t SCRATCH_RETAIN_LIMIT = 8 * 1024 * 1024;
+
+		~ZlibCodec();
+
+		ZlibCodec(const ZlibCodec&)			   = delete;
+		ZlibCodec& operator=(const ZlibCodec&) = delete;
+
+		static ZlibCodec& local();
+
+		// Appends the inflated payload (zlib or gzip, detected from the header) to `out`, returns its size.
+		// Throws std::runtime_error on corrupted or truncated input, `out` is then left as it was.
+		size_t inflate(std::span<const uint8_t> in, std::vector<uint8_t>& out);
+		// Appends the deflated payload to `out`, returns its size
+		size_t deflate(std::span<const uint8_t> in, ZlibFormat format, std::vector<uint8_t>& out);
+
+		// Empty buffer of this thread, reused across calls: only valid until the next scratch() on the same thread
+		std::vector<uint8_t>& scratch();
+	};
+
+} // namespace World
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef WORLD_HEIGHTMAPS_HPP
+#define WORLD_HEIGHTMAPS_HPP
+
+#include "lib/nbtView.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+class Buffer;
+
+namespace World {
+
+	struct ChunkSection;
+
+	// Per-column heights of a chunk for the vanilla heightmap types, kept unpacked (one uint16_t per column) so a
+	// query is one load. A height is one above the highest block matching the type, relative to the bottom of the
+	// world: 0 for a column without any.
+	//   WorldSurface            any block but air
+	//   OceanFloor              blocks that stop movement (no fluids, no plants)
+	//   MotionBlocking          blocks that stop movement and fluids, waterlogged blocks included
+	//   MotionBlockingNoLeaves  MotionBlocking without leaves
+	class Heightmaps {
+	  public:
+		enum class Type : uint8_t { WorldSurface, OceanFloor, MotionBlocking, MotionBlockingNoLeaves };
+
+		static constexpr size_t TYPE_COUNT = 4;
+		static constexpr int	BITS	   = 9; // ceil(log2(384 + 1))
+
+		// Chunk Data network id and saved NBT name of a type
+		static int				getNetworkId(Type type);
+		static std::string_view getName(Type type);
+		// The types a client receives; OceanFloor stays on the server
+		static bool isSentToClient(Type type) { return type != Type::OceanFloor; }
+
+	  private:
+		std::array<std::array<uint16_t, 256>, TYPE_COUNT> _heights;
+
+		static size_t column(int x, int z) { return static_cast<size_t>((z << 4) | x); }
+
+		// Height of one type in a column, scanning the sections down from `fromY` (world y, included)
+		static uint16_t scan(const std::vector<ChunkSection>& sections, Type type, int x, int z, int fromY);
+
+	  public:
+		Heightmaps();
+
+		// Section-local x, z (0..15); height relative to the bottom of the world
+		uint16_t get(Type type, int x, int z) const { return _heights[static_cast<size_t>(type)][column(x, z)]; }
+		// World y of the first block above the highest matching one
+		int getY(Type type, int x, int z) const;
+
+		// Every type of every column from the decoded sections, all 0 without sections
+		void compute(const std::vector<ChunkSection>& sections);
+		void compute(const std::vector<ChunkSection>& sections, Type type);
+		// Saved "Heightmaps" long array of one type, same packing as on the wire. Throws std::runtime_error when it
+		// does not hold 256 heights.
+		void load(Type type, const nbt::BigEndianArray<int64_t>& packed);
+
+		// After the block at section-local x, z and world y was set to `state`: the column heights move up when the
+		// new block matches above them, and are rescanned down from y when the top block stopped matching. O(column).
+		// Returns whether any height changed.
+		bool update(const std::vector<ChunkSection>& sections, int x, int y, int z, uint32_t state);
+
+		// Prefixed array of (VarInt type, prefixed long array) of Chunk Data since 1.21.5, client types only
+		void   encode(Buffer& out) const;
+		size_t networkSize() const;
+	};
+
+} // namespace World
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef WORLD_LIGHT_ENGINE_HPP
+#define WORLD_LIGHT_ENGINE_HPP
+
+#include "world.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace World {
+
+	// Server-side sky and block light with the vanilla rules: light entering a block loses max(1, opacity) levels,
+	// sky light goes straight down through transparent blocks without losing any, emitters start at their level.
+	//
+	// Two paths:
+	//   lightChunk()  lights a whole chunk from its blocks alone, for chunks saved without light. Each light section
+	//                 is relaxed in place with a 16-lane neighbour max (one SSE2 register per x row) until no level
+	//                 rises; sections whose neighbours did not change are skipped. It runs on the thread that
+	//                 decodes the chunk, so chunk loads light in parallel.
+	//   runUpdates()  applies the block changes queued since the last call, meant to run once per tick: a BFS
+	//                 decrease pass removes the light the changed blocks used to let through or emit, an increase
+	//                 pass refills it from the remaining sources. A change reaches at most 15 blocks sideways, so
+	//                 changes are grouped by chunk and the groups of chunks three apart (same x % 3 and z % 3, 3x3
+	//                 neighbourhoods disjoint) are run in parallel, nine rounds per call. The update threads are
+	//                 started by the first call and kept by the engine for the next ones.
+	class LightEngine {
+	  public:
+		struct BlockPos {
+			int x, y, z;
+		};
+
+		// Mutable chunks the updates read blocks from and write light to; getChunk is called concurrently from the
+		// update threads, for different chunks. A chunk that is not loaded (nullptr) stops the light at its border.
+		class Source {
+		  public:
+			virtual ~Source()								  = default;
+			virtual ChunkData* getChunk(int chunkX, int chunkZ) = 0;
+		};
+
+		// Source over the chunk cache: the chunks it hands out stay pinned for its lifetime, chunks that are not
+		// cached are not loaded for a light update
+		class CacheSource : public Source {
+		  private:
+			ChunkCache&																_cache;
+			Dimension																_dimension;
+			std::mutex																_lock;
+			std::unordered_map<ChunkKey, ChunkCache::MutableChunkRef, ChunkKeyHash>	_pinned;
+
+		  public:
+			explicit CacheSource(ChunkCache& cache, Dimension dimension = Dimension::Overworld);
+
+			ChunkData* getChunk(int chunkX, int chunkZ) override;
+		};
+
+		LightEngine();
+		~LightEngine();
+
+		LightEngine(const LightEngine&)			   = delete;
+		LightEngine& operator=(const LightEngine&) = delete;
+
+		// Light emitted by a block state, 0..15
+		static uint8_t getEmission(uint32_t state);
+		// Levels a block state removes from the light passing through it, 15 for opaque blocks
+		static uint8_t getOpacity(uint32_t state);
+
+		// Recomputes chunk.light from the blocks of the chunk; neighbouring chunks are not read, light does not
+		// cross the chunk border. A chunk without sections is left under open sky.
+		static void lightChunk(ChunkData& chunk);
+
+		// Thread-safe, the block at the position must already hold its new state when runUpdates() reads it
+		void queueBlockChange(int x, int y, int z);
+		size_t getPending() const;
+
+		// Relights around every queued change, returns the number of changes applied. Chunks whose light changed
+		// are marked changed, their packet is rebuilt on the next send. Calls are serialized.
+		size_t runUpdates(Source& source);
+
+	  private:
+		mutable std::mutex	  _lock;
+		std::vector<BlockPos> _changes;
+
+		// Update threads: every thread of the pool, and the one running runUpdates(), takes jobs of the current
+		// round until none is left; the round ends when all of them checked in
+		std::mutex						   _updateLock; // held by runUpdates()
+		std::mutex						   _poolLock;
+		std::condition_variable			   _roundStart;
+		std::condition_variable			   _roundDone;
+		std::vector<std::thread>		   _threads;
+		const std::function<void(size_t)>* _round;
+		size_t							   _roundSize;
+		std::atomic<size_t>				   _nextJob;
+		size_t							   _busy; // pool threads still in the round
+		uint64_t						   _generation;
+		bool							   _stopping;
+
+		void poolThreadLoop();
+		// Runs job(i) for i in [0, count) on the pool and the calling thread
+		void runRound(size_t count, const std::function<void(size_t)>& job);
+	};
+
+} // namespace World
+
+#endif
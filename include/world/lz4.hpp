@@ -0,0 +1,42 @@
+#ifndef WORLD_LZ4_HPP
+#define WORLD_LZ4_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace World {
+
+	// LZ4 as used by region compression type 4: raw LZ4 blocks (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md)
+	// wrapped in the lz4-java LZ4Block stream, which is what the vanilla server writes. Each stream block is
+	//   "LZ4Block" | token (method | level) | compressed size | original size | checksum   (sizes and checksum LE)
+	// followed by its data, and the stream ends with an empty block. The checksum is XXHash32 (seed 0x9747b28c)
+	// of the original bytes, masked to 28 bits.
+	namespace LZ4 {
+
+		constexpr size_t   STREAM_BLOCK_SIZE = 64 * 1024; // lz4-java's default
+		constexpr uint32_t CHECKSUM_SEED	  = 0x9747B28C;
+
+		// Worst case size of compressBlock() for `size` input bytes
+		constexpr size_t compressBound(size_t size) { return size + size / 255 + 16; }
+
+		// One raw block, `out` must hold compressBound(in.size()) bytes. Returns the compressed size.
+		size_t compressBlock(std::span<const uint8_t> in, uint8_t* out);
+		// One raw block into exactly `out`. Throws std::runtime_error on malformed input or when `out` is too small,
+		// returns the number of bytes written.
+		size_t decompressBlock(std::span<const uint8_t> in, std::span<uint8_t> out);
+
+		uint32_t xxHash32(std::span<const uint8_t> data, uint32_t seed);
+
+		// Appends a complete LZ4Block stream (end mark included) to `out`, returns its size
+		size_t compressStream(std::span<const uint8_t> in, std::vector<uint8_t>& out);
+		// Appends the decoded stream to `out`, sized once from the block headers. Throws std::runtime_error on a
+		// corrupted stream or a checksum mismatch, `out` is then left as it was.
+		size_t decompressStream(std::span<const uint8_t> in, std::vector<uint8_t>& out);
+
+	} // namespace LZ4
+
+} // namespace World
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef WORLD_PALETTED_CONTAINER_HPP
+#define WORLD_PALETTED_CONTAINER_HPP
+
+#include "lib/nbtView.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+class Buffer;
+
+namespace World {
+
+	// Block states of a 16x16x16 section (4096 entries) or biomes of its 4x4x4 cells (64 entries), held in one of
+	// the three forms of the protocol:
+	//   Single    one global id for every entry, no data
+	//   Indirect  palette of global ids + packed indices (4..8 bits for blocks, 1..3 for biomes)
+	//   Direct    packed global ids
+	// Entries are packed like vanilla since 1.16: floor(64 / bits) per long, lowest bits first, never straddling two
+	// longs. The packed longs are kept in the network layout, so encode() writes them without unpacking anything.
+	// Entry index: (y * 16 + z) * 16 + x for blocks, (y * 4 + z) * 4 + x for biomes.
+	class PalettedContainer {
+	  public:
+		enum class Kind : uint8_t { Blocks, Biomes };
+		enum class Mode : uint8_t { Single, Indirect, Direct };
+
+		// Global id of one NBT palette entry: a {Name, Properties} compound for blocks, a string for biomes
+		using Resolver = std::function<uint32_t(const nbt::TagView& entry)>;
+
+		// Bits of a Direct container: ceil(log2(block state count)), ceil(log2(synced worldgen/biome entries)) for biomes
+		static uint8_t directBits(Kind kind);
+
+	  private:
+		Kind				  _kind;
+		Mode				  _mode;
+		uint8_t				  _bits;	// 0 when Single
+		std::vector<uint32_t> _palette; // Single: the value, Indirect: local index -> global id, Direct: empty
+		std::vector<uint64_t> _data;	// packed entries, host order
+
+		PalettedContainer(Kind kind, Mode mode, uint8_t bits);
+
+		static uint8_t indirectBits(Kind kind, size_t paletteSize);
+
+		uint32_t index(size_t entry) const {
+			size_t perLong = 64 / _bits;
+			return static_cast<uint32_t>((_data[entry / perLong] >> ((entry % perLong) * _bits)) & ((uint64_t{1} << _bits) - 1));
+		}
+
+	  public:
+		// Every entry set to `value`
+		PalettedContainer(Kind kind, uint32_t value);
+
+		// Decodes a "block_states" or "biomes" compound of a chunk section: the palette is resolved once, duplicates
+		// (entries resolving to the same id) are merged, and the indices are repacked only when the layout on disk
+		// differs from the network one. Throws std::runtime_error on a missing palette, a data array of the wrong
+		// length or an index outside the palette.
+		static PalettedContainer fromNBT(Kind kind, const nbt::TagView& container, const Resolver& resolve);
+
+		static constexpr size_t entryCount(Kind kind) { return kind == Kind::Blocks ? 4096 : 64; }
+
+		Kind	getKind() const { return _kind; }
+		Mode	getMode() const { return _mode; }
+		uint8_t getBits() const { return _bits; }
+		size_t	size() const { return entryCount(_kind); }
+
+		std::span<const uint32_t> getPalette() const { return _palette; }
+
+		uint32_t get(size_t entry) const {
+			if (_mode == Mode::Single) return _palette[0];
+			uint32_t value = index(entry);
+			return _mode == Mode::Indirect ? _palette[value] : value;
+		}
+
+		// Indirect containers only: position of an entry's id in getPalette()
+		uint32_t getPaletteIndex(size_t entry) const { return index(entry); }
+
+		// Calls fn(entry, id) for the entries in [begin, end), in order. The longs are unpacked sequentially: no
+		// division per entry, and a Single container never touches memory past its value.
+		template <typename Fn> void forEach(size_t begin, size_t end, Fn&& fn) const {
+			if (_mode == Mode::Single) {
+				for (size_t i = begin; i < end; i++) fn(i, _palette[0]);
+				return;
+			}
+			if (begin >= end) return;
+
+			size_t	 perLong = 64 / _bits;
+			uint64_t mask	 = (uint64_t{1} << _bits) - 1;
+			size_t	 word	 = begin / perLong;
+			size_t	 left	 = perLong - begin % perLong;
+			uint64_t packed	 = _data[word] >> ((begin % perLong) * _bits);
+			for (size_t i = begin; i < end; i++) {
+				if (left == 0) {
+					packed = _data[++word];
+					left   = perLong;
+				}
+				uint32_t value = static_cast<uint32_t>(packed & mask);
+				packed >>= _bits;
+				left--;
+				fn(i, _mode == Mode::Indirect ? _palette[value] : value);
+			}
+		}
+
+		// Number of entries whose global id matches, `match` runs once per palette entry (once per entry when Direct)
+		size_t countIf(const std::function<bool(uint32_t)>& match) const;
+
+		// Bits per entry, palette and data array as sent in a Chunk Data section (1.21.5: the array is not length-prefixed)
+		void   encode(Buffer& out) const;
+		size_t networkSize() const;
+
+		size_t memoryUsage() const { return _palette.capacity() * sizeof(uint32_t) + _data.capacity() * sizeof(uint64_t); }
+	};
+
+} // namespace World
+
+#endif
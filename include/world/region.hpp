@@ -0,0 +1,105 @@
+#ifndef WORLD_REGION_HPP
+#define WORLD_REGION_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+
+namespace World {
+
+	// Compression byte of a chunk in a region file (see https://minecraft.wiki/w/Region_file_format)
+	enum class RegionCompression : uint8_t { Gzip = 1, Zlib = 2, None = 3, LZ4 = 4 };
+
+	// "gzip", "deflate" (or "zlib"), "none" or "lz4", the names server.properties uses; nullopt when unknown
+	std::optional<RegionCompression> parseRegionCompression(const std::string& name);
+
+	// Compressed payload of one chunk inside a region file, empty when the chunk was never generated
+	struct RegionChunk {
+		uint8_t					 compression = 0; // RegionCompression, kept raw: unknown values are reported by the reader
+		std::span<const uint8_t> data;
+
+		bool empty() const { return data.empty(); }
+	};
+
+	// One .mca file mapped read-only for its whole lifetime.
+	// The location and timestamp tables are decoded once on open, a chunk read is then a bounds-checked slice
+	// of the mapping: no open, no seek, no copy. Slices stay valid as long as the RegionFile is alive.
+	class RegionFile {
+	  private:
+		std::filesystem::path		_path;
+		const uint8_t*				_map;
+		size_t						_size;
+		std::array<uint32_t, 1024>	_locations;		// (sector offset << 8) | sector count, host order
+		std::array<uint32_t, 1024>	_timestamps;	// last save, seconds since epoch
+
+		static constexpr size_t SECTOR_SIZE = 4096;
+
+		static size_t index(int chunkX, int chunkZ) { return static_cast<size_t>(((chunkZ & 31) << 5) | (chunkX & 31)); }
+
+	  public:
+		// Throws std::runtime_error when the file cannot be opened or mapped
+		explicit RegionFile(const std::filesystem::path& path);
+		~RegionFile();
+
+		RegionFile(const RegionFile&)			 = delete;
+		RegionFile& operator=(const RegionFile&) = delete;
+
+		// Chunk coordinates are absolute, only their low 5 bits are used
+		bool		hasChunk(int chunkX, int chunkZ) const { return _locations[index(chunkX, chunkZ)] != 0; }
+		uint32_t	getTimestamp(int chunkX, int chunkZ) const { return _timestamps[index(chunkX, chunkZ)]; }
+		RegionChunk readChunk(int chunkX, int chunkZ) const;
+
+		// Stores an already compressed chunk in the file at `path`, creating it if needed. The payload goes to free
+		// sectors (never over the chunk's current ones) before the header is updated, so a mapping of the previous
+		// version stays readable. Throws std::runtime_error on I/O errors or payloads over 255 sectors (~1 MiB).
+		static void writeChunk(const std::filesystem::path& path, int chunkX, int chunkZ, RegionCompression compression,
+							   std::span<const uint8_t> payload);
+
+		const std::filesystem::path& getPath() const { return _path; }
+	};
+
+	// Open regions, least recently used closed first. Regions that do not exist on disk are remembered too,
+	// so a lookup never touches the filesystem twice for the same region.
+	class RegionCache {
+	  private:
+		using Key	= std::pair<int, int>;
+		using Entry = std::pair<Key, std::shared_ptr<const RegionFile>>;
+
+		std::filesystem::path						_directory;
+		size_t										_capacity;
+		std::mutex									_lock;
+		std::list<Entry>							_lru; // most recent first
+		std::map<Key, std::list<Entry>::iterator>	_index;
+		std::map<Key, std::mutex>					_writeLocks; // one per region ever written, under _lock
+
+	  public:
+		static constexpr size_t DEFAULT_CAPACITY = 64;
+
+		explicit RegionCache(size_t capacity = DEFAULT_CAPACITY);
+
+		void setDirectory(const std::filesystem::path& directory);
+
+		// Region holding the chunk, nullptr when its file does not exist
+		std::shared_ptr<const RegionFile> getRegionForChunk(int chunkX, int chunkZ);
+		std::shared_ptr<const RegionFile> getRegion(int regionX, int regionZ);
+
+		// Writes through RegionFile::writeChunk() and drops the cached mapping, the next read maps the new file.
+		// Writes to one region are serialized; the disk I/O runs without the cache lock, reads and writes of other
+		// regions go on meanwhile.
+		void writeChunk(int chunkX, int chunkZ, RegionCompression compression, std::span<const uint8_t> payload);
+
+		static std::filesystem::path regionFileName(int regionX, int regionZ);
+	};
+
+} // namespace World
+
+#endif
@@ -2,13 +2,25 @@
 #define WORLD_MANAGER_HPP
 
 #include "lib/nbt.hpp"
+#include "lib/nbtView.hpp"
+#include "chunkCache.hpp"
+#include "chunkLight.hpp"
+#include "heightmaps.hpp"
 #include "logger.hpp"
+#include "palettedContainer.hpp"
+#include "region.hpp"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace World {
@@ -55,60 +67,152 @@ namespace World {
 		nbt::NBT nbtData;
 	};
 
+	constexpr int MIN_SECTION_Y = -4; // overworld, y -64..319
+	constexpr int SECTION_COUNT = 24;
+	constexpr int MIN_Y			= MIN_SECTION_Y * 16;
+	constexpr int MAX_Y			= MIN_Y + SECTION_COUNT * 16 - 1;
+	static_assert(LIGHT_SECTION_COUNT == SECTION_COUNT + 2 && MIN_LIGHT_SECTION_Y == MIN_SECTION_Y - 1);
+
+	struct ChunkSection {
+		uint16_t		  nonAirBlocks;
+		PalettedContainer blocks;
+		PalettedContainer biomes;
+
+		// Section-local coordinates: 0..15 for blocks, 0..3 for biome cells
+		static constexpr size_t blockIndex(int x, int y, int z) { return static_cast<size_t>((y << 8) | (z << 4) | x); }
+		static constexpr size_t biomeIndex(int x, int y, int z) { return static_cast<size_t>((y << 4) | (z << 2) | x); }
+
+		uint32_t getBlock(int x, int y, int z) const { return blocks.get(blockIndex(x, y, z)); }
+		uint32_t getBiome(int x, int y, int z) const { return biomes.get(biomeIndex(x, y, z)); }
+	};
+
+	// Network id of minecraft:plains, the biome of sections missing from a chunk
+	uint32_t defaultBiomeId();
+
+	// Encoded Chunk Data packet of one chunk, built by the first send and shared by every later one until the chunk
+	// version changes. Concurrent first sends wait for the one encoding instead of encoding again.
+	class ChunkPacket {
+	  private:
+		std::mutex									_lock;
+		uint64_t									_version = 0;
+		std::shared_ptr<const std::vector<uint8_t>> _frame;
+
+	  public:
+		// `encode` returns the frame, nullptr when the chunk cannot be sent (nothing is cached then)
+		template <typename Encode> std::shared_ptr<const std::vector<uint8_t>> get(uint64_t version, Encode&& encode) {
+			std::lock_guard<std::mutex> lock(_lock);
+			if (!_frame || _version != version) {
+				_frame	 = encode();
+				_version = version;
+			}
+			return _frame;
+		}
+
+		size_t size() {
+			std::lock_guard<std::mutex> lock(_lock);
+			return _frame ? _frame->size() : 0;
+		}
+	};
+
 	struct ChunkData {
 		int chunkX;
 		int chunkZ;
 
-		std::vector<uint8_t> blockData;
-		std::vector<uint8_t> biomeData;
-		std::vector<uint8_t> heightmaps;
-		std::vector<uint8_t> blockEntities;
+		// SECTION_COUNT entries from MIN_SECTION_Y up once decoded, sections missing on disk are air; empty when
+		// the chunk could not be read
+		std::vector<ChunkSection> sections;
+		Heightmaps				  heightmaps; // saved ones, computed from the sections when missing
+		std::vector<uint8_t>	  blockEntities;
+
+		ChunkLight light;
 
-		std::vector<uint8_t> skyLight;
-		std::vector<uint8_t> blockLight;
+		// Bumped by every change of blocks or light, the cached packet is rebuilt on the next send
+		std::atomic<uint64_t>		 version = 0;
+		std::shared_ptr<ChunkPacket> packet	 = std::make_shared<ChunkPacket>();
+
+		// Cached chunks are shared read-only: blocks and light are only changed with this lock held exclusively
+		// (LightEngine updates), the packet encoder holds it shared while it reads them
+		mutable std::shared_mutex lock;
 
 		ChunkData(int x, int z) : chunkX(x), chunkZ(z) {}
 
-		bool isEmpty() const { return blockData.empty(); }
+		// Moved only before the chunk is cached and shared, the lock is not carried over
+		ChunkData(ChunkData&& other)
+			: chunkX(other.chunkX), chunkZ(other.chunkZ), sections(std::move(other.sections)), heightmaps(std::move(other.heightmaps)),
+			  blockEntities(std::move(other.blockEntities)), light(std::move(other.light)), version(other.version.load()),
+			  packet(std::move(other.packet)) {}
+
+		ChunkData(const ChunkData&)			   = delete;
+		ChunkData& operator=(const ChunkData&) = delete;
+
+		// With `lock` held exclusively
+		void markChanged() { version.fetch_add(1, std::memory_order_release); }
+
+		bool isEmpty() const { return sections.empty(); }
 	};
 
 	class Manager {
 	  public:
 		static std::vector<uint8_t> decompressGzip(std::filesystem::path compressedFilePath);
-		static std::vector<uint8_t> decompressGzip(const std::vector<uint8_t>& compressedData);
-		static std::vector<uint8_t> decompressZlib(const std::vector<uint8_t>& compressedData);
+		static std::vector<uint8_t> decompressGzip(std::span<const uint8_t> compressedData);
+		static std::vector<uint8_t> decompressZlib(std::span<const uint8_t> compressedData);
 
 		std::filesystem::path locateRegionFileByChunkCoord(int ChunkX, int ChunkZ);
 		LevelDat			  loadLevelDat(std::filesystem::path levelDatPath);
 
 		const LevelDat& getLevelDat() const { return _LevelDat; }
 
-		void						 setWorldPath(const std::filesystem::path& worldPath) { _worldPath = worldPath; }
+		void						 setWorldPath(const std::filesystem::path& worldPath);
 		const std::filesystem::path& getWorldPath() const { return _worldPath; }
 
+		// Compression used for chunks written from now on, existing ones are read whatever they use
+		void			  setRegionCompression(RegionCompression compression) { _regionCompression = compression; }
+		RegionCompression getRegionCompression() const { return _regionCompression; }
+		// Compresses a serialized chunk NBT with the region compression and stores it, the cached copy is dropped.
+		// Nothing in the server changes chunks yet: this is the path the first writer takes, with the codec
+		// config.json picks (world.region-compression).
+		void saveChunk(int chunkX, int chunkZ, std::span<const uint8_t> chunkNbt);
+
+		RegionCache& getRegions() { return _regions; }
+		ChunkCache&	 getChunkCache() { return _chunkCache; }
+
 	  private:
 		LevelDat			  _LevelDat;
 		std::filesystem::path _worldPath;
+		RegionCache			  _regions;
+		ChunkCache			  _chunkCache;
+		RegionCompression	  _regionCompression = RegionCompression::Zlib;
 	};
 
 	class Query {
 	  public:
 		explicit Query(Manager& manager) : _worldManager(manager) {}
+
+		// Shared decoded chunk, read from disk only on a cache miss. Hold the ref only while using it: it pins the entry.
+		// Only the overworld is loaded (<world>/region, overworld build height): other dimensions throw
+		// std::runtime_error instead of caching overworld chunks under their key.
+		ChunkCache::ChunkRef getChunk(int chunkX, int chunkZ, Dimension dimension = Dimension::Overworld);
+
+		// Always reads the overworld region file, bypassing the chunk cache
 		ChunkData fetchChunk(int chunkX, int chunkZ) {
-			ChunkData chunk(chunkX, chunkZ);
 
 			try {
-				auto regionPath = _worldManager.locateRegionFileByChunkCoord(chunkX, chunkZ);
-				chunk			= loadChunkFromRegion(regionPath, chunkX, chunkZ);
+				auto region = _worldManager.getRegions().getRegionForChunk(chunkX, chunkZ);
+				if (!region) {
+					g_logger->logGameInfo(DEBUG,
+										  "No region file for chunk (" + std::to_string(chunkX) + ", " + std::to_string(chunkZ) +
+												  "), sending empty chunk",
+										  "World::Query::fetchChunk");
+					return generateEmptyChunk(chunkX, chunkZ);
+				}
+				return loadChunkFromRegion(*region, chunkX, chunkZ);
 			} catch (const std::exception& e) {
 				g_logger->logGameInfo(DEBUG,
 									  "Chunk (" + std::to_string(chunkX) + ", " + std::to_string(chunkZ) +
 											  ") not found, sending empty chunk: " + e.what(),
 									  "World::Query::fetchChunk");
-				chunk = generateEmptyChunk(chunkX, chunkZ);
+				return generateEmptyChunk(chunkX, chunkZ);
 			}
-
-			return chunk;
 		}
 		const LevelDat& getWorldData() const { return _worldManager.getLevelDat(); }
 
@@ -116,14 +220,12 @@ namespace World {
 		Manager& _worldManager;
 
 	  private:
-		void	  extractChunkDataFromNBT(const nbt::NBT& chunkNBT, ChunkData& chunk);
-		void	  extractSectionsData(const nbt::TagList& sections, ChunkData& chunk);
-		void	  extractBlockStatesFromSection(const nbt::TagCompound& blockStates, ChunkData& chunk, int8_t sectionY);
-		void	  extractHeightmaps(const nbt::TagCompound& heightmaps, ChunkData& chunk);
-		void	  extractBlockEntities(const nbt::TagList& blockEntities, ChunkData& chunk);
-		void	  extractBiomesFromSections(const nbt::TagCompound& root, ChunkData& chunk);
+		void	  extractChunkDataFromNBT(const nbt::View& chunkNBT, ChunkData& chunk);
+		void	  extractSectionsData(const nbt::TagView& sections, ChunkData& chunk);
+		void	  extractHeightmaps(const nbt::TagView& heightmaps, ChunkData& chunk);
+		void	  extractBlockEntities(const nbt::TagView& blockEntities, ChunkData& chunk);
 		ChunkData generateEmptyChunk(int chunkX, int chunkZ);
-		ChunkData loadChunkFromRegion(const std::filesystem::path& regionPath, int chunkX, int chunkZ);
+		ChunkData loadChunkFromRegion(const RegionFile& region, int chunkX, int chunkZ);
 	};
 
 } // namespace World
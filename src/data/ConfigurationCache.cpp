@@ -0,0 +1,42 @@
+#include "data/ConfigurationCache.hpp"
+
+#include "data/RegistryData.hpp"
+#include "data/RegistryDataUtils.hpp"
+#include "logger.hpp"
+#include "network/buffer.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+ConfigurationCache::ConfigurationCache() : _frames(), _registryCount(0) {}
+
+void ConfigurationCache::build() {
+	auto start = std::chrono::steady_clock::now();
+
+	std::vector<RegistryData> registries = parseMinecraftRegistries();
+	if (registries.empty()) throw std::runtime_error("No registries parsed from minecraft_registries.h");
+
+	Buffer frames;
+	_registryCount = encodeRegistryFrames(registries, frames);
+	encodeUpdateTagsFrame(frames);
+
+	const auto& bytes = frames.getData();
+	_frames			  = std::make_shared<const std::vector<uint8_t>>(bytes.begin(), bytes.end());
+
+	auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+	g_logger->logGameInfo(INFO,
+						  "Configuration frames encoded: " + std::to_string(_registryCount) + " registries + tags, " +
+								  std::to_string(_frames->size()) + " bytes in " + std::to_string(elapsed.count()) + " us",
+						  "SERVER");
+}
+
+bool ConfigurationCache::sharesCorePack(const std::vector<Buffer::KnownPack>& clientPacks) {
+	for (const auto& pack : clientPacks) {
+		if (pack.nameSpace == CORE_PACK_NAMESPACE && pack.id == CORE_PACK_ID && pack.version == CORE_PACK_VERSION) return true;
+	}
+	return false;
+}
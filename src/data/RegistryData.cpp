@@ -43,10 +43,8 @@ void RegistryData::addEntry(const std::string& entryId, bool hasData, std::optio
 	_entries.emplace_back(entryId, hasData, data);
 }
 
-std::vector<uint8_t> RegistryData::serialize() const {
+void RegistryData::serialize(Buffer& buffer) const {
 	try {
-		Buffer buffer;
-
 		// Format MC 1.21.5: id + entries length + entries array
 		buffer.writeIdentifier(_registry_id);
 		buffer.writeVarInt(static_cast<int32_t>(_entries.size()));
@@ -56,16 +54,13 @@ std::vector<uint8_t> RegistryData::serialize() const {
 			buffer.writeIdentifier(entry.entry_id);
 
 			// Format "value optional": boolean présent + données NBT si présent
-			if (entry.has_data && entry.data.has_value()) {
+			if (entry.has_data && entry.data.has_value() && *entry.data) {
 				buffer.writeBool(true); // Données présentes
-				buffer.writeNBT("{}");	// Données NBT (vide pour l'instant)
+				buffer.writeNBT(**entry.data);
 			} else {
 				buffer.writeBool(false); // Pas de données NBT optionnelles
 			}
 		}
-
-		return buffer.getData();
-
 	} catch (const std::exception& e) {
 		throw std::runtime_error("Failed to serialize RegistryData: " + std::string(e.what()));
 	}
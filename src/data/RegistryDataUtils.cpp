@@ -5,13 +5,28 @@
 #include "logger.hpp"
 #include "minecraftRegistries.hpp"
 #include "network/buffer.hpp"
-#include "network/networking.hpp"
+#include "network/scratch_arena.hpp"
 
+#include <cstddef>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
+namespace {
+	// Every generated entry must round-trip through the perfect hash and the dense id -> name array
+	constexpr bool registryTablesConsistent() {
+		for (const RegistryTable* table : RegistryIds::ALL) {
+			for (const RegistryIdEntry& entry : *table) {
+				if (table->find(entry.name) != entry.id || table->getName(entry.id) != entry.name) return false;
+			}
+		}
+		return RegistryIds::getRegistry("minecraft:block") == &RegistryIds::getBlock() && !RegistryIds::getBlock().contains("minecraft:not_a_block");
+	}
+	static_assert(registryTablesConsistent(), "RegistryIds.hpp is out of sync with RegistryTable::hash");
+} // namespace
+
 std::vector<RegistryData> parseMinecraftRegistries() {
 	std::vector<RegistryData> registries;
 
@@ -37,15 +52,14 @@ std::vector<RegistryData> parseMinecraftRegistries() {
 
 			registryData.reserve(registry.entries.size());
 
-			for (const auto& entry : registry.entries) {
-				// En MC 1.21.5, certains registres nécessitent des données NBT
-				bool needsNBT =
-						(registryName == "minecraft:damage_type" || registryName == "minecraft:dimension_type" ||
-						 registryName == "minecraft:enchantment" || registryName == "minecraft:worldgen/biome" ||
-						 registryName == "minecraft:banner_pattern" || registryName == "minecraft:trim_material" ||
-						 registryName == "minecraft:trim_pattern" || registryName == "minecraft:painting_variant" ||
-						 registryName == "minecraft:jukebox_song" || registryName == "minecraft:instrument" || registryName == "minecraft:chat_type");
+			// En MC 1.21.5, certains registres nécessitent des données NBT
+			bool needsNBT = (registryName == "minecraft:damage_type" || registryName == "minecraft:dimension_type" ||
+							 registryName == "minecraft:enchantment" || registryName == "minecraft:worldgen/biome" ||
+							 registryName == "minecraft:banner_pattern" || registryName == "minecraft:trim_material" ||
+							 registryName == "minecraft:trim_pattern" || registryName == "minecraft:painting_variant" ||
+							 registryName == "minecraft:jukebox_song" || registryName == "minecraft:instrument" || registryName == "minecraft:chat_type");
 
+			for (const auto& entry : registry.entries) {
 				registryData.addEntry(entry.name, needsNBT);
 			}
 
@@ -79,29 +93,6 @@ std::vector<RegistryData> parseMinecraftRegistries() {
 	return registries;
 }
 
-void sendRegistryData(Packet& packet, Server& server) {
-	g_logger->logNetwork(INFO, "=== Sending Registry Data packets (0x07) using parseMinecraftRegistries ===", "Configuration");
-
-	try {
-		std::vector<RegistryData> registries = parseMinecraftRegistries();
-
-		if (registries.empty()) {
-			g_logger->logNetwork(ERROR, "No registries parsed from minecraft_registries.h", "Configuration");
-			packet.setReturnPacket(PACKET_ERROR);
-			return;
-		}
-
-		g_logger->logNetwork(
-				INFO, "Successfully parsed " + std::to_string(registries.size()) + " registries from minecraft_registries.h", "Configuration");
-
-		sendRegistryDataBatch(packet, server, registries);
-
-	} catch (const std::exception& e) {
-		g_logger->logNetwork(ERROR, "Failed to send registry data: " + std::string(e.what()), "Configuration");
-		packet.setReturnPacket(PACKET_ERROR);
-	}
-}
-
 bool validateRegistryData(const RegistryData& registry) {
 	if (registry.getRegistryId().empty()) {
 		if (g_logger) {
@@ -144,122 +135,60 @@ bool validateRegistryData(const RegistryData& registry) {
 	return true;
 }
 
-RegistryData createRegistryFromMap(const std::string& registryName, const std::map<std::string, uint32_t>& registryData, bool addNamespace) {
+RegistryData createRegistryFromTable(const std::string& registryName, const RegistryTable& registryData, bool addNamespace) {
 	std::string	 fullRegistryName = addNamespace ? "minecraft:" + registryName : registryName;
 	RegistryData registry(fullRegistryName);
 
 	registry.reserve(registryData.size());
 
 	for (const auto& entry : registryData) {
-		registry.addEntry(entry.first, false);
+		registry.addEntry(std::string(entry.name), false);
 	}
 
 	return registry;
 }
 
-std::vector<uint8_t> serializeRegistryPacket(const RegistryData& registry) {
+void serializeRegistryPacket(const RegistryData& registry, Buffer& out) {
 	try {
-		std::vector<uint8_t> registryBytes = registry.serialize();
-
-		Buffer packetBuffer;
+		Buffer registryBytes(ScratchArena::current());
+		registry.serialize(registryBytes);
 
 		int packetId		= RegistryData::PACKET_ID;
 		int packetIdSize	= 1;
-		int totalPacketSize = packetIdSize + static_cast<int>(registryBytes.size());
+		int totalPacketSize = packetIdSize + static_cast<int>(registryBytes.getData().size());
 
-		packetBuffer.writeVarInt(totalPacketSize);
+		out.writeVarInt(totalPacketSize);
 
-		packetBuffer.writeVarInt(packetId);
+		out.writeVarInt(packetId);
 
-		packetBuffer.writeBytes(registryBytes);
-
-		return packetBuffer.getData();
+		out.writeBytes(registryBytes.getData());
 
 	} catch (const std::exception& e) {
 		throw std::runtime_error("Failed to serialize registry packet: " + std::string(e.what()));
 	}
 }
 
-void sendRegistryDataBatch(Packet& packet, Server& server, const std::vector<RegistryData>& registries) {
-	if (registries.empty()) {
-		if (g_logger) {
-			g_logger->logNetwork(WARN, "No registries provided to sendRegistryDataBatch", "Configuration");
-		}
-		packet.setReturnPacket(PACKET_OK);
-		return;
-	}
-
-	Player* player = packet.getPlayer();
-	if (!player) {
-		if (g_logger) {
-			g_logger->logNetwork(ERROR, "No player found in packet for registry data batch", "Configuration");
-		}
-		packet.setReturnPacket(PACKET_ERROR);
-		return;
-	}
-
-	ThreadSafeQueue<Packet*>* outgoingPackets = server.getNetworkManager().getOutgoingQueue();
-	if (!outgoingPackets) {
-		if (g_logger) {
-			g_logger->logNetwork(ERROR, "No outgoing packet queue available", "Configuration");
-		}
-		packet.setReturnPacket(PACKET_ERROR);
-		return;
-	}
-
-	if (g_logger) {
-		g_logger->logNetwork(INFO, "Sending registry data batch with " + std::to_string(registries.size()) + " registries", "Configuration");
-	}
-
-	int successCount = 0;
-	int errorCount	 = 0;
+size_t encodeRegistryFrames(const std::vector<RegistryData>& registries, Buffer& out) {
+	size_t encoded = 0;
 
 	for (const auto& registry : registries) {
 		if (!validateRegistryData(registry)) {
 			if (g_logger) {
 				g_logger->logNetwork(ERROR, "Invalid registry data for: " + registry.getRegistryId(), "Configuration");
 			}
-			errorCount++;
 			continue;
 		}
 
-		try {
-			std::vector<uint8_t> packetData = serializeRegistryPacket(registry);
-
-			Packet* registryPacket = new Packet(packet);
-
-			Buffer buffer;
-			buffer.writeBytes(packetData);
-
-			registryPacket->getData() = buffer;
-			registryPacket->setPacketSize(packetData.size());
-			registryPacket->setReturnPacket(PACKET_SEND);
-
-			outgoingPackets->push(registryPacket);
-			successCount++;
-
-			if (g_logger) {
-				g_logger->logNetwork(INFO,
-									 "Queued registry: " + registry.getRegistryId() + " (" + std::to_string(registry.getEntryCount()) + " entries)",
-									 "Configuration");
-			}
-
-		} catch (const std::exception& e) {
-			errorCount++;
-			if (g_logger) {
-				g_logger->logNetwork(
-						ERROR, "Exception while queuing registry " + registry.getRegistryId() + ": " + std::string(e.what()), "Configuration");
-			}
-		}
+		serializeRegistryPacket(registry, out);
+		encoded++;
 	}
 
 	if (g_logger) {
 		g_logger->logNetwork(INFO,
-							 "Registry data batch complete: " + std::to_string(successCount) + " sent, " + std::to_string(errorCount) + " errors",
+							 "Encoded " + std::to_string(encoded) + "/" + std::to_string(registries.size()) + " registry data frames",
 							 "Configuration");
 	}
-
-	packet.setReturnPacket((errorCount == 0) ? PACKET_OK : PACKET_ERROR);
+	return encoded;
 }
 
 std::vector<RegistryData> createAllEssentialRegistries() {
@@ -279,21 +208,21 @@ std::vector<RegistryData> createAllEssentialRegistries() {
 			g_logger->logNetwork(WARN, "parseMinecraftRegistries returned empty, using fallback method", "RegistryData");
 		}
 
-		std::vector<std::pair<std::string, std::map<std::string, uint32_t>>> registrySources = {
-				{"block", RegistryIds::getBlock()},
-				{"item", RegistryIds::getItem()},
-				{"entity_type", RegistryIds::getEntityType()},
-				{"sound_event", RegistryIds::getSoundEvent()},
-				{"particle_type", RegistryIds::getParticleType()},
-				{"mob_effect", RegistryIds::getMobEffect()},
-				{"block_entity_type", RegistryIds::getBlockEntityType()},
-				{"menu", RegistryIds::getMenu()},
-				{"recipe_type", RegistryIds::getRecipeType()},
-				{"recipe_serializer", RegistryIds::getRecipeSerializer()}};
+		std::vector<std::pair<std::string, const RegistryTable*>> registrySources = {
+				{"block", &RegistryIds::getBlock()},
+				{"item", &RegistryIds::getItem()},
+				{"entity_type", &RegistryIds::getEntityType()},
+				{"sound_event", &RegistryIds::getSoundEvent()},
+				{"particle_type", &RegistryIds::getParticleType()},
+				{"mob_effect", &RegistryIds::getMobEffect()},
+				{"block_entity_type", &RegistryIds::getBlockEntityType()},
+				{"menu", &RegistryIds::getMenu()},
+				{"recipe_type", &RegistryIds::getRecipeType()},
+				{"recipe_serializer", &RegistryIds::getRecipeSerializer()}};
 
 		for (const auto& source : registrySources) {
-			if (!source.second.empty()) {
-				RegistryData registry = createRegistryFromMap(source.first, source.second, true);
+			if (!source.second->empty()) {
+				RegistryData registry = createRegistryFromTable(source.first, *source.second, true);
 				registries.push_back(std::move(registry));
 			} else {
 				if (g_logger) {
@@ -316,3 +245,18 @@ std::vector<RegistryData> createAllEssentialRegistries() {
 
 	return registries;
 }
+
+int getSyncedEntryId(const std::string& registry, std::string_view entry) {
+	const Registry* reg = getRegistry(registry);
+	if (!reg) return -1;
+
+	for (size_t i = 0; i < reg->entries.size(); i++) {
+		if (reg->entries[i].name == entry) return static_cast<int>(i);
+	}
+	return -1;
+}
+
+size_t getSyncedEntryCount(const std::string& registry) {
+	const Registry* reg = getRegistry(registry);
+	return reg ? reg->entries.size() : 0;
+}
@@ -1,8 +1,71 @@
 #include "data/TagUtils.hpp"
 
+#include "data/RegistriesTag.hpp"
+#include "data/RegistryIds.hpp"
 #include "logger.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+	struct TagIndex {
+		std::vector<uint64_t>														words;
+		std::unordered_map<std::string, std::unordered_map<std::string, TagHandle>> handles; // registry -> tag -> handle
+	};
+
+	// Id space of a tagged registry: the whole registry when its size is known, otherwise the largest id referenced by a tag
+	uint32_t registryBits(const std::string& registryName, const std::vector<Tag>& tags) {
+		const RegistryTable* registry = RegistryIds::getRegistry(registryName);
+		uint32_t			 bits	  = registry ? static_cast<uint32_t>(registry->size()) : 1;
+		for (const auto& tag : tags) {
+			for (int entry : tag.entries) bits = std::max(bits, static_cast<uint32_t>(entry) + 1);
+		}
+		return bits;
+	}
+
+	TagIndex buildTagIndex() {
+		TagIndex index;
+
+		size_t totalWords = 0;
+		for (const auto& [registryName, tags] : RegistriesTags) totalWords += tags.size() * ((registryBits(registryName, tags) + 63) / 64);
+		index.words.assign(totalWords, 0);
+
+		uint32_t offset = 0;
+		for (const auto& [registryName, tags] : RegistriesTags) {
+			uint32_t bits  = registryBits(registryName, tags);
+			uint32_t words = (bits + 63) / 64;
+
+			auto& registryHandles = index.handles[registryName];
+			for (const auto& tag : tags) {
+				for (int entry : tag.entries) index.words[offset + (entry >> 6)] |= uint64_t(1) << (entry & 63);
+				registryHandles[tag.name] = TagHandle{offset, bits};
+				offset += words;
+			}
+		}
+		return index;
+	}
+
+	const TagIndex& tagIndex() {
+		static const TagIndex index = buildTagIndex();
+		return index;
+	}
+} // namespace
+
+void TagUtils::buildIndex() { s_tagBits.store(tagIndex().words.data(), std::memory_order_release); }
+
+TagHandle TagUtils::resolve(const std::string& registryName, const std::string& tagName) {
+	buildIndex();
+	const auto& handles	   = tagIndex().handles;
+	auto		registryIt = handles.find(registryName);
+	if (registryIt == handles.end()) return TagHandle{};
+	auto tagIt = registryIt->second.find(tagName);
+	if (tagIt == registryIt->second.end()) return TagHandle{};
+	return tagIt->second;
+}
 
 std::optional<std::vector<Tag>> TagUtils::getTagsForRegistry(const std::string& registryName) {
 	auto it = RegistriesTags.find(registryName);
@@ -23,15 +86,10 @@ std::optional<Tag> TagUtils::getTag(const std::string& registryName, const std::
 	return std::nullopt;
 }
 
-bool TagUtils::hasTag(const std::string& registryName, const std::string& tagName) { return getTag(registryName, tagName).has_value(); }
+bool TagUtils::hasTag(const std::string& registryName, const std::string& tagName) { return resolve(registryName, tagName).isValid(); }
 
 bool TagUtils::isInTag(const std::string& registryName, const std::string& tagName, int entryId) {
-	auto tag = getTag(registryName, tagName);
-	if (tag.has_value()) {
-		const auto& entries = tag->entries;
-		return std::find(entries.begin(), entries.end(), entryId) != entries.end();
-	}
-	return false;
+	return entryId >= 0 && contains(resolve(registryName, tagName), static_cast<uint32_t>(entryId));
 }
 
 std::vector<std::string> TagUtils::getAllRegistryNames() {
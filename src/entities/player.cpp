@@ -1,17 +1,26 @@
 #include "player.hpp"
 
 #include "lib/UUID.hpp"
+#include "network/chunk_view.hpp"
+#include "network/networking.hpp"
 #include "network/server.hpp"
+#include "network/spawn_preload.hpp"
+#include "network/task.hpp"
 
+#include <cstdint>
+#include <memory>
 #include <string>
 
 Player::Player(Server& server)
 	: _name("Player_entity"), _state(PlayerState::None), _socketFd(-1), x(0), y(0), z(0), health(0), _uuid(),
-	  _playerId(server.getIdManager().allocate()), _server(server), _config(new PlayerConfig()) {}
+	  _playerId(server.getIdManager().allocate()), _server(server), _config(new PlayerConfig()),
+	  _connection(std::make_shared<ConnectionStrand>(server.getNetworkManager())), _spawnPreload(), _chunkView(std::make_shared<ChunkView>()),
+	  _packetsRead(0) {}
 
 Player::Player(const std::string& name, const PlayerState state, const int socket, Server& server)
 	: _state(state), _socketFd(socket), x(0), y(0), z(0), health(20), _uuid(), _playerId(server.getIdManager().allocate()), _server(server),
-	  _config(new PlayerConfig()) {
+	  _config(new PlayerConfig()), _connection(std::make_shared<ConnectionStrand>(server.getNetworkManager())), _spawnPreload(),
+	  _chunkView(std::make_shared<ChunkView>()), _packetsRead(0) {
 	if (name.length() > 32)
 		_name = name.substr(0, 31);
 	else
@@ -31,6 +40,14 @@ Player& Player::operator=(const Player& src) {
 }
 
 Player::~Player() {
+	// Waits for a sequence running on the strand to suspend; a parked one wakes up, sees the closed strand and unwinds
+	_connection->close();
+	// Same for a sequence waiting on the spawn area
+	if (_spawnPreload) _spawnPreload->close();
+	// Chunk loads still queued for this player are dropped, callbacks already running send nothing
+	_chunkView->close(_server.getChunkLoader());
+	// Seat and configuration slot go to the next queued login, before the id can be handed out again
+	_server.getNetworkManager().getAdmission().release(_playerId);
 	_server.getIdManager().release(_playerId);
 	delete _config;
 }
@@ -46,6 +63,8 @@ void Player::setUUID(UUID uuid) { _uuid = uuid; }
 
 int Player::getPlayerID() const { return (_playerId); }
 
+void Player::deliverPacket(PlayerState state, uint32_t id) { _connection->deliverPacket(state, id); }
+
 // PlayerConfig implementation
 PlayerConfig::PlayerConfig()
 	: _chatMode(0), _mainHand(1), _locale("en_US"), _viewDistance(10), _displayedSkinParts(0), _chatColors(true), _enableTextFiltering(false),
@@ -1,6 +1,7 @@
 #include "network/buffer.hpp"
 
 #include "lib/UUID.hpp"
+#include "lib/nbtWriter.hpp"
 
 #include <cstdint>
 #include <stdexcept>
@@ -8,7 +9,8 @@
 #include <vector>
 
 Buffer::Buffer() : _pos(0) {}
-Buffer::Buffer(const std::vector<uint8_t>& data) : _data(data), _pos(0) {}
+Buffer::Buffer(const std::vector<uint8_t>& data) : _data(data.begin(), data.end()), _pos(0) {}
+Buffer::Buffer(std::pmr::memory_resource* resource) : _data(resource), _pos(0) {}
 
 uint8_t Buffer::readByte() {
 	if (_pos >= _data.size()) throw std::runtime_error("Buffer underflow on byte");
@@ -21,6 +23,10 @@ void Buffer::writeBytes(const std::string& data) { _data.insert(_data.end(), dat
 
 void Buffer::writeBytes(const std::vector<uint8_t>& data) { _data.insert(_data.end(), data.begin(), data.end()); }
 
+void Buffer::writeBytes(const std::pmr::vector<uint8_t>& data) { _data.insert(_data.end(), data.begin(), data.end()); }
+
+void Buffer::writeBytes(const uint8_t* data, size_t size) { _data.insert(_data.end(), data, data + size); }
+
 void Buffer::writeUUID(const UUID& uuid) {
 	uint64_t msb = uuid.getMostSigBits();
 	uint64_t lsb = uuid.getLeastSigBits();
@@ -98,10 +104,12 @@ void Buffer::writeString(const std::string& str) {
 	_data.insert(_data.end(), str.begin(), str.end());
 }
 
-std::vector<uint8_t>& Buffer::getData() { return _data; }
+std::pmr::vector<uint8_t>& Buffer::getData() { return _data; }
 
 size_t Buffer::remaining() const { return _data.size() - _pos; }
 
+void Buffer::reserve(size_t capacity) { _data.reserve(capacity); }
+
 uint16_t Buffer::readUShort() {
 	uint16_t val = (readByte() << 8) | readByte();
 	return val;
@@ -131,22 +139,10 @@ void Buffer::writeLong(long value) {
 
 void Buffer::writeBool(bool value) { writeByte(value ? 0x01 : 0x00); }
 
-void Buffer::writeNBT(const std::string& nbtData) {
-	// Format anonymousNbt pour MC 1.21.5 - compound NBT minimal mais valide
-	if (nbtData == "{}") {
-		// Compound NBT vide mais valide:
-		// TAG_String + nom vide + valeur vide + TAG_End
-		writeByte(0x08); // TAG_String
-		writeVarInt(0);	 // Nom de longueur 0 (anonyme)
-		writeVarInt(0);	 // Valeur string vide
-		writeByte(0x00); // TAG_End pour fermer le compound
-	} else {
-		// Pour autres données NBT, utiliser la même structure minimale
-		writeByte(0x08); // TAG_String
-		writeVarInt(0);	 // Nom de longueur 0
-		writeVarInt(0);	 // Valeur string vide
-		writeByte(0x00); // TAG_End
-	}
+void Buffer::writeNBT(const nbt::Tag& tag) {
+	nbt::Writer writer(*this, nbt::Writer::Format::Network);
+	writer.writeTag(tag);
+	writer.finish();
 }
 
 void Buffer::writePosition(int32_t x, int32_t y, int32_t z) {
@@ -172,6 +168,15 @@ void Buffer::writeDouble(double value) {
 	writeLong(u.i);
 }
 
+double Buffer::readDouble() {
+	union {
+		double	 d;
+		uint64_t i;
+	} u;
+	u.i = readUInt64();
+	return u.d;
+}
+
 void Buffer::writeVarLong(int64_t value) {
 	while (true) {
 		if ((value & ~0x7FL) == 0) {
@@ -209,6 +214,10 @@ std::vector<std::string> Buffer::readStringArray() {
 	if (count < 0) {
 		throw std::runtime_error("Negative array length");
 	}
+	// At least one byte per string: a count the packet cannot hold is rejected before reserving
+	if (static_cast<size_t>(count) > remaining()) {
+		throw std::runtime_error("Array length exceeds packet size");
+	}
 	std::vector<std::string> result;
 	result.reserve(count);
 	
@@ -224,6 +233,10 @@ std::vector<int> Buffer::readVarIntArray() {
 	if (count < 0) {
 		throw std::runtime_error("Negative array length");
 	}
+	// At least one byte per VarInt: a count the packet cannot hold is rejected before reserving
+	if (static_cast<size_t>(count) > remaining()) {
+		throw std::runtime_error("Array length exceeds packet size");
+	}
 	std::vector<int> result;
 	result.reserve(count);
 	
@@ -269,6 +282,10 @@ std::vector<Buffer::KnownPack> Buffer::readKnownPacks() {
 	if (count < 0) {
 		throw std::runtime_error("Negative array length");
 	}
+	// Three strings of at least their length byte each: a count the packet cannot hold is rejected before reserving
+	if (static_cast<size_t>(count) > remaining() / 3) {
+		throw std::runtime_error("Known pack count exceeds packet size");
+	}
 	std::vector<KnownPack> result;
 	result.reserve(count);
 	
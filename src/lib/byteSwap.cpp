@@ -0,0 +1,112 @@
+#include "lib/byteSwap.hpp"
+
+#include "lib/nbt.hpp" // std::byteswap fallback
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define NBT_BYTE_SWAP_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+	template <typename T> void swapScalar(uint8_t* dst, const uint8_t* src, size_t count) {
+		for (size_t i = 0; i < count; i++) {
+			T value;
+			std::memcpy(&value, src + i * sizeof(T), sizeof(T));
+			value = std::byteswap(value);
+			std::memcpy(dst + i * sizeof(T), &value, sizeof(T));
+		}
+	}
+
+	void swapScalar32(uint8_t* dst, const uint8_t* src, size_t count) { swapScalar<uint32_t>(dst, src, count); }
+	void swapScalar64(uint8_t* dst, const uint8_t* src, size_t count) { swapScalar<uint64_t>(dst, src, count); }
+
+#ifdef NBT_BYTE_SWAP_X86
+	// pshufb masks reversing each 4 or 8-byte lane of a 16-byte register
+	__attribute__((target("ssse3"))) __m128i swapMask128(size_t size) {
+		return size == 4 ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+						 : _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+	}
+
+	template <typename T> __attribute__((target("ssse3"))) void swapSsse3(uint8_t* dst, const uint8_t* src, size_t count) {
+		const __m128i mask	= swapMask128(sizeof(T));
+		size_t		  bytes = count * sizeof(T);
+		size_t		  i		= 0;
+		for (; i + 32 <= bytes; i += 32) {
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+			__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(a, mask));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 16), _mm_shuffle_epi8(b, mask));
+		}
+		for (; i + 16 <= bytes; i += 16) {
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(a, mask));
+		}
+		swapScalar<T>(dst + i, src + i, (bytes - i) / sizeof(T));
+	}
+
+	// vpshufb shuffles within 128-bit lanes, the same mask is used for both halves
+	template <typename T> __attribute__((target("avx2"))) void swapAvx2(uint8_t* dst, const uint8_t* src, size_t count) {
+		const __m256i mask	= _mm256_broadcastsi128_si256(swapMask128(sizeof(T)));
+		size_t		  bytes = count * sizeof(T);
+		size_t		  i		= 0;
+		for (; i + 64 <= bytes; i += 64) {
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 32));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_shuffle_epi8(a, mask));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 32), _mm256_shuffle_epi8(b, mask));
+		}
+		for (; i + 32 <= bytes; i += 32) {
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_shuffle_epi8(a, mask));
+		}
+		swapScalar<T>(dst + i, src + i, (bytes - i) / sizeof(T));
+	}
+#endif
+
+	struct Kernels {
+		void (*swap32)(uint8_t*, const uint8_t*, size_t);
+		void (*swap64)(uint8_t*, const uint8_t*, size_t);
+		const char* name;
+	};
+
+	Kernels selectKernels() {
+#ifdef NBT_BYTE_SWAP_X86
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2")) return Kernels{swapAvx2<uint32_t>, swapAvx2<uint64_t>, "avx2"};
+		if (__builtin_cpu_supports("ssse3")) return Kernels{swapSsse3<uint32_t>, swapSsse3<uint64_t>, "ssse3"};
+#endif
+		return Kernels{swapScalar32, swapScalar64, "scalar"};
+	}
+
+	const Kernels& kernels() {
+		static const Kernels selected = selectKernels();
+		return selected;
+	}
+} // namespace
+
+namespace nbt {
+
+	void byteSwapCopy32(void* dst, const void* src, size_t count) {
+		if constexpr (std::endian::native == std::endian::big) {
+			if (dst != src) std::memmove(dst, src, count * 4);
+		} else {
+			kernels().swap32(static_cast<uint8_t*>(dst), static_cast<const uint8_t*>(src), count);
+		}
+	}
+
+	void byteSwapCopy64(void* dst, const void* src, size_t count) {
+		if constexpr (std::endian::native == std::endian::big) {
+			if (dst != src) std::memmove(dst, src, count * 8);
+		} else {
+			kernels().swap64(static_cast<uint8_t*>(dst), static_cast<const uint8_t*>(src), count);
+		}
+	}
+
+	const char* byteSwapKernel() { return std::endian::native == std::endian::big ? "none" : kernels().name; }
+
+} // namespace nbt
@@ -11,7 +11,8 @@ using json = nlohmann::json;
 
 Config::Config()
 	: _execPath(getPath()), _gameVersion("1.21.5"), _protocolVersion(770), _serverMotd("A Minecraft Server"), _serverAddress("127.0.0.1"),
-	  _serverPort(25565), _serverSize(20), _worldName("world"), _gamemode("survival"), _difficulty("normal") {}
+	  _serverPort(25565), _serverSize(20), _worldName("world"), _gamemode("survival"), _difficulty("normal"),
+	  _chunkCacheSize(256), _regionCompression("deflate"), _viewDistance(10) {}
 
 bool Config::loadConfig() {
 	std::ifstream inputFile(_execPath.parent_path() / "config.json"); // Should change the config path later if needed
@@ -34,6 +35,9 @@ bool Config::loadConfig() {
 		Config::setWorldName(config["world"]["name"]);
 		Config::setGamemode(config["world"]["gamemode"]);
 		Config::setDifficulty(config["world"]["difficulty"]);
+		Config::setChunkCacheSize(config["world"].value("chunk-cache-mb", _chunkCacheSize));
+		Config::setRegionCompression(config["world"].value("region-compression", _regionCompression));
+		Config::setViewDistance(config["world"].value("view-distance", _viewDistance));
 	} catch (json::parse_error& e) {
 		g_logger->logGameInfo(ERROR, "Error parsing config.json: " + std::string(e.what()), "SERVER");
 		inputFile.close();
@@ -91,6 +95,12 @@ std::string Config::getGamemode() { return _gamemode; }
 
 std::string Config::getDifficulty() { return _difficulty; }
 
+int Config::getChunkCacheSize() { return _chunkCacheSize; }
+
+std::string Config::getRegionCompression() { return _regionCompression; }
+
+int Config::getViewDistance() { return _viewDistance; }
+
 // Setter methods
 void Config::setProtocolVersion(int ProtoVersion) { _protocolVersion = ProtoVersion; }
 
@@ -109,3 +119,9 @@ void Config::setWorldName(std::string WorldName) { _worldName = WorldName; }
 void Config::setGamemode(std::string Gamemode) { _gamemode = Gamemode; }
 
 void Config::setDifficulty(std::string Difficulty) { _difficulty = Difficulty; }
+
+void Config::setChunkCacheSize(int ChunkCacheSize) { _chunkCacheSize = ChunkCacheSize; }
+
+void Config::setRegionCompression(std::string RegionCompression) { _regionCompression = RegionCompression; }
+
+void Config::setViewDistance(int ViewDistance) { _viewDistance = ViewDistance; }
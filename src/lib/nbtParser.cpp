@@ -1,11 +1,16 @@
 #include "lib/nbtParser.hpp"
 
+#include "lib/byteSwap.hpp"
+
+#include <algorithm>
 #include <bit>
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -26,7 +31,7 @@ namespace {
 
 namespace nbt {
 
-	NBT Parser::parse(const std::vector<uint8_t>& data) {
+	NBT Parser::parse(const std::vector<uint8_t>& data) const {
 		if (data.empty()) {
 			throw std::runtime_error("NBT parsing error: empty data.");
 		}
@@ -38,13 +43,32 @@ namespace nbt {
 			throw std::runtime_error("NBT parsing error: root must be a TAG_Compound.");
 		}
 
-		std::string rootName = parseTagName(data, cursor);
-		TagCompound rootComp = parseCompound(data, cursor);
+		// Nodes take about three times the bytes of their binary form: most documents fit in the first block, the
+		// others get small extra blocks rather than a doubled one
+		Arena*						 arena = new Arena(data.size() * 3, data.size() / 4);
+		std::shared_ptr<TagCompound> rootCompound;
+		try {
+			rootCompound = arena->make<TagCompound>();
+		} catch (...) {
+			delete arena;
+			throw;
+		}
+
+		// Declared after the root: on a throw, pending entries go before the arena
+		Document	document{*arena, {}};
+		std::string rootName = std::string(parseTagName(document, data, cursor));
+		parseCompound(document, data, cursor, *rootCompound);
+
+		return NBT(rootName, std::move(rootCompound));
+	}
 
-		return NBT(rootName, rootComp);
+	void Parser::need(const std::vector<uint8_t>& data, size_t cursor, size_t bytes) const {
+		if (bytes > data.size() - cursor) {
+			throw std::runtime_error("NBT parsing error: unexpected end of data.");
+		}
 	}
 
-	template <typename T> T Parser::read(const std::vector<uint8_t>& data, size_t& cursor) {
+	template <typename T> T Parser::read(const std::vector<uint8_t>& data, size_t& cursor) const {
 		if (cursor + sizeof(T) > data.size()) {
 			throw std::runtime_error("NBT parsing error: unexpected end of data.");
 		}
@@ -61,44 +85,49 @@ namespace nbt {
 	}
 
 	// Explicit instantiations for the types we use
-	template int8_t	  Parser::read<int8_t>(const std::vector<uint8_t>&, size_t&);
-	template uint8_t  Parser::read<uint8_t>(const std::vector<uint8_t>&, size_t&);
-	template int16_t  Parser::read<int16_t>(const std::vector<uint8_t>&, size_t&);
-	template uint16_t Parser::read<uint16_t>(const std::vector<uint8_t>&, size_t&);
-	template int32_t  Parser::read<int32_t>(const std::vector<uint8_t>&, size_t&);
-	template uint32_t Parser::read<uint32_t>(const std::vector<uint8_t>&, size_t&);
-	template int64_t  Parser::read<int64_t>(const std::vector<uint8_t>&, size_t&);
-	template uint64_t Parser::read<uint64_t>(const std::vector<uint8_t>&, size_t&);
-
-	std::string Parser::parseTagName(const std::vector<uint8_t>& data, size_t& cursor) {
+	template int8_t	  Parser::read<int8_t>(const std::vector<uint8_t>&, size_t&) const;
+	template uint8_t  Parser::read<uint8_t>(const std::vector<uint8_t>&, size_t&) const;
+	template int16_t  Parser::read<int16_t>(const std::vector<uint8_t>&, size_t&) const;
+	template uint16_t Parser::read<uint16_t>(const std::vector<uint8_t>&, size_t&) const;
+	template int32_t  Parser::read<int32_t>(const std::vector<uint8_t>&, size_t&) const;
+	template uint32_t Parser::read<uint32_t>(const std::vector<uint8_t>&, size_t&) const;
+	template int64_t  Parser::read<int64_t>(const std::vector<uint8_t>&, size_t&) const;
+	template uint64_t Parser::read<uint64_t>(const std::vector<uint8_t>&, size_t&) const;
+
+	TagString Parser::parseTagName(Document& document, const std::vector<uint8_t>& data, size_t& cursor) const {
 		uint16_t length = read<uint16_t>(data, cursor);
-		if (length == 0) {
-			return "";
-		}
 		if (cursor + length > data.size()) {
 			throw std::runtime_error("NBT parsing error: invalid tag name length.");
 		}
-		std::string name(data.begin() + cursor, data.begin() + cursor + length);
+		TagString name(reinterpret_cast<const char*>(data.data() + cursor), length, &document.arena);
 		cursor += length;
 		return name;
 	}
 
-	TagCompound Parser::parseCompound(const std::vector<uint8_t>& data, size_t& cursor) {
-		TagCompound compound;
+	// Entries are staged on `document.pending` until the end tag: the compound then gets a single exact-size block, where
+	// growing it in place would leave every outgrown block behind in the arena
+	void Parser::parseCompound(Document& document, const std::vector<uint8_t>& data, size_t& cursor, TagCompound& compound) const {
+		size_t first = document.pending.size();
 		while (cursor < data.size()) {
 			uint8_t tagType = read<uint8_t>(data, cursor);
 			if (tagType == TAG_END) {
 				break;
 			}
 
-			std::string tagName = parseTagName(data, cursor);
-			compound[tagName]	= parseTag(data, cursor, tagType);
+			TagString tagName = parseTagName(document, data, cursor);
+			Tag		  tag	  = parseTag(document, data, cursor, tagType);
+			document.pending.emplace_back(std::move(tagName), std::move(tag));
 		}
-		return compound;
+
+		compound.data.reserve(document.pending.size() - first);
+		for (size_t i = first; i < document.pending.size(); ++i) {
+			compound.data.appendUnsorted(std::move(document.pending[i].first), std::move(document.pending[i].second));
+		}
+		document.pending.erase(document.pending.begin() + static_cast<std::ptrdiff_t>(first), document.pending.end());
+		compound.data.sortEntries();
 	}
 
-	TagList Parser::parseList(const std::vector<uint8_t>& data, size_t& cursor) {
-		TagList list;
+	void Parser::parseList(Document& document, const std::vector<uint8_t>& data, size_t& cursor, TagList& list) const {
 		uint8_t listType = read<uint8_t>(data, cursor);
 		int32_t length	 = read<int32_t>(data, cursor);
 
@@ -106,13 +135,14 @@ namespace nbt {
 			throw std::runtime_error("NBT parsing error: negative TAG_List length.");
 		}
 
+		// Every element takes at least a byte, a larger count is corrupted data
+		list.data.reserve(std::min<size_t>(static_cast<size_t>(length), data.size() - cursor));
 		for (int32_t i = 0; i < length; ++i) {
-			list.push_back(parseTag(data, cursor, listType));
+			list.push_back(parseTag(document, data, cursor, listType));
 		}
-		return list;
 	}
 
-	Tag Parser::parseTag(const std::vector<uint8_t>& data, size_t& cursor, uint8_t tagType) {
+	Tag Parser::parseTag(Document& document, const std::vector<uint8_t>& data, size_t& cursor, uint8_t tagType) const {
 		switch (tagType) {
 		case TAG_BYTE:
 			return Tag(read<TagByte>(data, cursor));
@@ -131,51 +161,53 @@ namespace nbt {
 			if (cursor + length > data.size()) {
 				throw std::runtime_error("NBT parsing error: invalid string length.");
 			}
-			std::string str(data.begin() + cursor, data.begin() + cursor + length);
+			TagString str(reinterpret_cast<const char*>(data.data() + cursor), length, &document.arena);
 			cursor += length;
-			return Tag(str);
+			return Tag(std::move(str));
 		}
 		case TAG_BYTE_ARRAY: {
 			int32_t length = read<int32_t>(data, cursor);
 			if (length < 0) {
 				throw std::runtime_error("NBT parsing error: negative TAG_Byte_Array length.");
 			}
-			TagByteArray array;
-			if (length > 0) {
-				array.resize(static_cast<size_t>(length));
-				std::memcpy(array.data(), &data[cursor], static_cast<size_t>(length));
-				cursor += static_cast<size_t>(length);
-			}
-			return Tag(array);
+			need(data, cursor, static_cast<size_t>(length));
+			TagByteArray array(reinterpret_cast<const TagByte*>(data.data() + cursor),
+							   reinterpret_cast<const TagByte*>(data.data() + cursor) + length, &document.arena);
+			cursor += static_cast<size_t>(length);
+			return Tag(std::move(array));
 		}
 		case TAG_INT_ARRAY: {
 			int32_t length = read<int32_t>(data, cursor);
 			if (length < 0) {
 				throw std::runtime_error("NBT parsing error: negative TAG_Int_Array length.");
 			}
-			TagIntArray array;
-			array.reserve(static_cast<size_t>(length));
-			for (int32_t i = 0; i < length; ++i) {
-				array.push_back(read<TagInt>(data, cursor));
-			}
-			return Tag(array);
+			need(data, cursor, static_cast<size_t>(length) * sizeof(TagInt));
+			TagIntArray array(static_cast<size_t>(length), &document.arena);
+			byteSwapCopy(array.data(), data.data() + cursor, array.size());
+			cursor += array.size() * sizeof(TagInt);
+			return Tag(std::move(array));
 		}
 		case TAG_LONG_ARRAY: {
 			int32_t length = read<int32_t>(data, cursor);
 			if (length < 0) {
 				throw std::runtime_error("NBT parsing error: negative TAG_Long_Array length.");
 			}
-			TagLongArray array;
-			array.reserve(static_cast<size_t>(length));
-			for (int32_t i = 0; i < length; ++i) {
-				array.push_back(read<TagLong>(data, cursor));
-			}
-			return Tag(array);
+			need(data, cursor, static_cast<size_t>(length) * sizeof(TagLong));
+			TagLongArray array(static_cast<size_t>(length), &document.arena);
+			byteSwapCopy(array.data(), data.data() + cursor, array.size());
+			cursor += array.size() * sizeof(TagLong);
+			return Tag(std::move(array));
+		}
+		case TAG_LIST: {
+			std::shared_ptr<TagList> list = document.arena.make<TagList>();
+			parseList(document, data, cursor, *list);
+			return Tag(std::move(list));
+		}
+		case TAG_COMPOUND: {
+			std::shared_ptr<TagCompound> compound = document.arena.make<TagCompound>();
+			parseCompound(document, data, cursor, *compound);
+			return Tag(std::move(compound));
 		}
-		case TAG_LIST:
-			return Tag(std::make_shared<TagList>(parseList(data, cursor)));
-		case TAG_COMPOUND:
-			return Tag(std::make_shared<TagCompound>(parseCompound(data, cursor)));
 		default:
 			throw std::runtime_error("NBT parsing error: unsupported tag type: " + std::to_string(tagType));
 		}
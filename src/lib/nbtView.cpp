@@ -0,0 +1,289 @@
+#include "lib/nbtView.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+	template <typename T> T readBigEndian(const uint8_t* p) {
+		T value;
+		std::memcpy(&value, p, sizeof(T));
+		if constexpr (sizeof(T) > 1 && std::endian::native == std::endian::little) value = std::byteswap(value);
+		return value;
+	}
+
+	const char* typeName(uint8_t type) {
+		static const char* const names[] = {"End", "Byte", "Short", "Int", "Long", "Float", "Double", "Byte_Array", "String", "List", "Compound", "Int_Array", "Long_Array"};
+		return type < sizeof(names) / sizeof(names[0]) ? names[type] : "unknown";
+	}
+} // namespace
+
+namespace nbt {
+
+	// ========================================
+	// View
+	// ========================================
+
+	View::View(std::span<const uint8_t> data) : _data(data), _nodes() {
+		if (data.empty()) throw std::runtime_error("NBT parsing error: empty data.");
+		if (data.size() >= NONE) throw std::runtime_error("NBT parsing error: document larger than 4 GiB.");
+
+		size_t cursor = 0;
+		if (data[cursor++] != TAG_COMPOUND) throw std::runtime_error("NBT parsing error: root must be a TAG_Compound.");
+
+		need(cursor, 2);
+		uint16_t nameLength = readBigEndian<uint16_t>(data.data() + cursor);
+		cursor += 2;
+		need(cursor, nameLength);
+
+		// A chunk averages a tag per ~40 bytes, one reservation covers most documents
+		_nodes.reserve(data.size() / 32 + 16);
+		uint32_t root = addNode(TAG_COMPOUND, cursor, nameLength);
+		cursor += nameLength;
+		indexPayload(root, cursor, 0);
+	}
+
+	void View::need(size_t cursor, size_t bytes) const {
+		if (bytes > _data.size() - cursor) throw std::runtime_error("NBT parsing error: unexpected end of data.");
+	}
+
+	// Offset one past the payload of `node`. Only lists and compounds need a walk, down their last child.
+	size_t View::payloadEnd(uint32_t node) const {
+		const Node& n = _nodes[node];
+		switch (n.type) {
+		case TAG_BYTE:
+			return n.payload + 1;
+		case TAG_SHORT:
+			return n.payload + 2;
+		case TAG_INT:
+		case TAG_FLOAT:
+			return n.payload + 4;
+		case TAG_LONG:
+		case TAG_DOUBLE:
+			return n.payload + 8;
+		case TAG_BYTE_ARRAY:
+		case TAG_STRING:
+			return n.payload + n.length;
+		case TAG_INT_ARRAY:
+			return n.payload + static_cast<size_t>(n.length) * 4;
+		case TAG_LONG_ARRAY:
+			return n.payload + static_cast<size_t>(n.length) * 8;
+		default:
+			break;
+		}
+
+		uint32_t last = n.firstChild;
+		if (last == NONE) return n.payload + (n.type == TAG_LIST ? 5 : 1); // element type + length, or TAG_END
+		while (_nodes[last].nextSibling != NONE) last = _nodes[last].nextSibling;
+		return payloadEnd(last) + (n.type == TAG_COMPOUND ? 1 : 0);
+	}
+
+	uint32_t View::addNode(uint8_t type, size_t nameOffset, uint16_t nameLength) {
+		_nodes.push_back(Node{static_cast<uint32_t>(nameOffset), 0, 0, NONE, NONE, nameLength, type, TAG_END});
+		return static_cast<uint32_t>(_nodes.size() - 1);
+	}
+
+	// `_nodes` grows while children are indexed: nodes are always addressed by index, never kept by reference
+	void View::indexPayload(uint32_t node, size_t& cursor, int depth) {
+		if (depth > MAX_DEPTH) throw std::runtime_error("NBT parsing error: nesting deeper than " + std::to_string(MAX_DEPTH));
+
+		uint8_t type		 = _nodes[node].type;
+		_nodes[node].payload = static_cast<uint32_t>(cursor);
+
+		auto readLength = [&]() {
+			need(cursor, 4);
+			int32_t length = readBigEndian<int32_t>(_data.data() + cursor);
+			cursor += 4;
+			if (length < 0) throw std::runtime_error("NBT parsing error: negative length in TAG_" + std::string(typeName(type)) + ".");
+			return static_cast<uint32_t>(length);
+		};
+		auto skipArray = [&](size_t elementSize) {
+			uint32_t length = readLength();
+			need(cursor, static_cast<size_t>(length) * elementSize);
+			// Payload starts after the length prefix
+			_nodes[node].payload = static_cast<uint32_t>(cursor);
+			_nodes[node].length	 = length;
+			cursor += static_cast<size_t>(length) * elementSize;
+		};
+
+		switch (type) {
+		case TAG_BYTE:
+			need(cursor, 1);
+			cursor += 1;
+			break;
+		case TAG_SHORT:
+			need(cursor, 2);
+			cursor += 2;
+			break;
+		case TAG_INT:
+		case TAG_FLOAT:
+			need(cursor, 4);
+			cursor += 4;
+			break;
+		case TAG_LONG:
+		case TAG_DOUBLE:
+			need(cursor, 8);
+			cursor += 8;
+			break;
+		case TAG_BYTE_ARRAY:
+			skipArray(1);
+			break;
+		case TAG_INT_ARRAY:
+			skipArray(4);
+			break;
+		case TAG_LONG_ARRAY:
+			skipArray(8);
+			break;
+		case TAG_STRING: {
+			need(cursor, 2);
+			uint16_t length = readBigEndian<uint16_t>(_data.data() + cursor);
+			cursor += 2;
+			need(cursor, length);
+			_nodes[node].payload = static_cast<uint32_t>(cursor);
+			_nodes[node].length	 = length;
+			cursor += length;
+			break;
+		}
+		case TAG_LIST: {
+			need(cursor, 1);
+			uint8_t elementType = _data[cursor++];
+			uint32_t length		= readLength();
+			if (length > 0 && (elementType == TAG_END || elementType > TAG_LONG_ARRAY))
+				throw std::runtime_error("NBT parsing error: unsupported tag type: " + std::to_string(elementType));
+			_nodes[node].elementType = elementType;
+			_nodes[node].length		 = length;
+
+			uint32_t last = NONE;
+			for (uint32_t i = 0; i < length; i++) {
+				uint32_t child = addNode(elementType, 0, 0);
+				(last == NONE ? _nodes[node].firstChild : _nodes[last].nextSibling) = child;
+				last = child;
+				indexPayload(child, cursor, depth + 1);
+			}
+			break;
+		}
+		case TAG_COMPOUND: {
+			uint32_t last  = NONE;
+			uint32_t count = 0;
+			while (true) {
+				need(cursor, 1);
+				uint8_t childType = _data[cursor++];
+				if (childType == TAG_END) break;
+				if (childType > TAG_LONG_ARRAY) throw std::runtime_error("NBT parsing error: unsupported tag type: " + std::to_string(childType));
+
+				need(cursor, 2);
+				uint16_t nameLength = readBigEndian<uint16_t>(_data.data() + cursor);
+				cursor += 2;
+				need(cursor, nameLength);
+
+				uint32_t child = addNode(childType, cursor, nameLength);
+				cursor += nameLength;
+				(last == NONE ? _nodes[node].firstChild : _nodes[last].nextSibling) = child;
+				last = child;
+				count++;
+				indexPayload(child, cursor, depth + 1);
+			}
+			_nodes[node].length = count;
+			break;
+		}
+		default:
+			throw std::runtime_error("NBT parsing error: unsupported tag type: " + std::to_string(type));
+		}
+	}
+
+	// ========================================
+	// TagView
+	// ========================================
+
+	uint8_t TagView::getType() const { return _view ? _view->_nodes[_index].type : View::TAG_END; }
+
+	std::string_view TagView::getName() const {
+		if (!_view) return {};
+		const View::Node& node = _view->_nodes[_index];
+		return std::string_view(reinterpret_cast<const char*>(_view->_data.data() + node.nameOffset), node.nameLength);
+	}
+
+	const uint8_t* TagView::payload(uint8_t expectedType) const {
+		if (!_view) throw std::runtime_error("NBT view: missing tag, expected TAG_" + std::string(typeName(expectedType)));
+		const View::Node& node = _view->_nodes[_index];
+		if (node.type != expectedType)
+			throw std::runtime_error("NBT view: TAG_" + std::string(typeName(node.type)) + " '" + std::string(getName()) + "' is not a TAG_" +
+									 typeName(expectedType));
+		return _view->_data.data() + node.payload;
+	}
+
+	int8_t TagView::asByte() const { return readBigEndian<int8_t>(payload(View::TAG_BYTE)); }
+	int16_t TagView::asShort() const { return readBigEndian<int16_t>(payload(View::TAG_SHORT)); }
+	int32_t TagView::asInt() const { return readBigEndian<int32_t>(payload(View::TAG_INT)); }
+	int64_t TagView::asLong() const { return readBigEndian<int64_t>(payload(View::TAG_LONG)); }
+	float	TagView::asFloat() const { return std::bit_cast<float>(readBigEndian<uint32_t>(payload(View::TAG_FLOAT))); }
+	double	TagView::asDouble() const { return std::bit_cast<double>(readBigEndian<uint64_t>(payload(View::TAG_DOUBLE))); }
+
+	std::string_view TagView::asString() const {
+		const uint8_t* data = payload(View::TAG_STRING);
+		return std::string_view(reinterpret_cast<const char*>(data), _view->_nodes[_index].length);
+	}
+
+	std::span<const int8_t> TagView::asByteArray() const {
+		const uint8_t* data = payload(View::TAG_BYTE_ARRAY);
+		return std::span<const int8_t>(reinterpret_cast<const int8_t*>(data), _view->_nodes[_index].length);
+	}
+
+	BigEndianArray<int32_t> TagView::asIntArray() const {
+		const uint8_t* data = payload(View::TAG_INT_ARRAY);
+		return BigEndianArray<int32_t>(std::span<const uint8_t>(data, static_cast<size_t>(_view->_nodes[_index].length) * 4));
+	}
+
+	BigEndianArray<int64_t> TagView::asLongArray() const {
+		const uint8_t* data = payload(View::TAG_LONG_ARRAY);
+		return BigEndianArray<int64_t>(std::span<const uint8_t>(data, static_cast<size_t>(_view->_nodes[_index].length) * 8));
+	}
+
+	TagView TagView::operator[](std::string_view name) const {
+		if (!_view || _view->_nodes[_index].type != View::TAG_COMPOUND) return {};
+		for (uint32_t child = _view->_nodes[_index].firstChild; child != View::NONE; child = _view->_nodes[child].nextSibling) {
+			if (TagView(_view, child).getName() == name) return TagView(_view, child);
+		}
+		return {};
+	}
+
+	TagView TagView::at(size_t index) const {
+		if (!_view || _view->_nodes[_index].type != View::TAG_LIST || index >= _view->_nodes[_index].length) return {};
+		uint32_t child = _view->_nodes[_index].firstChild;
+		while (index-- > 0) child = _view->_nodes[child].nextSibling;
+		return TagView(_view, child);
+	}
+
+	uint8_t TagView::getElementType() const { return _view ? _view->_nodes[_index].elementType : View::TAG_END; }
+
+	size_t TagView::size() const {
+		if (!_view) return 0;
+		const View::Node& node = _view->_nodes[_index];
+		return node.type == View::TAG_LIST || node.type == View::TAG_COMPOUND ? node.length : 0;
+	}
+
+	std::span<const uint8_t> TagView::getRawPayload() const {
+		if (!_view) return {};
+		size_t begin = _view->_nodes[_index].payload;
+		return _view->_data.subspan(begin, _view->payloadEnd(_index) - begin);
+	}
+
+	TagView::Iterator TagView::begin() const {
+		if (!_view || (_view->_nodes[_index].type != View::TAG_LIST && _view->_nodes[_index].type != View::TAG_COMPOUND)) return end();
+		return Iterator(_view, _view->_nodes[_index].firstChild);
+	}
+
+	TagView::Iterator TagView::end() const { return Iterator(_view, View::NONE); }
+
+	TagView::Iterator& TagView::Iterator::operator++() {
+		_index = _view->_nodes[_index].nextSibling;
+		return *this;
+	}
+
+} // namespace nbt
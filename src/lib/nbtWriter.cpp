@@ -0,0 +1,390 @@
+#include "lib/nbtWriter.hpp"
+
+#include "lib/byteSwap.hpp"
+#include "network/buffer.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace {
+	// Arrays and lists carry their length as a signed 32-bit int
+	int32_t lengthOf(size_t count, const char* what) {
+		if (count > static_cast<size_t>(INT32_MAX)) throw std::runtime_error(std::string("NBT writer: ") + what + " too long");
+		return static_cast<int32_t>(count);
+	}
+
+	// Java's modified UTF-8 only differs from UTF-8 for NUL and 4-byte sequences
+	bool needsModifiedUtf8(std::string_view value) {
+		for (unsigned char c : value) {
+			if (c == 0 || c >= 0xF0) return true;
+		}
+		return false;
+	}
+
+	// NUL becomes C0 80 and a 4-byte sequence becomes its UTF-16 surrogate pair, each encoded on 3 bytes
+	std::string toModifiedUtf8(std::string_view value) {
+		std::string out;
+		out.reserve(value.size() + 8);
+		auto putSurrogate = [&out](uint32_t unit) {
+			out.push_back(static_cast<char>(0xE0 | (unit >> 12)));
+			out.push_back(static_cast<char>(0x80 | ((unit >> 6) & 0x3F)));
+			out.push_back(static_cast<char>(0x80 | (unit & 0x3F)));
+		};
+		for (size_t i = 0; i < value.size(); i++) {
+			unsigned char c = static_cast<unsigned char>(value[i]);
+			if (c == 0) {
+				out.push_back(static_cast<char>(0xC0));
+				out.push_back(static_cast<char>(0x80));
+			} else if (c >= 0xF0 && i + 3 < value.size()) {
+				uint32_t codePoint = ((c & 0x07u) << 18) | ((static_cast<unsigned char>(value[i + 1]) & 0x3Fu) << 12) |
+									 ((static_cast<unsigned char>(value[i + 2]) & 0x3Fu) << 6) | (static_cast<unsigned char>(value[i + 3]) & 0x3Fu);
+				codePoint -= 0x10000;
+				putSurrogate(0xD800 | (codePoint >> 10));
+				putSurrogate(0xDC00 | (codePoint & 0x3FF));
+				i += 3;
+			} else {
+				out.push_back(static_cast<char>(c));
+			}
+		}
+		return out;
+	}
+} // namespace
+
+namespace nbt {
+
+	Writer::Writer(Buffer& out, Format format)
+		: _out(&out.getData()), _stream(nullptr), _staging(), _format(format), _stack(), _rootWritten(false) {
+		_stack.reserve(16);
+	}
+
+	Writer::Writer(std::ostream& out, Format format)
+		: _out(&_staging), _stream(&out), _staging(), _format(format), _stack(), _rootWritten(false) {
+		_staging.reserve(STREAM_BLOCK + STREAM_BLOCK / 4);
+		_stack.reserve(16);
+	}
+
+	// Best effort only: errors and unclosed tags are reported by finish()
+	Writer::~Writer() {
+		if (_stream) flush();
+	}
+
+	void Writer::finish() {
+		if (!_stack.empty()) throw std::runtime_error("NBT writer: " + std::to_string(_stack.size()) + " tag(s) left open");
+		if (_stream) {
+			flush();
+			if (!*_stream) throw std::runtime_error("NBT writer: failed to write to the output stream");
+		}
+	}
+
+	void Writer::flush() {
+		_stream->write(reinterpret_cast<const char*>(_staging.data()), static_cast<std::streamsize>(_staging.size()));
+		_staging.clear();
+	}
+
+	void Writer::flushIfFull() {
+		if (_stream && _staging.size() >= STREAM_BLOCK) flush();
+	}
+
+	// ========================================
+	// Raw output
+	// ========================================
+
+	void Writer::putBytes(const void* data, size_t size) {
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		_out->insert(_out->end(), bytes, bytes + size);
+	}
+
+	template <typename T> void Writer::put(T value) {
+		if constexpr (sizeof(T) > 1 && std::endian::native == std::endian::little) value = std::byteswap(value);
+		size_t offset = _out->size();
+		_out->resize(offset + sizeof(T));
+		std::memcpy(_out->data() + offset, &value, sizeof(T));
+	}
+
+	// One resize for the whole array, then a bulk swap into place
+	template <typename T> void Writer::putArray(std::span<const T> values) {
+		put<int32_t>(lengthOf(values.size(), "array"));
+		size_t offset = _out->size();
+		_out->resize(offset + values.size() * sizeof(T));
+		byteSwapCopy(reinterpret_cast<T*>(_out->data() + offset), values.data(), values.size());
+	}
+
+	void Writer::putName(std::string_view name) { putString(name); }
+
+	void Writer::putString(std::string_view value) {
+		if (needsModifiedUtf8(value)) {
+			std::string encoded = toModifiedUtf8(value);
+			if (encoded.size() > UINT16_MAX) throw std::runtime_error("NBT writer: string longer than 65535 bytes");
+			put<uint16_t>(static_cast<uint16_t>(encoded.size()));
+			putBytes(encoded.data(), encoded.size());
+			return;
+		}
+		if (value.size() > UINT16_MAX) throw std::runtime_error("NBT writer: string longer than 65535 bytes");
+		put<uint16_t>(static_cast<uint16_t>(value.size()));
+		putBytes(value.data(), value.size());
+	}
+
+	// ========================================
+	// Structure
+	// ========================================
+
+	// Type and name of the next value, as its parent expects them
+	void Writer::header(uint8_t type, std::string_view name) {
+		if (_stack.empty()) {
+			if (_rootWritten) throw std::runtime_error("NBT writer: a document has a single root tag");
+			_rootWritten = true;
+			put<uint8_t>(type);
+			if (_format == Format::Disk) {
+				putName(name);
+			} else if (!name.empty()) {
+				throw std::runtime_error("NBT writer: network roots have no name");
+			}
+			return;
+		}
+
+		Frame& parent = _stack.back();
+		if (parent.type == TAG_COMPOUND) {
+			put<uint8_t>(type);
+			putName(name);
+			flushIfFull();
+			return;
+		}
+		if (!name.empty()) throw std::runtime_error("NBT writer: list elements have no name");
+		if (type != parent.elementType)
+			throw std::runtime_error("NBT writer: list element type " + std::to_string(type) + ", expected " + std::to_string(parent.elementType));
+		if (parent.remaining <= 0) throw std::runtime_error("NBT writer: more list elements than announced");
+		parent.remaining--;
+		flushIfFull();
+	}
+
+	void Writer::pushFrame(uint8_t type, uint8_t elementType, int32_t count) {
+		if (_stack.size() >= MAX_DEPTH) throw std::runtime_error("NBT writer: nesting deeper than " + std::to_string(MAX_DEPTH));
+		_stack.push_back(Frame{type, elementType, count});
+	}
+
+	void Writer::popFrame(uint8_t type) {
+		if (_stack.empty() || _stack.back().type != type) throw std::runtime_error("NBT writer: end of a tag that is not open");
+		if (type == TAG_LIST && _stack.back().remaining != 0)
+			throw std::runtime_error("NBT writer: " + std::to_string(_stack.back().remaining) + " list element(s) missing");
+		_stack.pop_back();
+	}
+
+	void Writer::beginCompound(std::string_view name) {
+		header(TAG_COMPOUND, name);
+		pushFrame(TAG_COMPOUND, TAG_END, 0);
+	}
+
+	void Writer::endCompound() {
+		popFrame(TAG_COMPOUND);
+		put<uint8_t>(TAG_END);
+	}
+
+	void Writer::beginList(std::string_view name, uint8_t elementType, size_t count) {
+		if (elementType > TAG_LONG_ARRAY || (elementType == TAG_END && count != 0))
+			throw std::runtime_error("NBT writer: invalid list element type " + std::to_string(elementType));
+		int32_t length = lengthOf(count, "list");
+		header(TAG_LIST, name);
+		put<uint8_t>(elementType);
+		put<int32_t>(length);
+		pushFrame(TAG_LIST, elementType, length);
+	}
+
+	void Writer::endList() { popFrame(TAG_LIST); }
+
+	// ========================================
+	// Values
+	// ========================================
+
+	void Writer::writeByte(std::string_view name, int8_t value) {
+		header(TAG_BYTE, name);
+		put<int8_t>(value);
+	}
+
+	void Writer::writeShort(std::string_view name, int16_t value) {
+		header(TAG_SHORT, name);
+		put<int16_t>(value);
+	}
+
+	void Writer::writeInt(std::string_view name, int32_t value) {
+		header(TAG_INT, name);
+		put<int32_t>(value);
+	}
+
+	void Writer::writeLong(std::string_view name, int64_t value) {
+		header(TAG_LONG, name);
+		put<int64_t>(value);
+	}
+
+	void Writer::writeFloat(std::string_view name, float value) {
+		header(TAG_FLOAT, name);
+		put<uint32_t>(std::bit_cast<uint32_t>(value));
+	}
+
+	void Writer::writeDouble(std::string_view name, double value) {
+		header(TAG_DOUBLE, name);
+		put<uint64_t>(std::bit_cast<uint64_t>(value));
+	}
+
+	void Writer::writeString(std::string_view name, std::string_view value) {
+		header(TAG_STRING, name);
+		putString(value);
+	}
+
+	void Writer::writeByteArray(std::string_view name, std::span<const int8_t> values) {
+		header(TAG_BYTE_ARRAY, name);
+		put<int32_t>(lengthOf(values.size(), "array"));
+		putBytes(values.data(), values.size());
+	}
+
+	void Writer::writeIntArray(std::string_view name, std::span<const int32_t> values) {
+		header(TAG_INT_ARRAY, name);
+		putArray<int32_t>(values);
+	}
+
+	void Writer::writeLongArray(std::string_view name, std::span<const int64_t> values) {
+		header(TAG_LONG_ARRAY, name);
+		putArray<int64_t>(values);
+	}
+
+	void Writer::writeIntArray(std::string_view name, const BigEndianArray<int32_t>& values) {
+		header(TAG_INT_ARRAY, name);
+		put<int32_t>(lengthOf(values.size(), "array"));
+		putBytes(values.bytes().data(), values.bytes().size());
+	}
+
+	void Writer::writeLongArray(std::string_view name, const BigEndianArray<int64_t>& values) {
+		header(TAG_LONG_ARRAY, name);
+		put<int32_t>(lengthOf(values.size(), "array"));
+		putBytes(values.bytes().data(), values.bytes().size());
+	}
+
+	// ========================================
+	// Trees
+	// ========================================
+
+	namespace {
+		// Tag's alternatives are declared in type id order: End, Byte, Short, Int, Long, Float, Double, Byte_Array,
+		// String, List, Compound, Int_Array, Long_Array
+		static_assert(std::variant_size_v<decltype(Tag::data)> == Writer::TAG_LONG_ARRAY + 1);
+		static_assert(std::is_same_v<std::variant_alternative_t<Writer::TAG_COMPOUND, decltype(Tag::data)>, std::shared_ptr<TagCompound>>);
+
+		uint8_t typeOf(const Tag& tag) { return static_cast<uint8_t>(tag.data.index()); }
+	} // namespace
+
+	void Writer::writeTag(std::string_view name, const Tag& tag) {
+		uint8_t type = typeOf(tag);
+		if (type == TAG_END) throw std::runtime_error("NBT writer: TAG_End is not a value");
+		header(type, name);
+		putPayload(tag);
+	}
+
+	void Writer::writeCompound(std::string_view name, const TagCompound& compound) {
+		header(TAG_COMPOUND, name);
+		putCompound(compound);
+	}
+
+	void Writer::writeList(std::string_view name, const TagList& list) {
+		header(TAG_LIST, name);
+		putList(list);
+	}
+
+	void Writer::putPayload(const Tag& tag) {
+		std::visit(
+			[this](const auto& value) {
+				using T = std::decay_t<decltype(value)>;
+				if constexpr (std::is_same_v<T, TagByte> || std::is_same_v<T, TagShort> || std::is_same_v<T, TagInt> || std::is_same_v<T, TagLong>) {
+					put<T>(value);
+				} else if constexpr (std::is_same_v<T, TagFloat>) {
+					put<uint32_t>(std::bit_cast<uint32_t>(value));
+				} else if constexpr (std::is_same_v<T, TagDouble>) {
+					put<uint64_t>(std::bit_cast<uint64_t>(value));
+				} else if constexpr (std::is_same_v<T, TagString>) {
+					putString(value);
+				} else if constexpr (std::is_same_v<T, TagByteArray>) {
+					put<int32_t>(lengthOf(value.size(), "array"));
+					putBytes(value.data(), value.size());
+				} else if constexpr (std::is_same_v<T, TagIntArray> || std::is_same_v<T, TagLongArray>) {
+					putArray<typename T::value_type>(std::span<const typename T::value_type>(value.data(), value.size()));
+				} else if constexpr (std::is_same_v<T, std::shared_ptr<TagList>>) {
+					if (value) {
+						putList(*value);
+					} else {
+						put<uint8_t>(TAG_END);
+						put<int32_t>(0);
+					}
+				} else if constexpr (std::is_same_v<T, std::shared_ptr<TagCompound>>) {
+					if (value) {
+						putCompound(*value);
+					} else {
+						put<uint8_t>(TAG_END);
+					}
+				}
+			},
+			tag.data);
+	}
+
+	void Writer::putCompound(const TagCompound& compound) {
+		pushFrame(TAG_COMPOUND, TAG_END, 0);
+		for (const auto& [name, tag] : compound) {
+			if (typeOf(tag) == TAG_END) continue; // placeholder entries (operator[] on a missing key) are not values
+			writeTag(name, tag);
+		}
+		popFrame(TAG_COMPOUND);
+		put<uint8_t>(TAG_END);
+	}
+
+	void Writer::putList(const TagList& list) {
+		uint8_t elementType = list.data.empty() ? TAG_END : typeOf(list.data.front());
+		if (elementType == TAG_END && !list.data.empty()) throw std::runtime_error("NBT writer: list of TAG_End");
+		int32_t length = lengthOf(list.data.size(), "list");
+		put<uint8_t>(elementType);
+		put<int32_t>(length);
+		pushFrame(TAG_LIST, elementType, length);
+		for (const Tag& element : list.data) {
+			// header() rejects lists mixing element types
+			header(typeOf(element), {});
+			putPayload(element);
+		}
+		popFrame(TAG_LIST);
+	}
+
+	// ========================================
+	// nbt.hpp encoders
+	// ========================================
+
+	void Tag::encode(std::ostream& os) const {
+		Writer writer(os, Writer::Format::Network);
+		writer.writeTag(*this);
+		writer.finish();
+	}
+
+	void TagList::encode(std::ostream& os) const {
+		Writer writer(os, Writer::Format::Network);
+		writer.writeList({}, *this);
+		writer.finish();
+	}
+
+	void TagCompound::encode(std::ostream& os) const {
+		Writer writer(os, Writer::Format::Network);
+		writer.writeCompound({}, *this);
+		writer.finish();
+	}
+
+	void NBT::encode(std::ostream& os) const {
+		Writer writer(os, Writer::Format::Disk);
+		writer.writeCompound(name, getRoot());
+		writer.finish();
+	}
+
+} // namespace nbt
@@ -14,6 +14,7 @@
 #include <sys/poll.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <utility>
 #include <vector>
 
 using json = nlohmann::json;
@@ -21,8 +22,12 @@ using json = nlohmann::json;
 Packet::~Packet() {}
 
 Packet::Packet(const Packet& other)
-	: _size(other._size), _id(other._id), _data(other._data), _player(other._player), _socketFd(other._socketFd), _returnPacket(other._returnPacket) {
-}
+	: _size(other._size), _id(other._id), _data(other._data), _player(other._player), _socketFd(other._socketFd), _returnPacket(other._returnPacket),
+	  _shared(other._shared), _sequence(other._sequence) {}
+
+Packet::Packet(const Packet& route, std::shared_ptr<const std::vector<uint8_t>> payload)
+	: _size(static_cast<int32_t>(payload->size())), _id(route._id), _data(), _player(route._player), _socketFd(route._socketFd),
+	  _returnPacket(PACKET_SEND), _shared(std::move(payload)), _sequence(route._sequence) {}
 
 Packet& Packet::operator=(const Packet& other) {
 	if (this != &other) {
@@ -32,13 +37,16 @@ Packet& Packet::operator=(const Packet& other) {
 		_player		  = other._player;
 		_socketFd	  = other._socketFd;
 		_returnPacket = other._returnPacket;
+		_shared		  = other._shared;
+		_sequence	  = other._sequence;
 	}
 	return (*this);
 }
 
-Packet::Packet(Player* player) : _player(player), _socketFd(-1), _returnPacket(0) {
+Packet::Packet(Player* player) : _player(player), _socketFd(-1), _returnPacket(0), _sequence(0) {
 	if (_player == nullptr) throw std::runtime_error("Packet init with null player");
 	_socketFd = _player->getSocketFd();
+	_sequence = _player->nextPacketSequence();
 	// g_logger->logNetwork(INFO, "Constructor: Socket FD = " + std::to_string(_socketFd),
 	// "Packet");
 
@@ -77,7 +85,7 @@ Packet::Packet(Player* player) : _player(player), _socketFd(-1), _returnPacket(0
 	}
 }
 
-Packet::Packet(int socketFd, Server& server) : _player(nullptr), _socketFd(socketFd), _returnPacket(0) {
+Packet::Packet(int socketFd, Server& server) : _player(nullptr), _socketFd(socketFd), _returnPacket(0), _sequence(0) {
 	// g_logger->logNetwork(INFO, "Constructor (socket): Socket FD = " + std::to_string(_socketFd),
 	// "Packet");
 
@@ -233,5 +241,8 @@ uint32_t Packet::getSize() { return (_size); }
 uint32_t Packet::getId() { return (_id); }
 Buffer&	 Packet::getData() { return (_data); }
 int		 Packet::getSocket() const { return (_socketFd); };
+uint64_t Packet::getSequence() const { return (_sequence); }
 void	 Packet::setPacketSize(int32_t value) { _size = value; }
 void	 Packet::setPacketId(uint32_t value) { _id = value; }
+
+const uint8_t* Packet::getWireData() { return _shared ? _shared->data() : _data.getData().data(); }
@@ -0,0 +1,51 @@
+#include "network/scratch_arena.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+namespace {
+	thread_local ScratchArena* t_currentArena = nullptr;
+}
+
+void* ScratchArena::OverflowResource::do_allocate(size_t bytes, size_t alignment) {
+	_spilled += bytes;
+	return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void ScratchArena::OverflowResource::do_deallocate(void* p, size_t bytes, size_t alignment) {
+	std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+}
+
+ScratchArena::ScratchArena(size_t capacity)
+	: _storage(new std::byte[capacity]), _capacity(capacity), _upstream(), _resource(), _previous(t_currentArena) {
+	_resource.emplace(_storage.get(), _capacity, &_upstream);
+	t_currentArena = this;
+}
+
+ScratchArena::~ScratchArena() {
+	_resource.reset();
+	t_currentArena = _previous;
+}
+
+void ScratchArena::reset() {
+	if (_upstream.spilled() == 0 || _capacity >= MAX_CAPACITY) {
+		_resource->release();
+		_upstream.clear();
+		return;
+	}
+
+	// The last packet did not fit: size the inline block for it so the next one does
+	size_t wanted = std::min(MAX_CAPACITY, _capacity + _upstream.spilled());
+	_resource.reset();
+	_upstream.clear();
+	_storage.reset(new std::byte[wanted]);
+	_capacity = wanted;
+	_resource.emplace(_storage.get(), _capacity, &_upstream);
+}
+
+std::pmr::memory_resource* ScratchArena::current() {
+	if (t_currentArena) return t_currentArena->resource();
+	return std::pmr::get_default_resource();
+}
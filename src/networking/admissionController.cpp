@@ -0,0 +1,158 @@
+#include "logger.hpp"
+#include "network/admission.hpp"
+#include "network/buffer.hpp"
+#include "network/networking.hpp"
+#include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
+#include "network/task.hpp"
+#include "player.hpp"
+
+#include <algorithm>
+#include <coroutine>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+AdmissionController::AdmissionController(NetworkManager& network, size_t maxPlayers, size_t maxConcurrent)
+	: _network(network), _maxPlayers(maxPlayers), _maxConcurrent(std::max<size_t>(1, maxConcurrent)), _lock(), _entries(), _queue(),
+	  _configuring(0), _messageId(0) {}
+
+AdmissionController::~AdmissionController() {}
+
+AdmissionController::Seat AdmissionController::reserve(Player& player, const Packet& route) {
+	std::lock_guard<std::mutex> lock(_lock);
+
+	if (_entries.size() >= _maxPlayers) return Seat::ServerFull;
+
+	if (_configuring < _maxConcurrent && _queue.empty()) {
+		_configuring++;
+		_entries.emplace(player.getPlayerID(), Entry{Phase::Configuring, player.getConnectionToken(), nullptr, nullptr});
+		return Seat::Admitted;
+	}
+
+	_entries.emplace(player.getPlayerID(), Entry{Phase::Queued, player.getConnectionToken(), std::make_unique<Packet>(route), nullptr});
+	_queue.push_back(player.getPlayerID());
+	g_logger->logNetwork(INFO,
+						 player.getPlayerName() + " queued for login at position " + std::to_string(_queue.size()) + " (" +
+								 std::to_string(_configuring) + " configuring)",
+						 "Admission");
+	return Seat::Queued;
+}
+
+void AdmissionController::finishConfiguration(const Player& player) {
+	std::vector<Waiter> waiters;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		auto						it = _entries.find(player.getPlayerID());
+		if (it == _entries.end() || it->second.phase != Phase::Configuring) return;
+		it->second.phase = Phase::Playing;
+		_configuring--;
+		waiters = promoteLocked();
+	}
+	resumeAll(waiters);
+}
+
+void AdmissionController::release(int playerId) {
+	std::vector<Waiter> waiters;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		auto						it = _entries.find(playerId);
+		if (it == _entries.end()) return;
+
+		if (it->second.phase == Phase::Queued) {
+			_queue.erase(std::remove(_queue.begin(), _queue.end(), playerId), _queue.end());
+			// The parked login sequence wakes up on a dead token and unwinds
+			if (it->second.waiter) waiters.emplace_back(it->second.connection, it->second.waiter);
+		} else if (it->second.phase == Phase::Configuring) {
+			_configuring--;
+		}
+		_entries.erase(it);
+
+		std::vector<Waiter> promoted = promoteLocked();
+		waiters.insert(waiters.end(), promoted.begin(), promoted.end());
+	}
+	resumeAll(waiters);
+}
+
+std::vector<AdmissionController::Waiter> AdmissionController::promoteLocked() {
+	std::vector<Waiter> waiters;
+
+	while (_configuring < _maxConcurrent && !_queue.empty()) {
+		auto it = _entries.find(_queue.front());
+		_queue.pop_front();
+		if (it == _entries.end()) continue;
+
+		Entry& entry = it->second;
+		entry.phase	 = Phase::Configuring;
+		entry.route.reset();
+		_configuring++;
+		// No waiter yet: the sequence has not suspended, await_suspend sees the new phase and carries on
+		if (entry.waiter) waiters.emplace_back(entry.connection, std::exchange(entry.waiter, nullptr));
+	}
+	return waiters;
+}
+
+void AdmissionController::resumeAll(const std::vector<Waiter>& waiters) {
+	for (const auto& [connection, waiter] : waiters) connection->resume(waiter);
+}
+
+void AdmissionController::broadcastQueuePositions() {
+	std::lock_guard<std::mutex> lock(_lock);
+
+	int position = 0;
+	for (int playerId : _queue) {
+		position++;
+		auto it = _entries.find(playerId);
+		if (it == _entries.end() || !it->second.connection->isOpen() || !it->second.route) continue;
+
+		// Login Plugin Request: message id, channel, then our payload (position, queue length)
+		Buffer payload(ScratchArena::current());
+		payload.writeVarInt(0x04);
+		payload.writeVarInt(static_cast<int>(_messageId++ & 0x7FFFFFFF));
+		payload.writeString(QUEUE_CHANNEL);
+		payload.writeVarInt(position);
+		payload.writeVarInt(static_cast<int>(_queue.size()));
+
+		Buffer final(ScratchArena::current());
+		final.writeVarInt(payload.getData().size());
+		final.writeBytes(payload.getData());
+
+		Packet* update	  = new Packet(*it->second.route);
+		update->getData() = final;
+		update->setPacketSize(final.getData().size());
+		update->setReturnPacket(PACKET_SEND);
+		_network.getOutgoingQueue()->push(update);
+	}
+}
+
+size_t AdmissionController::getQueueLength() {
+	std::lock_guard<std::mutex> lock(_lock);
+	return _queue.size();
+}
+
+// ========================================
+// Awaiter
+// ========================================
+
+AdmissionController::Awaiter::Awaiter(AdmissionController& controller, Player& player)
+	: _controller(controller), _playerId(player.getPlayerID()), _connection(player.getConnectionToken()) {}
+
+bool AdmissionController::Awaiter::await_ready() {
+	std::lock_guard<std::mutex> lock(_controller._lock);
+	auto						it = _controller._entries.find(_playerId);
+	return it == _controller._entries.end() || it->second.phase != Phase::Queued;
+}
+
+bool AdmissionController::Awaiter::await_suspend(std::coroutine_handle<> handle) {
+	std::lock_guard<std::mutex> lock(_controller._lock);
+	auto						it = _controller._entries.find(_playerId);
+	if (it == _controller._entries.end() || it->second.phase != Phase::Queued) return false;
+	it->second.waiter = handle;
+	return true;
+}
+
+void AdmissionController::Awaiter::await_resume() const {
+	if (!_connection->isOpen()) throw ConnectionClosed();
+}
@@ -0,0 +1,228 @@
+#include "network/chunk_view.hpp"
+
+#include "logger.hpp"
+#include "network/buffer.hpp"
+#include "network/networking.hpp"
+#include "network/server.hpp"
+#include "player.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+	// Block coordinates past the world border (30M blocks) are not chunk positions a client can stand in
+	constexpr double MAX_COORDINATE = 30000000.0;
+
+	int chebyshev(const ChunkView::Offset& offset) { return std::max(std::abs(offset.dx), std::abs(offset.dz)); }
+
+	void pushFrames(Server& server, const Packet& route, Buffer& frames) {
+		const auto& bytes = frames.getData();
+		if (bytes.empty()) return;
+		auto payload = std::make_shared<const std::vector<uint8_t>>(bytes.begin(), bytes.end());
+		server.getNetworkManager().getOutgoingQueue()->push(new Packet(route, std::move(payload)));
+	}
+} // namespace
+
+ChunkView::ChunkView() : _lock(), _started(false), _closed(false), _centerX(0), _centerZ(0), _radius(0), _lastMove(0), _sent(), _loading() {}
+
+int ChunkView::getViewDistance(int requested, int serverMax) {
+	int cap = std::clamp(serverMax, MIN_VIEW_DISTANCE, MAX_VIEW_DISTANCE);
+	return std::clamp(requested, MIN_VIEW_DISTANCE, cap);
+}
+
+const std::vector<ChunkView::Offset>& ChunkView::spiralOrder() {
+	static const std::vector<Offset> order = []() {
+		std::vector<Offset> offsets;
+		offsets.reserve((2 * MAX_VIEW_DISTANCE + 1) * (2 * MAX_VIEW_DISTANCE + 1));
+		for (int dz = -MAX_VIEW_DISTANCE; dz <= MAX_VIEW_DISTANCE; dz++) {
+			for (int dx = -MAX_VIEW_DISTANCE; dx <= MAX_VIEW_DISTANCE; dx++) offsets.push_back(Offset{dx, dz});
+		}
+		// Euclidean rings, each walked by angle: the client sees the terrain fill in around it
+		std::stable_sort(offsets.begin(), offsets.end(), [](const Offset& a, const Offset& b) {
+			int distanceA = a.dx * a.dx + a.dz * a.dz;
+			int distanceB = b.dx * b.dx + b.dz * b.dz;
+			if (distanceA != distanceB) return distanceA < distanceB;
+			return std::atan2(a.dz, a.dx) < std::atan2(b.dz, b.dx);
+		});
+		return offsets;
+	}();
+	return order;
+}
+
+// ========================================
+// View updates
+// ========================================
+
+void ChunkView::start(const Packet& route, Server& server, int centerX, int centerZ, int sentRadius) {
+	Player* player = route.getPlayer();
+	if (!player) return;
+	int radius = getViewDistance(player->getPlayerConfig()->getViewDistance(), server.getConfig().getViewDistance());
+
+	std::unique_lock<std::mutex> lock(_lock);
+	if (_started || _closed) return;
+	_started = true;
+	_centerX = centerX;
+	_centerZ = centerZ;
+	_radius	 = sentRadius;
+	for (int x = centerX - sentRadius; x <= centerX + sentRadius; x++) {
+		for (int z = centerZ - sentRadius; z <= centerZ + sentRadius; z++) _sent.insert(World::ChunkKey{World::Dimension::Overworld, x, z});
+	}
+	update(lock, route, server, centerX, centerZ, radius);
+}
+
+void ChunkView::moveTo(const Packet& route, Server& server, double x, double z) {
+	if (!std::isfinite(x) || !std::isfinite(z) || std::abs(x) > MAX_COORDINATE || std::abs(z) > MAX_COORDINATE) return;
+	Player* player = route.getPlayer();
+	if (!player) return;
+
+	int chunkX = static_cast<int>(std::floor(x)) >> 4;
+	int chunkZ = static_cast<int>(std::floor(z)) >> 4;
+	int radius = getViewDistance(player->getPlayerConfig()->getViewDistance(), server.getConfig().getViewDistance());
+
+	std::unique_lock<std::mutex> lock(_lock);
+	if (!_started || _closed || route.getSequence() <= _lastMove) return;
+	_lastMove = route.getSequence();
+	if (chunkX == _centerX && chunkZ == _centerZ && radius == _radius) return;
+	update(lock, route, server, chunkX, chunkZ, radius);
+}
+
+void ChunkView::update(std::unique_lock<std::mutex>& lock, const Packet& route, Server& server, int centerX, int centerZ, int radius) {
+	auto inView = [centerX, centerZ, radius](int x, int z) { return std::abs(x - centerX) <= radius && std::abs(z - centerZ) <= radius; };
+
+	// Blocking and chunk I/O threads have no scratch arena, this Buffer is heap backed
+	Buffer frames;
+	if (centerX != _centerX || centerZ != _centerZ) writeSetCenterFrame(frames, centerX, centerZ);
+
+	// 1. Leaving: the old square minus the new one. Sent chunks are forgotten, loading ones cancelled.
+	std::vector<std::pair<World::ChunkTicket, std::shared_ptr<Batch>>> cancelled;
+	size_t															   forgotten = 0;
+	for (int x = _centerX - _radius; x <= _centerX + _radius; x++) {
+		for (int z = _centerZ - _radius; z <= _centerZ + _radius; z++) {
+			if (inView(x, z)) continue;
+			World::ChunkKey key{World::Dimension::Overworld, x, z};
+			if (_sent.erase(key)) {
+				writeForgetLevelChunkFrame(frames, x, z);
+				forgotten++;
+				continue;
+			}
+			auto loading = _loading.find(key);
+			if (loading == _loading.end()) continue;
+			// Without a ticket the request is still being made: its callback runs and drops the chunk
+			if (loading->second.ticket.isValid()) cancelled.emplace_back(loading->second.ticket, loading->second.batch);
+			_loading.erase(loading);
+		}
+	}
+
+	// 2. Entering: every chunk of the new square the client neither holds nor waits for, closest first
+	auto											  batch = std::make_shared<Batch>(route);
+	std::vector<std::pair<World::ChunkKey, uint32_t>> entering;
+	for (const Offset& offset : spiralOrder()) {
+		if (chebyshev(offset) > radius) continue;
+		World::ChunkKey key{World::Dimension::Overworld, centerX + offset.dx, centerZ + offset.dz};
+		if (_sent.contains(key) || _loading.contains(key)) continue;
+		_loading.emplace(key, Loading{World::ChunkTicket{}, batch});
+		// Same scale as the ring distance of the spawn preload; requests of equal priority are served in order
+		entering.emplace_back(key, static_cast<uint32_t>(std::sqrt(offset.dx * offset.dx + offset.dz * offset.dz)));
+	}
+	batch->pending = static_cast<int>(entering.size());
+	if (!entering.empty()) writeChunkBatchStartFrame(frames);
+
+	_centerX = centerX;
+	_centerZ = centerZ;
+	_radius	 = radius;
+	pushFrames(server, route, frames);
+	lock.unlock();
+
+	if (forgotten || !entering.empty()) {
+		g_logger->logNetwork(DEBUG,
+							 "View of " + route.getPlayer()->getPlayerName() + " moved to chunk (" + std::to_string(centerX) + ", " +
+									 std::to_string(centerZ) + "), radius " + std::to_string(radius) + ": " + std::to_string(entering.size()) +
+									 " chunks entering, " + std::to_string(forgotten) + " forgotten",
+							 "ChunkView");
+	}
+
+	World::ChunkLoader& loader = server.getChunkLoader();
+	for (const auto& [ticket, owner] : cancelled) {
+		// A callback already running answers for its chunk itself
+		if (!loader.cancel(ticket)) continue;
+		std::lock_guard<std::mutex> relock(_lock);
+		if (--owner->pending == 0) finishBatch(server, *owner);
+	}
+
+	// 3. Chunks go out as they are loaded; the callbacks own the view, which outlives a player that disconnects
+	std::shared_ptr<ChunkView> self = shared_from_this();
+	for (const auto& [key, priority] : entering) {
+		World::ChunkTicket ticket = loader.request(key, priority, [self, &server, batch, key](World::ChunkCache::ChunkRef chunk) {
+			self->chunkLoaded(server, batch, key, std::move(chunk));
+		});
+
+		std::lock_guard<std::mutex> relock(_lock);
+		auto						loading = _loading.find(key);
+		if (loading != _loading.end() && loading->second.batch == batch) loading->second.ticket = ticket;
+	}
+}
+
+void ChunkView::chunkLoaded(Server& server, const std::shared_ptr<Batch>& batch, const World::ChunkKey& key, World::ChunkCache::ChunkRef chunk) {
+	// Encoded once per chunk version, every player in range queues the same bytes
+	std::shared_ptr<const std::vector<uint8_t>> payload;
+	try {
+		if (chunk) payload = getChunkDataFrame(*chunk);
+	} catch (const std::exception& e) {
+		g_logger->logNetwork(ERROR, "Error encoding chunk (" + std::to_string(key.x) + ", " + std::to_string(key.z) + "): " + e.what(), "ChunkView");
+	}
+
+	std::lock_guard<std::mutex> lock(_lock);
+	if (_closed) return;
+
+	// Dropped when the chunk left the view while it was loading, or another batch already sent it. A chunk that left
+	// and came back belongs to the newer batch: that one sends it.
+	auto loading = _loading.find(key);
+	if (loading != _loading.end() && loading->second.batch == batch) {
+		_loading.erase(loading);
+		if (payload) {
+			server.getNetworkManager().getOutgoingQueue()->push(new Packet(batch->route, std::move(payload)));
+			_sent.insert(key);
+			batch->sent++;
+		}
+	}
+	if (--batch->pending == 0) finishBatch(server, *batch);
+}
+
+void ChunkView::finishBatch(Server& server, Batch& batch) {
+	if (_closed) return;
+	Buffer frame;
+	writeChunkBatchFinishedFrame(frame, batch.sent);
+	pushFrames(server, batch.route, frame);
+}
+
+void ChunkView::close(World::ChunkLoader& loader) {
+	std::vector<World::ChunkTicket> tickets;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		_closed = true;
+		for (const auto& [key, loading] : _loading) {
+			if (loading.ticket.isValid()) tickets.push_back(loading.ticket);
+		}
+		_loading.clear();
+		_sent.clear();
+	}
+	for (const World::ChunkTicket& ticket : tickets) loader.cancel(ticket);
+}
+
+bool ChunkView::contains(int chunkX, int chunkZ) {
+	std::lock_guard<std::mutex> lock(_lock);
+	return _sent.contains(World::ChunkKey{World::Dimension::Overworld, chunkX, chunkZ});
+}
+
+int ChunkView::getRadius() {
+	std::lock_guard<std::mutex> lock(_lock);
+	return _radius;
+}
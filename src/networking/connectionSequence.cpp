@@ -0,0 +1,135 @@
+#include "data/ConfigurationCache.hpp"
+#include "logger.hpp"
+#include "network/networking.hpp"
+#include "network/packet.hpp"
+#include "network/server.hpp"
+#include "network/spawn_preload.hpp"
+#include "network/task.hpp"
+#include "player.hpp"
+
+#include <exception>
+#include <memory>
+#include <string>
+
+namespace {
+	// Builds one clientbound packet from the sequence template and queues it
+	template <typename Writer> void queuePacket(const Packet& templatePacket, Server& server, Writer&& write) {
+		Packet* p = new Packet(templatePacket);
+		write(*p);
+		server.getNetworkManager().getOutgoingQueue()->push(p);
+	}
+
+	// Configuration slot of a player, handed back to the admission queue when the configuration phase ends, however
+	// it ends. Once the strand is closed the Player is gone and its destructor already released the slot.
+	class ConfigurationSlot {
+	  private:
+		AdmissionController& _admission;
+		Player&				 _player;
+		ConnectionToken		 _connection;
+
+	  public:
+		ConfigurationSlot(AdmissionController& admission, Player& player)
+			: _admission(admission), _player(player), _connection(player.getConnectionToken()) {}
+		~ConfigurationSlot() {
+			if (_connection->isOpen()) _admission.finishConfiguration(_player);
+		}
+
+		ConfigurationSlot(const ConfigurationSlot&)			   = delete;
+		ConfigurationSlot& operator=(const ConfigurationSlot&) = delete;
+	};
+} // namespace
+
+// ========================================
+// Login Sequence
+// ========================================
+
+Task runLoginSequence(Packet packet, Server& server) {
+	Player* player = packet.getPlayer();
+	if (!player) co_return;
+
+	// Queued logins park here, holding nothing but their seat
+	co_await server.getNetworkManager().getAdmission().waitForTurn(*player);
+
+	// Player data and the spawn chunk ring load on the blocking pool while login and configuration go on
+	player->setSpawnPreload(SpawnPreload::start(server, player->getUUID()));
+	queuePacket(packet, server, [player](Packet& p) { writeLoginSuccess(p, *player); });
+}
+
+// ========================================
+// Configuration -> Play Sequence
+// ========================================
+
+Task runConfigurationSequence(Packet packet, Server& server, bool clientHasCorePack) {
+	Player* player = packet.getPlayer();
+	if (!player) {
+		g_logger->logNetwork(ERROR, "No player found for configuration sequence", "Configuration");
+		co_return;
+	}
+
+	g_logger->logNetwork(INFO, "=== Starting Complete Configuration Sequence ===", "Configuration");
+
+	// Normally started at Login Start and already done by the time the client acknowledges the configuration
+	std::shared_ptr<SpawnPreload> spawnArea = player->getSpawnPreload();
+	if (!spawnArea) {
+		spawnArea = SpawnPreload::start(server, player->getUUID());
+		player->setSpawnPreload(spawnArea);
+	}
+
+	{
+		ConfigurationSlot slot(server.getNetworkManager().getAdmission(), *player);
+		try {
+			// 1-2. Registry Data frames followed by Update Tags, pre-encoded at startup and shared by every login
+			if (!clientHasCorePack) {
+				g_logger->logNetwork(WARN, "Client does not share the core pack, it may not resolve the registry entry IDs", "Configuration");
+			}
+			g_logger->logNetwork(INFO, "Step 1: Sending Registry Data and Update Tags", "Configuration");
+			server.getNetworkManager().getOutgoingQueue()->push(new Packet(packet, server.getConfigurationCache().getFrames()));
+
+			// 3. Send Finish Configuration and yield the worker until the client acknowledges it
+			g_logger->logNetwork(INFO, "Step 3: Sending Finish Configuration", "Configuration");
+			ClientPacketAwaiter finishAck(*player, PlayerState::Configuration, 0x03);
+			queuePacket(packet, server, [&server](Packet& p) { handleFinishConfiguration(p, server); });
+			co_await finishAck;
+		} catch (const ConnectionClosed&) {
+			throw;
+		} catch (const std::exception& e) {
+			g_logger->logNetwork(ERROR, "Error in configuration sequence: " + std::string(e.what()), "Configuration");
+			co_return;
+		}
+		g_logger->logNetwork(INFO, "=== Configuration Sequence Completed Successfully ===", "Configuration");
+	}
+
+	co_await SpawnPreload::ready(spawnArea, player->getConnectionToken());
+	const SpawnPoint spawn = spawnArea->getSpawnPoint();
+
+	// Client is in Play now
+	// 1. Send Login (play) packet - 0x2B
+	g_logger->logNetwork(INFO, "Sending Login (play) packet", "PacketRouter");
+	queuePacket(packet, server, [&server](Packet& p) { writePlayPacket(p, server); });
+
+	// 2. Send Change Difficulty - 0x0A
+	g_logger->logNetwork(INFO, "Sending Change Difficulty packet", "PacketRouter");
+	queuePacket(packet, server, [](Packet& p) { changeDifficulty(p); });
+
+	// 3. Send Player Abilities - 0x39
+	g_logger->logNetwork(INFO, "Sending Player Abilities packet", "PacketRouter");
+	queuePacket(packet, server, [](Packet& p) { playerAbilities(p); });
+	queuePacket(packet, server, [](Packet& p) { setHeldItem(p); });
+
+	// 4. Send player position and look - 0x41, then wait for the teleport confirmation
+	ClientPacketAwaiter teleportAck(*player, PlayerState::Play, 0x00);
+	queuePacket(packet, server, [&server, &spawn](Packet& p) { sendPlayerPositionAndLook(p, server, spawn); });
+
+	// 5. First chunk batch, encoded during the configuration phase
+	if (spawnArea->getChunkFrames()) {
+		g_logger->logNetwork(INFO, "Sending spawn chunk batch (" + std::to_string(spawnArea->getChunkCount()) + " chunks)", "PacketRouter");
+		server.getNetworkManager().getOutgoingQueue()->push(new Packet(packet, spawnArea->getChunkFrames()));
+	}
+	// 6. The rest of the view distance of the client, then every chunk the player walks into
+	sendChunkBatchSequence(packet, server, *spawnArea);
+	co_await teleportAck;
+
+	// 7. Send Game Event packet - 0x22
+	g_logger->logNetwork(INFO, "Sending Game Event packet", "PacketRouter");
+	queuePacket(packet, server, [&server](Packet& p) { gameEventPacket(p, server); });
+}
@@ -1,6 +1,7 @@
 #include "network/networking.hpp"
 #include "network/server.hpp"
 
+#include <algorithm>
 #include <arpa/inet.h>
 #include <cstring>
 #include <fcntl.h>
@@ -13,9 +14,12 @@
 #include <unistd.h>
 
 NetworkManager::NetworkManager(size_t workerCount, Server& s)
-	: _incomingPackets(), _outgoingPackets(), _workerThreads(), _shutdownFlag(false), _receiverThread(), _senderThread(), _receiverThreadInit(0),
-	  _senderThreadInit(0), _server(s), _epollFd(-1), _serverSocket(-1) {
+	: _workerJobs(), _outgoingPackets(), _blockingJobs(), _workerThreads(), _blockingThreads(), _shutdownFlag(false), _receiverThread(),
+	  _senderThread(), _admissionThread(), _receiverThreadInit(0), _senderThreadInit(0), _server(s),
+	  _admission(*this, static_cast<size_t>(std::max(0, s.getConfig().getServerSize()))), _epollFd(-1), _serverSocket(-1), _sendQueues(),
+	  _sendEpollFd(-1) {
 	_workerThreads.reserve(workerCount);
+	_blockingThreads.reserve(BLOCKING_THREAD_COUNT);
 
 	setupEpoll();
 	start();
@@ -26,6 +30,10 @@ void NetworkManager::setupEpoll() {
 	if (_epollFd == -1) {
 		throw std::runtime_error("Failed to create epoll file descriptor");
 	}
+	_sendEpollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (_sendEpollFd == -1) {
+		throw std::runtime_error("Failed to create the sender epoll file descriptor");
+	}
 }
 
 void NetworkManager::startThreads() {
@@ -45,6 +53,10 @@ void NetworkManager::startThreads() {
 		for (size_t i = 0; i < workerCount; i++) {
 			_workerThreads.emplace_back(&NetworkManager::workerThreadLoop, this);
 		}
+		for (size_t i = 0; i < BLOCKING_THREAD_COUNT; i++) {
+			_blockingThreads.emplace_back(&NetworkManager::blockingThreadLoop, this);
+		}
+		if (!_admissionThread.joinable()) _admissionThread = std::thread(&NetworkManager::admissionThreadLoop, this);
 
 	} catch (const std::exception& e) {
 		stopThreads();
@@ -55,7 +67,8 @@ void NetworkManager::startThreads() {
 void NetworkManager::stopThreads() {
 	_shutdownFlag = true;
 
-	_incomingPackets.push(nullptr);
+	for (size_t i = 0; i < _workerThreads.size(); i++) _workerJobs.push(WorkerJob{});
+	for (size_t i = 0; i < _blockingThreads.size(); i++) _blockingJobs.push(nullptr);
 	_outgoingPackets.push(nullptr);
 
 	for (auto& worker : _workerThreads) {
@@ -65,6 +78,15 @@ void NetworkManager::stopThreads() {
 	}
 	_workerThreads.clear();
 
+	for (auto& blocking : _blockingThreads) {
+		if (blocking.joinable()) {
+			blocking.join();
+		}
+	}
+	_blockingThreads.clear();
+
+	if (_admissionThread.joinable()) _admissionThread.join();
+
 	if (_receiverThread.joinable()) {
 		_receiverThread.join();
 		_receiverThreadInit = 0;
@@ -1,253 +1,190 @@
+#include "data/ConfigurationCache.hpp"
 #include "logger.hpp"
 #include "network/networking.hpp"
 #include "network/packet.hpp"
+#include "network/packet_dispatch.hpp"
+#include "network/scratch_arena.hpp"
 #include "network/server.hpp"
 #include "player.hpp"
 
+#include <array>
 #include <string>
 
-void handleHandshakeState(Packet* packet, Server& server);
-void handleStatusState(Packet* packet, Server& server);
-void handleLoginState(Packet* packet, Server& server);
-void handleConfigurationState(Packet* packet, Server& server);
-void handlePlayState(Packet* packet, Server& server);
-void sendDisconnectPacket(Packet* packet, const std::string& reason, Server& server);
 void initGameSequence(Packet* packet, Server& server);
-void sendRegistryData(Packet& packet, Server& server);
-void sendUpdateTags(Packet& packet, Server& server);
-void sendCompleteConfigurationSequence(Packet* packet, Server& server);
 
-// ========================================
-// Main Packet Router
-// ========================================
+namespace {
 
-void packetRouter(Packet* packet, Server& server) {
+	// Size limits, in bytes of id + payload
+	constexpr uint32_t SMALL_PACKET_MAX	 = 256;
+	constexpr uint32_t STRING_PACKET_MAX = 32767;
+	constexpr uint32_t MAX_PACKET_SIZE	 = 2097151; // largest length a 3 byte VarInt prefix can announce
 
-	if (packet == nullptr) return;
-	if (server.getNetworkManager().getOutgoingQueue() == nullptr) return;
+	// ========================================
+	// Handshake / Status / Login handlers
+	// ========================================
 
-	Player* player = packet->getPlayer();
+	void routeHandshake(Packet* packet, Server& server) { handleHandshakePacket(*packet, server); }
 
-	if (player == nullptr) {
-		packet->setReturnPacket(PACKET_DISCONNECT);
-		return;
-	}
+	void routeStatusRequest(Packet* packet, Server& server) { handleStatusPacket(*packet, server); }
 
-	g_logger->logNetwork(INFO,
-						 "Routing packet ID: 0x" + std::to_string(packet->getId()) + " (size: " + std::to_string(packet->getSize()) +
-								 ") for state: " + std::to_string(static_cast<int>(player->getPlayerState())),
-						 "PacketRouter");
-
-	switch (player->getPlayerState()) {
-	case PlayerState::Handshake:
-		handleHandshakeState(packet, server);
-		break;
-	case PlayerState::Status:
-		handleStatusState(packet, server);
-		break;
-	case PlayerState::Login:
-		handleLoginState(packet, server);
-		break;
-	case PlayerState::Configuration:
-		handleConfigurationState(packet, server);
-		break;
-	case PlayerState::Play:
-		handlePlayState(packet, server);
-		break;
-	default:
-		g_logger->logNetwork(
-				WARN, "Unknown player state: " + std::to_string(static_cast<int>(player->getPlayerState())) + ", disconnecting", "PacketRouter");
-		packet->setReturnPacket(PACKET_DISCONNECT);
-		break;
-	}
-}
-
-// ========================================
-// Handshake State Handler
-// ========================================
-
-void handleHandshakeState(Packet* packet, Server& server) { handleHandshakePacket(*packet, server); }
-
-// ========================================
-// Status State Handler
-// ========================================
-
-void handleStatusState(Packet* packet, Server& server) {
-	if (packet->getId() == 0x00) {
-		handleStatusPacket(*packet, server);
-	} else if (packet->getId() == 0x01) {
-		handlePingPacket(*packet, server);
-	} else {
-		// g_logger->logNetwork(WARN, "Unknown packet ID in Status state: 0x" + std::to_string(packet->getId()), "PacketRouter");
-		packet->getPlayer()->setPlayerState(PlayerState::None);
-		packet->setReturnPacket(PACKET_DISCONNECT);
-	}
-}
+	void routePingRequest(Packet* packet, Server& server) { handlePingPacket(*packet, server); }
 
-// ========================================
-// Login State Handler
-// ========================================
-
-void handleLoginState(Packet* packet, Server& server) {
-	ThreadSafeQueue<Packet*>* outgoingPackets = server.getNetworkManager().getOutgoingQueue();
-	// Add safety check for packet data integrity
-	if (packet->getSize() > 32767) { // Max packet size
-		g_logger->logNetwork(ERROR, "Packet size too large: " + std::to_string(packet->getSize()), "PacketRouter");
-		packet->setReturnPacket(PACKET_DISCONNECT);
-		return;
-	}
-
-	if (packet->getId() == 0x00) {
-		// Login Start
+	void routeLoginStart(Packet* packet, Server& server) {
 		g_logger->logNetwork(INFO, "Processing Login Start (0x00)", "PacketRouter");
 		handleLoginStartPacket(*packet, server);
-	} else if (packet->getId() == 0x02) {
-		// Login Plugin Response - safe to ignore most of the time
-		g_logger->logNetwork(INFO, "Received Login Plugin Response (0x02) - acknowledging", "PacketRouter");
-		packet->setReturnPacket(PACKET_OK);
-	} else if (packet->getId() == 0x03) {
-		// Login Acknowledged
+	}
+
+	void routeLoginAcknowledged(Packet* packet, Server& server) {
 		g_logger->logNetwork(INFO, "Processing Login Acknowledged (0x03)", "PacketRouter");
 		handleLoginAcknowledged(*packet, server);
 		Packet* p = new Packet(*packet);
 		clientboundKnownPacks(*p);
-		outgoingPackets->push(p);
-	} else if (packet->getId() == 0x04) {
-		// Cookie Response (login)
-		g_logger->logNetwork(INFO, "Received Login Cookie Response (0x04) - acknowledging", "PacketRouter");
+		server.getNetworkManager().getOutgoingQueue()->push(p);
+	}
+
+	// Packets the server reads past without acting on them yet (plugin/cookie responses, pongs,
+	// keep alives, and most of the play stream)
+	void routeAccept(Packet* packet, Server& server) {
+		(void)server;
 		packet->setReturnPacket(PACKET_OK);
-	} else {
-		// g_logger->logNetwork(WARN, "Unknown packet ID in Login state: 0x" + std::to_string(packet->getId()), "PacketRouter");
-		packet->getPlayer()->setPlayerState(PlayerState::None);
-		packet->setReturnPacket(PACKET_DISCONNECT);
 	}
-}
 
-// ========================================
-// Configuration State Handler
-// ========================================
+	// ========================================
+	// Configuration handlers
+	// ========================================
 
-void handleConfigurationState(Packet* packet, Server& server) {
-	if (packet->getId() == 0x00) {
-		// Client Information (configuration)
+	void routeClientInformation(Packet* packet, Server& server) {
 		g_logger->logNetwork(INFO, "Received Client Information in Configuration state", "Configuration");
 		handleClientInformation(*packet, server);
-	} else if (packet->getId() == 0x01) {
-		// Cookie Response (configuration)
-		g_logger->logNetwork(INFO, "Received Cookie Response in Configuration state", "Configuration");
-		packet->setReturnPacket(PACKET_OK);
-
-	} else if (packet->getId() == 0x02) {
-		// Serverbound Plugin Message (configuration)
-		// g_logger->logNetwork(
-		// 		INFO, "Received Serverbound Plugin Message (0x02), size: " + std::to_string(packet->getSize()) + " bytes", "PacketRouter");
-		packet->setReturnPacket(PACKET_OK);
+	}
 
-	} else if (packet->getId() == 0x03) {
-		// Acknowledge Finish Configuration -> enter Play
+	void routeAcknowledgeFinishConfiguration(Packet* packet, Server& server) {
 		g_logger->logNetwork(INFO, "Received Acknowledge Finish Configuration - transitioning to Play state", "PacketRouter");
 		handleAcknowledgeFinishConfiguration(*packet, server);
+		// The configuration sequence parked on this ack sends the join packets
+		packet->getPlayer()->deliverPacket(PlayerState::Configuration, 0x03);
+	}
 
-		// 1. Send Login (play) packet - 0x2B
-		g_logger->logNetwork(INFO, "Sending Login (play) packet", "PacketRouter");
-		Packet* playPacket = new Packet(*packet);
-		writePlayPacket(*playPacket, server);
-		server.getNetworkManager().getOutgoingQueue()->push(playPacket);
-
-		// 3. Send Change Difficulty - 0x42
-		g_logger->logNetwork(INFO, "Sending Change Difficulty packet", "PacketRouter");
-		Packet* difficultyPacket = new Packet(*packet);
-		changeDifficulty(*difficultyPacket);
-		server.getNetworkManager().getOutgoingQueue()->push(difficultyPacket);
-
-		// 4. Send Player Abilities - 0x39
-		g_logger->logNetwork(INFO, "Sending Player Abilities packet", "PacketRouter");
-		Packet* abilitiesPacket = new Packet(*packet);
-		playerAbilities(*abilitiesPacket);
-		server.getNetworkManager().getOutgoingQueue()->push(abilitiesPacket);
-
-		Packet* heldItemPacket = new Packet(*packet);
-		setHeldItem(*heldItemPacket);
-		server.getNetworkManager().getOutgoingQueue()->push(heldItemPacket);
-
-		// 2. Send player position and look - 0x41
-		Packet* positionPacket = new Packet(*packet);
-		sendPlayerPositionAndLook(*positionPacket, server); // rename packet
-		server.getNetworkManager().getOutgoingQueue()->push(positionPacket);
-
-	} else if (packet->getId() == 0x04) {
-		// Keep Alive (configuration)
-		g_logger->logNetwork(INFO, "Received Keep Alive in Configuration state", "Configuration");
-		packet->setReturnPacket(PACKET_OK);
-
-	} else if (packet->getId() == 0x05) {
-		// Pong (configuration)
-		g_logger->logNetwork(INFO, "Received Pong in Configuration state", "Configuration");
+	void routeServerboundKnownPacks(Packet* packet, Server& server) {
+		g_logger->logNetwork(INFO, "Received Serverbound Known Packs in Configuration state", "Configuration");
+		bool clientHasCorePack = ConfigurationCache::sharesCorePack(serverboundKnownPacks(*packet));
 		packet->setReturnPacket(PACKET_OK);
+		runConfigurationSequence(*packet, server, clientHasCorePack);
+	}
 
-	} else if (packet->getId() == 0x06) {
-		// Resource Pack Response (configuration)
-		g_logger->logNetwork(INFO, "Received Resource Pack Response in Configuration state", "Configuration");
-		packet->setReturnPacket(PACKET_OK);
+	// ========================================
+	// Play handlers
+	// ========================================
 
-	} else if (packet->getId() == 0x07) {
-		// Serverbound Known Packs (configuration)
-		g_logger->logNetwork(INFO, "Received Serverbound Known Packs in Configuration state", "Configuration");
-		serverboundKnownPacks(*packet);
+	void routeConfirmTeleportation(Packet* packet, Server& server) {
+		handleConfirmTeleportation(*packet, server);
+		packet->getPlayer()->deliverPacket(PlayerState::Play, 0x00);
+	}
 
-		packet->setReturnPacket(PACKET_OK);
+	void routeSetPlayerPosition(Packet* packet, Server& server) { handleSetPlayerPosition(*packet, server); }
+
+	// ========================================
+	// Dispatch table
+	// ========================================
+
+	using RouteTable = std::array<std::array<PacketRoute, PACKET_ID_COUNT>, PLAYER_STATE_COUNT>;
+
+	constexpr RouteTable buildRouteTable() {
+		RouteTable table{};
+
+		auto add = [&table](PlayerState state, uint32_t id, PacketHandler handler, uint32_t maxSize, PacketPriority priority) {
+			table[static_cast<size_t>(state)][id] = PacketRoute{handler, maxSize, true, priority};
+		};
+
+		using enum PlayerState;
+		using enum PacketPriority;
+
+		add(Handshake, 0x00, routeHandshake, 1024, Control);
+
+		add(Status, 0x00, routeStatusRequest, SMALL_PACKET_MAX, Control);	// Status Request
+		add(Status, 0x01, routePingRequest, SMALL_PACKET_MAX, Control);		// Ping Request
+
+		add(Login, 0x00, routeLoginStart, SMALL_PACKET_MAX, Control);			// Login Start
+		add(Login, 0x02, routeAccept, STRING_PACKET_MAX, Normal);				// Login Plugin Response
+		add(Login, 0x03, routeLoginAcknowledged, SMALL_PACKET_MAX, Control);	// Login Acknowledged
+		add(Login, 0x04, routeAccept, 5 * 1024 + 512, Normal);					// Cookie Response
+
+		add(Configuration, 0x00, routeClientInformation, SMALL_PACKET_MAX, Normal);					// Client Information
+		add(Configuration, 0x01, routeAccept, 5 * 1024 + 512, Normal);								// Cookie Response
+		add(Configuration, 0x02, routeAccept, MAX_PACKET_SIZE, Bulk);								// Serverbound Plugin Message
+		add(Configuration, 0x03, routeAcknowledgeFinishConfiguration, SMALL_PACKET_MAX, Control);	// Acknowledge Finish Configuration
+		add(Configuration, 0x04, routeAccept, SMALL_PACKET_MAX, Control);							// Keep Alive
+		add(Configuration, 0x05, routeAccept, SMALL_PACKET_MAX, Control);							// Pong
+		add(Configuration, 0x06, routeAccept, SMALL_PACKET_MAX, Normal);							// Resource Pack Response
+		add(Configuration, 0x07, routeServerboundKnownPacks, STRING_PACKET_MAX, Normal);			// Serverbound Known Packs
+		add(Configuration, 0x08, routeAccept, STRING_PACKET_MAX, Normal);							// Custom Click Action
+
+		// Play: every serverbound id of protocol 770 is routed, unhandled ones are accepted and dropped
+		for (uint32_t id = 0x00; id <= 0x40; id++) add(Play, id, routeAccept, STRING_PACKET_MAX, Normal);
+
+		add(Play, 0x00, routeConfirmTeleportation, SMALL_PACKET_MAX, Control);	// Confirm Teleportation
+		add(Play, 0x0A, routeAccept, SMALL_PACKET_MAX, Control);				// Chunk Batch Received
+		add(Play, 0x0C, routeAccept, SMALL_PACKET_MAX, Control);				// Client Tick End
+		add(Play, 0x0F, routeAccept, SMALL_PACKET_MAX, Control);				// Acknowledge Configuration
+		add(Play, 0x15, routeAccept, MAX_PACKET_SIZE, Bulk);					// Serverbound Plugin Message
+		add(Play, 0x17, routeAccept, MAX_PACKET_SIZE, Bulk);					// Edit Book
+		add(Play, 0x1B, routeAccept, SMALL_PACKET_MAX, Control);				// Keep Alive
+		add(Play, 0x1D, routeSetPlayerPosition, SMALL_PACKET_MAX, Movement);	// Set Player Position
+		add(Play, 0x1E, routeSetPlayerPosition, SMALL_PACKET_MAX, Movement);	// Set Player Position and Rotation
+		add(Play, 0x1F, routeAccept, SMALL_PACKET_MAX, Movement);				// Set Player Rotation
+		add(Play, 0x20, routeAccept, SMALL_PACKET_MAX, Movement);				// Set Player Movement Flags
+		add(Play, 0x21, routeAccept, SMALL_PACKET_MAX, Movement);				// Move Vehicle
+		add(Play, 0x22, routeAccept, SMALL_PACKET_MAX, Movement);				// Paddle Boat
+		add(Play, 0x2A, routeAccept, SMALL_PACKET_MAX, Movement);				// Player Input
+		add(Play, 0x2B, routeAccept, SMALL_PACKET_MAX, Control);				// Player Loaded
+		add(Play, 0x2C, routeAccept, SMALL_PACKET_MAX, Control);				// Pong
+		add(Play, 0x37, routeAccept, MAX_PACKET_SIZE, Bulk);					// Set Creative Mode Slot
+
+		return table;
+	}
 
-		// Send complete configuration sequence
-		sendCompleteConfigurationSequence(packet, server);
+	constexpr RouteTable g_routeTable = buildRouteTable();
 
-	} else if (packet->getId() == 0x08) {
-		// Custom Click Action (configuration)
-		g_logger->logNetwork(INFO, "Serverbound known packs", "Configuration");
-		packet->setReturnPacket(PACKET_OK);
+	constexpr PacketRoute g_rejectRoute{nullptr, 0, false, PacketPriority::Control};
 
-	} else {
-		// g_logger->logNetwork(WARN, "Unknown packet ID in Configuration state: 0x" + std::to_string(packet->getId()), "PacketRouter");
-		sendDisconnectPacket(packet, "Unknown packet in Configuration state", server);
-		packet->getPlayer()->setPlayerState(PlayerState::None);
+	// Single exit for ids that are unknown in the current state or exceed their size limit
+	void rejectPacket(Packet* packet, Server& server) {
+		Player* player = packet->getPlayer();
+		if (player->getPlayerState() == PlayerState::Configuration) sendDisconnectPacket(packet, "Unknown packet in Configuration state", server);
+		player->setPlayerState(PlayerState::None);
 		packet->setReturnPacket(PACKET_DISCONNECT);
 	}
+
+} // namespace
+
+const PacketRoute& lookupPacketRoute(PlayerState state, uint32_t id) {
+	size_t stateIndex = static_cast<size_t>(state);
+	if (stateIndex >= PLAYER_STATE_COUNT || id >= PACKET_ID_COUNT) return g_rejectRoute;
+	return g_routeTable[stateIndex][id];
 }
 
 // ========================================
-// Play State Handler
+// Main Packet Router
 // ========================================
 
-void handlePlayState(Packet* packet, Server& server) {
-	if (packet->getId() == 0x00) {
-		// Confirm Teleportation
-		handleConfirmTeleportation(*packet, server);
+void packetRouter(Packet* packet, Server& server) {
 
-		// Send Game Event packet - 0x42
-		g_logger->logNetwork(INFO, "Sending Game Event packet", "PacketRouter");
-		Packet* gameEvent = new Packet(*packet);
-		gameEventPacket(*gameEvent, server);
-		server.getNetworkManager().getOutgoingQueue()->push(gameEvent);
-
-		// 2. Send Set Center Chunk - 0x57
-		// Packet* setCenterPacket = new Packet(*packet);
-		// writeSetCenterPacket(*setCenterPacket, server);
-		// server.getNetworkManager().getOutgoingQueue()->push(setCenterPacket);
-
-		// 3. Send Level Chunk With Light - 0x22
-		// Packet* levelChunkPacket = new Packet(*packet);
-		// levelChunkWithLight(*levelChunkPacket, server);
-		// server.getNetworkManager().getOutgoingQueue()->push(levelChunkPacket);
-
-	} else if (packet->getId() == 0x2B) {
-		// Playere loaded
-		g_logger->logNetwork(DEBUG, "Player Load========================", "PacketRouter");
-		packet->setReturnPacket(PACKET_OK);
-	} else {
-		// Other play packets
-		// g_logger->logNetwork(INFO, "Received packet ID: " + std::to_string(packet->getId()) + "
-		// in Play state", "Play");
-		packet->setReturnPacket(PACKET_OK);
+	if (packet == nullptr) return;
+	if (server.getNetworkManager().getOutgoingQueue() == nullptr) return;
+
+	Player* player = packet->getPlayer();
+
+	if (player == nullptr) {
+		packet->setReturnPacket(PACKET_DISCONNECT);
+		return;
 	}
+
+	const PacketRoute& route = lookupPacketRoute(player->getPlayerState(), packet->getId());
+	if (!route.allowed || packet->getSize() > route.maxSize) {
+		rejectPacket(packet, server);
+		return;
+	}
+	route.handler(packet, server);
 }
 
 // ========================================
@@ -265,14 +202,14 @@ void sendDisconnectPacket(Packet* packet, const std::string& reason, Server& ser
 
 	try {
 		// Create Disconnect packet (0x02 in Configuration state)
-		Buffer payload;
+		Buffer payload(ScratchArena::current());
 		payload.writeVarInt(0x02); // Disconnect packet ID
 
 		// Create JSON reason
 		std::string jsonReason = "{\"text\":\"" + reason + "\"}";
 		payload.writeString(jsonReason);
 
-		Buffer final;
+		Buffer final(ScratchArena::current());
 		final.writeVarInt(payload.getData().size());
 		final.writeBytes(payload.getData());
 
@@ -321,50 +258,3 @@ void initGameSequence(Packet* packet, Server& server) {
 		packet->setReturnPacket(PACKET_ERROR);
 	}
 }
-
-// ========================================
-// Complete Configuration Sequence
-// ========================================
-
-void sendCompleteConfigurationSequence(Packet* packet, Server& server) {
-	if (!packet || !server.getNetworkManager().getOutgoingQueue()) {
-		g_logger->logNetwork(ERROR, "Invalid packet or server in configuration sequence", "Configuration");
-		return;
-	}
-
-	Player* player = packet->getPlayer();
-	if (!player) {
-		g_logger->logNetwork(ERROR, "No player found for configuration sequence", "Configuration");
-		return;
-	}
-
-	g_logger->logNetwork(INFO, "=== Starting Complete Configuration Sequence ===", "Configuration");
-
-	try {
-		// 1. Send Registry Data (this will queue multiple packets, one per registry)
-		g_logger->logNetwork(INFO, "Step 1: Sending Registry Data", "Configuration");
-		sendRegistryData(*packet, server);
-
-		// 2. Send Update Tags after Registry Data
-		g_logger->logNetwork(INFO, "Step 2: Sending Update Tags", "Configuration");
-		sendUpdateTags(*packet, server);
-
-		// 3. TODO: Add other configuration packets here if needed
-		// - Feature Flags
-		// - Data Packs
-		// - Resource Packs
-		// - Custom Payloads
-
-		// 4. Send Finish Configuration to complete the sequence
-		g_logger->logNetwork(INFO, "Step 3: Sending Finish Configuration", "Configuration");
-		Packet* finishPacket = new Packet(*packet);
-		handleFinishConfiguration(*finishPacket, server);
-		server.getNetworkManager().getOutgoingQueue()->push(finishPacket);
-
-		g_logger->logNetwork(INFO, "=== Configuration Sequence Completed Successfully ===", "Configuration");
-
-	} catch (const std::exception& e) {
-		g_logger->logNetwork(ERROR, "Error in configuration sequence: " + std::string(e.what()), "Configuration");
-		packet->setReturnPacket(PACKET_ERROR);
-	}
-}
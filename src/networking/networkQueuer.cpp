@@ -5,7 +5,9 @@
 #include "player.hpp"
 
 #include <arpa/inet.h>
+#include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <errno.h>
 #include <exception>
 #include <iostream>
@@ -13,8 +15,36 @@
 #include <string>
 #include <sys/epoll.h>
 #include <sys/socket.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
+namespace {
+	// A client that does not read for this long is dropped, its queued frames with it
+	constexpr auto SEND_TIMEOUT = std::chrono::milliseconds(5000);
+
+	// Writes what the socket takes of the frame without blocking (client sockets are blocking, each send is made
+	// non-blocking); interrupted calls are retried. Returns the errno of the failure, EAGAIN once the socket buffer
+	// is full, 0 once every byte went out.
+	int sendSome(int socket, const uint8_t* data, size_t size, size_t& sent) {
+		while (sent < size) {
+			ssize_t written = send(socket, data + sent, size - sent, MSG_NOSIGNAL | MSG_DONTWAIT);
+			if (written >= 0) {
+				sent += static_cast<size_t>(written);
+				continue;
+			}
+			if (errno == EINTR) continue;
+			return errno == EWOULDBLOCK ? EAGAIN : errno;
+		}
+		return 0;
+	}
+
+	// Inode of the socket open as `socket`, 0 once it is closed
+	ino_t socketIdentity(int socket) {
+		struct stat status;
+		return fstat(socket, &status) == 0 ? status.st_ino : 0;
+	}
+} // namespace
+
 void NetworkManager::receiverThreadLoop() {
 	const int	MaxEvent = 256;
 	epoll_event events[MaxEvent];
@@ -82,34 +112,131 @@ void NetworkManager::receiverThreadLoop() {
 }
 
 void NetworkManager::senderThreadLoop() {
+	const int	MaxEvent = 64;
+	epoll_event events[MaxEvent];
+
 	while (!_shutdownFlag.load()) {
 		Packet* p = nullptr;
 
 		while (_outgoingPackets.tryPop(p)) {
 			if (p == nullptr) break;
+			sendFrame(p);
+		}
 
-			try {
-				// g_logger->logNetwork(INFO, "Sending packet to player", "Network Manager");
-				std::cout << "Sending packet 0x" << std::hex << p->getId() << " (" << std::dec << p->getData().getData().size() << " bytes)"
-						  << std::endl;
-
-				send(p->getSocket(), p->getData().getData().data(), p->getSize(), MSG_NOSIGNAL);
-				if (p->getPlayer() && p->getPlayer()->getPlayerState() == PlayerState::None) {
-					// g_logger->logNetwork(INFO, "Closing status connection after response",
-					// "Network Manager");
-					getServer().removePlayerFromAnyList(p->getPlayer());
-					epoll_ctl(_epollFd, EPOLL_CTL_DEL, p->getSocket(), nullptr);
-					close(p->getSocket());
-				}
-			} catch (const std::exception& e) {
-				std::cerr << "[Network Manager] Failed to send packet: " << e.what() << std::endl;
-			}
-			delete p;
-			p = nullptr;
-			// g_logger->logNetwork(INFO, "Packet sent", "Network Manager");
+		// Idle wait, cut short when a socket with queued frames turns writable
+		int eventCount = epoll_wait(_sendEpollFd, events, MaxEvent, 1);
+		for (int i = 0; i < eventCount; i++) drainSendQueue(events[i].data.fd);
+
+		auto now = std::chrono::steady_clock::now();
+		for (auto it = _sendQueues.begin(); it != _sendQueues.end();) {
+			int	 socket	 = it->first;
+			bool reused	 = socketIdentity(socket) != it->second.socket; // the connection is gone, a newer one got its descriptor
+			bool stalled = now - it->second.progress > SEND_TIMEOUT;
+			++it;
+			if (reused) dropSendQueue(socket);
+			else if (stalled) sendFailed(socket, ETIMEDOUT);
+		}
+	}
+
+	while (!_sendQueues.empty()) dropSendQueue(_sendQueues.begin()->first);
+}
+
+void NetworkManager::sendFrame(Packet* p) {
+	int socket = p->getSocket();
+	// g_logger->logNetwork(INFO, "Sending packet to player", "Network Manager");
+	std::cout << "Sending packet 0x" << std::hex << p->getId() << " (" << std::dec << p->getSize() << " bytes)" << std::endl;
+
+	if (auto queued = _sendQueues.find(socket); queued != _sendQueues.end()) {
+		if (socketIdentity(socket) == queued->second.socket) {
+			queued->second.frames.push_back(p);
+			return;
 		}
-		usleep(1000);
+		dropSendQueue(socket);
 	}
+
+	size_t sent	  = 0;
+	int	   error;
+	try {
+		error = sendSome(socket, p->getWireData(), static_cast<size_t>(p->getSize()), sent);
+	} catch (const std::exception& e) {
+		std::cerr << "[Network Manager] Failed to send packet: " << e.what() << std::endl;
+		delete p;
+		return;
+	}
+	if (error == 0) {
+		frameSent(p);
+		return;
+	}
+	if (error != EAGAIN) {
+		sendFailed(socket, error);
+		delete p;
+		return;
+	}
+
+	// The rest goes out, with every later frame of the connection, once the socket drains
+	epoll_event event;
+	event.events  = EPOLLOUT;
+	event.data.fd = socket;
+	if (epoll_ctl(_sendEpollFd, EPOLL_CTL_ADD, socket, &event) == -1 && epoll_ctl(_sendEpollFd, EPOLL_CTL_MOD, socket, &event) == -1) {
+		sendFailed(socket, errno);
+		delete p;
+		return;
+	}
+	_sendQueues[socket] = SendQueue{{p}, sent, socketIdentity(socket), std::chrono::steady_clock::now()};
+}
+
+void NetworkManager::drainSendQueue(int socket) {
+	auto queued = _sendQueues.find(socket);
+	while (queued != _sendQueues.end() && !queued->second.frames.empty()) {
+		SendQueue& queue  = queued->second;
+		Packet*	   p	  = queue.frames.front();
+		size_t	   before = queue.sent;
+		int		   error  = sendSome(socket, p->getWireData(), static_cast<size_t>(p->getSize()), queue.sent);
+		if (queue.sent != before) queue.progress = std::chrono::steady_clock::now();
+		if (error == EAGAIN) return;
+		if (error != 0) {
+			sendFailed(socket, error);
+			return;
+		}
+
+		queue.frames.pop_front();
+		queue.sent = 0;
+		frameSent(p);
+		// A status connection is closed with its last frame
+		queued = _sendQueues.find(socket);
+	}
+	if (queued != _sendQueues.end()) dropSendQueue(socket);
+}
+
+void NetworkManager::frameSent(Packet* p) {
+	if (p->getPlayer() && p->getPlayer()->getPlayerState() == PlayerState::None) {
+		// g_logger->logNetwork(INFO, "Closing status connection after response",
+		// "Network Manager");
+		dropSendQueue(p->getSocket());
+		getServer().removePlayerFromAnyList(p->getPlayer());
+		epoll_ctl(_epollFd, EPOLL_CTL_DEL, p->getSocket(), nullptr);
+		close(p->getSocket());
+	}
+	delete p;
+	// g_logger->logNetwork(INFO, "Packet sent", "Network Manager");
+}
+
+void NetworkManager::sendFailed(int socket, int error) {
+	// The receiver thread sees the hangup and removes the player like any other disconnect. The frames still
+	// queued for the connection go with it, later ones fail with EPIPE until then.
+	g_logger->logNetwork(error == EPIPE ? DEBUG : WARN,
+						 "Failed to send on socket " + std::to_string(socket) + ": " + std::strerror(error) + ", disconnecting", "Network Manager");
+	::shutdown(socket, SHUT_RDWR);
+	dropSendQueue(socket);
+}
+
+void NetworkManager::dropSendQueue(int socket) {
+	auto queued = _sendQueues.find(socket);
+	if (queued == _sendQueues.end()) return;
+	for (Packet* p : queued->second.frames) delete p;
+	_sendQueues.erase(queued);
+	// Fails harmlessly when the socket was already closed, which unregistered it
+	epoll_ctl(_sendEpollFd, EPOLL_CTL_DEL, socket, nullptr);
 }
 
 void NetworkManager::enqueueOutgoingPacket(Packet* p) { _outgoingPackets.push(p); }
@@ -119,7 +246,7 @@ void NetworkManager::handleIncomingData(Player* connection) {
 	// g_logger->logNetwork(INFO, "Handling incoming data for player", "Network Manager");
 	try {
 		p = new Packet(connection);
-		_incomingPackets.push(p);
+		_workerJobs.push(WorkerJob{p, nullptr, nullptr});
 	} catch (const std::exception& e) {
 		std::cerr << "[Network Manager] Failed to receive packet 1: " << e.what() << std::endl;
 		throw;
@@ -132,7 +259,7 @@ void NetworkManager::handleIncomingData(int socket) {
 	// "Network Manager");
 	try {
 		p = new Packet(socket, getServer());
-		_incomingPackets.push(p);
+		_workerJobs.push(WorkerJob{p, nullptr, nullptr});
 	} catch (const std::exception& e) {
 		std::cerr << "[Network Manager] Failed to receive packet 2: " << e.what() << std::endl;
 		throw;
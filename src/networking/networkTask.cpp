@@ -0,0 +1,104 @@
+#include "logger.hpp"
+#include "network/networking.hpp"
+#include "network/task.hpp"
+#include "player.hpp"
+
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+void Task::promise_type::unhandled_exception() noexcept {
+	try {
+		throw;
+	} catch (const ConnectionClosed&) {
+		// Player left while the sequence was suspended, nothing to report
+	} catch (const std::exception& e) {
+		g_logger->logNetwork(ERROR, "Connection sequence failed: " + std::string(e.what()), "Task");
+	} catch (...) {
+		g_logger->logNetwork(ERROR, "Connection sequence failed with an unknown exception", "Task");
+	}
+}
+
+void runOnBlockingPool(NetworkManager& network, std::function<void()> job) { network.runBlocking(std::move(job)); }
+
+// ========================================
+// Connection Strand
+// ========================================
+
+ConnectionStrand::ConnectionStrand(NetworkManager& network) : _network(network), _strand(), _lock(), _open(true), _expected() {}
+
+void ConnectionStrand::resume(std::coroutine_handle<> handle) { _network.resumeOnStrand(shared_from_this(), handle); }
+
+void ConnectionStrand::run(std::coroutine_handle<> handle) {
+	std::lock_guard<std::recursive_mutex> strand(_strand);
+	handle.resume();
+}
+
+void ConnectionStrand::route(const std::function<void()>& handler) {
+	std::lock_guard<std::recursive_mutex> strand(_strand);
+	handler();
+}
+
+void ConnectionStrand::close() {
+	std::coroutine_handle<> waiter;
+	{
+		std::lock_guard<std::recursive_mutex> strand(_strand);
+		std::lock_guard<std::mutex>			  lock(_lock);
+		_open.store(false);
+		waiter	  = _expected.waiter;
+		_expected = ExpectedPacket{};
+	}
+	if (waiter) resume(waiter);
+}
+
+void ConnectionStrand::expectPacket(PlayerState state, uint32_t id) {
+	std::lock_guard<std::mutex> lock(_lock);
+	_expected = ExpectedPacket{state, id, true, false, nullptr};
+}
+
+bool ConnectionStrand::parkUntilExpectedPacket(std::coroutine_handle<> waiter) {
+	std::lock_guard<std::mutex> lock(_lock);
+	// Closed: carry on into await_resume, which unwinds the sequence
+	if (!_open.load() || !_expected.armed || _expected.arrived) {
+		_expected = ExpectedPacket{};
+		return false;
+	}
+	_expected.waiter = waiter;
+	return true;
+}
+
+void ConnectionStrand::deliverPacket(PlayerState state, uint32_t id) {
+	std::coroutine_handle<> waiter;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		if (!_expected.armed || _expected.state != state || _expected.id != id) return;
+		if (!_expected.waiter) {
+			_expected.arrived = true;
+			return;
+		}
+		waiter	  = _expected.waiter;
+		_expected = ExpectedPacket{};
+	}
+	resume(waiter);
+}
+
+// ========================================
+// Client Packet Awaiter
+// ========================================
+
+ClientPacketAwaiter::ClientPacketAwaiter(Player& player, PlayerState state, uint32_t id) : _connection(player.getConnectionToken()) {
+	_connection->expectPacket(state, id);
+}
+
+bool ClientPacketAwaiter::await_ready() const { return false; }
+
+bool ClientPacketAwaiter::await_suspend(std::coroutine_handle<> handle) { return _connection->parkUntilExpectedPacket(handle); }
+
+void ClientPacketAwaiter::await_resume() const {
+	if (!_connection->isOpen()) throw ConnectionClosed();
+}
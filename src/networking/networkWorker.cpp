@@ -1,44 +1,86 @@
 #include "logger.hpp"
 #include "network/networking.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
 #include "network/server.hpp"
+#include "network/task.hpp"
 #include "player.hpp"
 
 #include <chrono>
 #include <exception>
+#include <functional>
 #include <iostream>
 #include <sys/epoll.h>
+#include <thread>
 #include <unistd.h>
 
 void NetworkManager::workerThreadLoop() {
+	// Handlers build their temporary buffers here; reset once the job has run
+	ScratchArena scratch;
+
 	while (!_shutdownFlag.load()) {
-		Packet* packet = nullptr;
+		WorkerJob job;
+
+		if (!_workerJobs.waitAndPopTimeout(job, std::chrono::milliseconds(100))) continue;
+		if (job.resume) {
+			// Connection sequence whose awaited event completed
+			job.strand->run(job.resume);
+			scratch.reset();
+			continue;
+		}
 
-		if (_incomingPackets.waitAndPopTimeout(packet, std::chrono::milliseconds(100))) {
-			if (packet == nullptr) break;
-			try {
+		Packet* packet = job.packet;
+		if (packet == nullptr) break;
+		try {
 
-				// g_logger->logNetwork(INFO, "Handling incoming data for player", "Worker");
+			// g_logger->logNetwork(INFO, "Handling incoming data for player", "Worker");
+			// Handlers and the sequences they start run on the strand of the connection, like resumed sequences
+			if (ConnectionToken connection = packet->getPlayer() ? packet->getPlayer()->getConnectionToken() : nullptr) {
+				connection->route([this, packet]() { packetRouter(packet, getServer()); });
+			} else {
 				packetRouter(packet, getServer());
-				if (packet->getReturnPacket() == PACKET_SEND) {
-					_outgoingPackets.push(packet);
-					packet = nullptr;
-				} else if (packet->getReturnPacket() == PACKET_DISCONNECT) {
-					Player* player = packet->getPlayer();
-					if (player) {
-						getServer().removePlayerFromAnyList(player);
-						epoll_ctl(_epollFd, EPOLL_CTL_DEL, packet->getSocket(), nullptr);
-						close(packet->getSocket());
-						// g_logger->logNetwork(INFO,
-						//                      "Disconnected player socket " +
-						//                              std::to_string(packet->getSocket()),
-						//                      "Worker");
-					}
+			}
+			if (packet->getReturnPacket() == PACKET_SEND) {
+				_outgoingPackets.push(packet);
+				packet = nullptr;
+			} else if (packet->getReturnPacket() == PACKET_DISCONNECT) {
+				Player* player = packet->getPlayer();
+				if (player) {
+					getServer().removePlayerFromAnyList(player);
+					epoll_ctl(_epollFd, EPOLL_CTL_DEL, packet->getSocket(), nullptr);
+					close(packet->getSocket());
+					// g_logger->logNetwork(INFO,
+					//                      "Disconnected player socket " +
+					//                              std::to_string(packet->getSocket()),
+					//                      "Worker");
 				}
-			} catch (const std::exception& e) {
-				std::cerr << "Error processing packet: " << e.what() << std::endl;
 			}
+		} catch (const std::exception& e) {
+			std::cerr << "Error processing packet: " << e.what() << std::endl;
 		}
 		if (packet != nullptr) delete packet;
+		scratch.reset();
+	}
+}
+
+void NetworkManager::blockingThreadLoop() {
+	while (!_shutdownFlag.load()) {
+		std::function<void()> job;
+
+		if (!_blockingJobs.waitAndPopTimeout(job, std::chrono::milliseconds(100))) continue;
+		if (!job) break;
+		// Offloaded jobs catch their own exceptions and hand them to the awaiting sequence
+		job();
+	}
+}
+
+void NetworkManager::admissionThreadLoop() {
+	auto nextUpdate = std::chrono::steady_clock::now() + AdmissionController::QUEUE_UPDATE_INTERVAL;
+
+	while (!_shutdownFlag.load()) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		if (std::chrono::steady_clock::now() < nextUpdate) continue;
+		_admission.broadcastQueuePositions();
+		nextUpdate = std::chrono::steady_clock::now() + AdmissionController::QUEUE_UPDATE_INTERVAL;
 	}
 }
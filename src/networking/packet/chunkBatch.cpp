@@ -1,29 +1,28 @@
 #include "lib/UUID.hpp"
+#include "logger.hpp"
 #include "network/buffer.hpp"
+#include "network/chunk_view.hpp"
 #include "network/networking.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
 #include "network/server.hpp"
 #include "player.hpp"
 
 #include <iostream>
+#include <string>
 
-void sendChunkBatchStart(Packet& packet, Server& server) {
-	std::cout << "=== Sending Chunk Batch Start ===\n";
-
+void writeChunkBatchStartFrame(Buffer& out) {
 	// Chunk Batch Start has no fields - just the packet ID
-	Buffer buf;
-	// No data to write for this packet
+	int packetId = 0x0C; // Chunk Batch Start packet ID for protocol 770
+	out.writeVarInt(Packet::varintLen(packetId));
+	out.writeVarInt(packetId);
+}
 
-	int packetId		 = 0x0C; // Chunk Batch Start packet ID for protocol 770
-	int packetIdSize	 = packet.getVarintSize(packetId);
-	int totalPayloadSize = packetIdSize + buf.getData().size();
+void sendChunkBatchStart(Packet& packet, Server& server) {
+	std::cout << "=== Sending Chunk Batch Start ===\n";
 
-	Buffer finalBuf;
-	finalBuf.writeVarInt(totalPayloadSize);
-	finalBuf.writeVarInt(packetId);
-	if (!buf.getData().empty()) {
-		finalBuf.writeBytes(buf.getData());
-	}
+	Buffer finalBuf(ScratchArena::current());
+	writeChunkBatchStartFrame(finalBuf);
 
 	packet.getData() = finalBuf;
 	packet.setPacketSize(finalBuf.getData().size());
@@ -32,20 +31,23 @@ void sendChunkBatchStart(Packet& packet, Server& server) {
 	(void)server;
 }
 
-void sendChunkBatchFinished(Packet& packet, Server& server, int batchSize) {
-	std::cout << "=== Sending Chunk Batch Finished (batch size: " << batchSize << ") ===\n";
-
-	Buffer buf;
+void writeChunkBatchFinishedFrame(Buffer& out, int batchSize) {
+	Buffer buf(ScratchArena::current());
 	buf.writeVarInt(batchSize); // Number of chunks in the batch
 
 	int packetId		 = 0x0B; // Chunk Batch Finished packet ID for protocol 770
-	int packetIdSize	 = packet.getVarintSize(packetId);
-	int totalPayloadSize = packetIdSize + buf.getData().size();
+	int totalPayloadSize = Packet::varintLen(packetId) + buf.getData().size();
+
+	out.writeVarInt(totalPayloadSize);
+	out.writeVarInt(packetId);
+	out.writeBytes(buf.getData());
+}
+
+void sendChunkBatchFinished(Packet& packet, Server& server, int batchSize) {
+	std::cout << "=== Sending Chunk Batch Finished (batch size: " << batchSize << ") ===\n";
 
-	Buffer finalBuf;
-	finalBuf.writeVarInt(totalPayloadSize);
-	finalBuf.writeVarInt(packetId);
-	finalBuf.writeBytes(buf.getData());
+	Buffer finalBuf(ScratchArena::current());
+	writeChunkBatchFinishedFrame(finalBuf, batchSize);
 
 	packet.getData() = finalBuf;
 	packet.setPacketSize(finalBuf.getData().size());
@@ -54,72 +56,14 @@ void sendChunkBatchFinished(Packet& packet, Server& server, int batchSize) {
 	(void)server;
 }
 
-void sendChunkBatchSequence(Packet& packet, Server& server) {
-	Player*					  player		  = packet.getPlayer();
-	ThreadSafeQueue<Packet*>* outgoingPackets = server.getNetworkManager().getOutgoingQueue();
-	if (!player || !outgoingPackets) return;
-
-	int playerChunkX = 0;
-	int playerChunkZ = 0;
-	int viewDistance = 3; // Reasonable size
-
-	std::cout << "=== Starting chunk batch sequence for player: " << player->getPlayerName() << " (view distance: " << viewDistance << ") ===\n";
-
-	// 1. Send Chunk Batch Start
-	try {
-		Packet* batchStartPacket = new Packet(packet);
-		sendChunkBatchStart(*batchStartPacket, server);
-		outgoingPackets->push(batchStartPacket);
-	} catch (const std::exception& e) {
-		std::cerr << "Error sending chunk batch start: " << e.what() << std::endl;
-		return;
-	}
-
-	// 2. Send chunks in smaller batches
-	int		  chunksCount	 = 0;
-	int		  batchSize		 = 0;
-	const int MAX_BATCH_SIZE = 16; // Limit chunks per batch
-
-	for (int x = playerChunkX - viewDistance; x <= playerChunkX + viewDistance; x++) {
-		for (int z = playerChunkZ - viewDistance; z <= playerChunkZ + viewDistance; z++) {
-			try {
-				Packet* chunkPacket = new Packet(packet);
-				sendChunkData(*chunkPacket, server, x, z);
-				outgoingPackets->push(chunkPacket);
-				chunksCount++;
-				batchSize++;
-
-				// Send batch finished and start new batch if we hit limit
-				if (batchSize >= MAX_BATCH_SIZE) {
-					// Send batch finished
-					Packet* batchFinishedPacket = new Packet(packet);
-					sendChunkBatchFinished(*batchFinishedPacket, server, batchSize);
-					outgoingPackets->push(batchFinishedPacket);
-
-					// Start new batch
-					Packet* batchStartPacket = new Packet(packet);
-					sendChunkBatchStart(*batchStartPacket, server);
-					outgoingPackets->push(batchStartPacket);
-
-					batchSize = 0;
-				}
-
-			} catch (const std::exception& e) {
-				std::cerr << "Error sending chunk (" << x << ", " << z << "): " << e.what() << std::endl;
-			}
-		}
-	}
-
-	// 3. Send final batch finished
-	if (batchSize > 0) {
-		try {
-			Packet* batchFinishedPacket = new Packet(packet);
-			sendChunkBatchFinished(*batchFinishedPacket, server, batchSize);
-			outgoingPackets->push(batchFinishedPacket);
-		} catch (const std::exception& e) {
-			std::cerr << "Error sending chunk batch finished: " << e.what() << std::endl;
-		}
-	}
+void sendChunkBatchSequence(Packet& packet, Server& server, const SpawnPreload& spawnArea) {
+	Player* player = packet.getPlayer();
+	if (!player) return;
 
-	std::cout << "=== Chunk batch sequence completed: " << chunksCount << " chunks sent ===\n";
+	// The spawn batch covered the square of SPAWN_CHUNK_RADIUS around its center: the view starts from it and only
+	// requests the chunks the client's view distance adds, closest first
+	player->getChunkView()->start(packet, server, spawnArea.getCenterX(), spawnArea.getCenterZ(), SpawnPreload::SPAWN_CHUNK_RADIUS);
+	g_logger->logNetwork(INFO,
+						 "Chunk view of " + player->getPlayerName() + " started, view distance " + std::to_string(player->getChunkView()->getRadius()),
+						 "PacketRouter");
 }
@@ -2,99 +2,83 @@
 #include "network/buffer.hpp"
 #include "network/networking.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
 #include "network/server.hpp"
 #include "player.hpp"
 
+#include <cstdint>
 #include <iostream>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
 
-void sendChunkData(Packet& packet, Server& server, int chunkX, int chunkZ) {
-	std::cout << "=== Sending Chunk Data (" << chunkX << ", " << chunkZ << ") ===\n";
-
+// Whole frame (length, id, body) of one chunk; the heap Buffer outlives the scratch arena of the sending thread
+static std::shared_ptr<const std::vector<uint8_t>> encodeChunkDataFrame(const World::ChunkData& chunkData) {
 	Buffer buf;
+	buf.reserve(64 * 1024); // 25 sky light arrays alone are ~51 KiB
 
 	try {
-		// Use your new chunk loading system
-		World::Query	 query	   = server.getWorldQuery();
-		World::ChunkData chunkData = query.fetchChunk(chunkX, chunkZ);
-
 		// Write chunk coordinates
-		buf.writeInt(chunkX);
-		buf.writeInt(chunkZ);
-
-		// Write heightmaps (simplified)
-		if (!chunkData.heightmaps.empty()) {
-			buf.writeBytes(chunkData.heightmaps);
-		} else {
-			// Empty heightmap
-			buf.writeByte(0x0A); // Compound tag
-			buf.writeByte(0x00); // Empty name length
-			buf.writeByte(0x00); // End tag
-		}
+		buf.writeInt(chunkData.chunkX);
+		buf.writeInt(chunkData.chunkZ);
 
-		// Write chunk data
-		if (!chunkData.blockData.empty()) {
-			buf.writeVarInt(chunkData.blockData.size());
-			buf.writeBytes(chunkData.blockData);
-		} else {
-			// Generate simple empty chunk inline
-			Buffer	  emptyData;
-			const int NUM_SECTIONS = 24;
-
-			for (int section = 0; section < NUM_SECTIONS; section++) {
-				emptyData.writeByte(0x00); // Block count low
-				emptyData.writeByte(0x00); // Block count high
-
-				// Block states - single air block
-				emptyData.writeByte(0);	  // Bits per entry
-				emptyData.writeVarInt(0); // Air block state
-				emptyData.writeVarInt(0); // No data array
-
-				// Biomes - single plains biome
-				emptyData.writeByte(0);	  // Bits per entry
-				emptyData.writeVarInt(1); // Plains biome
-				emptyData.writeVarInt(0); // No data array
-			}
-
-			buf.writeVarInt(emptyData.getData().size());
-			buf.writeBytes(emptyData.getData());
-		}
+		// Heightmaps, (type, long array) pairs since 1.21.5
+		chunkData.heightmaps.encode(buf);
+
+		writeChunkSections(buf, chunkData);
 
 		// Block entities
 		buf.writeVarInt(0);
 
-		// Light data (simplified version)
-		buf.writeVarInt(1);		  // Sky light mask length
-		buf.writeLong(0x1FFFFFF); // All sections have sky light
-		buf.writeVarInt(1);		  // Block light mask length
-		buf.writeLong(0);		  // No block light
-		buf.writeVarInt(1);		  // Empty sky light mask length
-		buf.writeLong(0);		  // No empty sky light sections
-		buf.writeVarInt(1);		  // Empty block light mask length
-		buf.writeLong(0);		  // No empty block light sections
-
-		// Sky light arrays
-		for (int i = 0; i < 25; i++) {
-			buf.writeVarInt(2048);
-			for (int j = 0; j < 2048; j++) {
-				buf.writeByte(0xFF);
-			}
-		}
+		writeLightData(buf, chunkData);
 
 	} catch (const std::exception& e) {
 		std::cerr << "Error in sendChunkData: " << e.what() << std::endl;
-		// Return without setting packet data - this will cause the packet to be skipped
-		return;
+		// Nothing cached - the chunk is skipped
+		return nullptr;
 	}
 
-	// Create final packet
 	int packetId		 = 0x27;
-	int packetIdSize	 = packet.getVarintSize(packetId);
-	int totalPayloadSize = packetIdSize + buf.getData().size();
+	int totalPayloadSize = Packet::varintLen(packetId) + buf.getData().size();
+
+	Buffer frame;
+	frame.reserve(buf.getData().size() + 6);
+	frame.writeVarInt(totalPayloadSize);
+	frame.writeVarInt(packetId);
+	frame.writeBytes(buf.getData());
+	return std::make_shared<const std::vector<uint8_t>>(frame.getData().begin(), frame.getData().end());
+}
 
-	Buffer finalBuf;
-	finalBuf.writeVarInt(totalPayloadSize);
-	finalBuf.writeVarInt(packetId);
-	finalBuf.writeBytes(buf.getData());
+std::shared_ptr<const std::vector<uint8_t>> getChunkDataFrame(const World::ChunkData& chunkData) {
+	// Light updates write the chunk in place; the version read here is the one the encoded frame holds
+	std::shared_lock<std::shared_mutex> lock(chunkData.lock);
+	return chunkData.packet->get(chunkData.version.load(std::memory_order_acquire), [&]() { return encodeChunkDataFrame(chunkData); });
+}
+
+bool writeChunkDataFrame(Buffer& out, const World::ChunkData& chunkData) {
+	std::shared_ptr<const std::vector<uint8_t>> frame = getChunkDataFrame(chunkData);
+	if (!frame) return false;
+	out.writeBytes(*frame);
+	return true;
+}
+
+bool writeChunkDataFrame(Buffer& out, Server& server, int chunkX, int chunkZ) {
+	try {
+		// Decoded once, shared by every player streaming this chunk
+		World::ChunkCache::ChunkRef chunk = server.getWorldQuery().getChunk(chunkX, chunkZ);
+		return writeChunkDataFrame(out, *chunk);
+	} catch (const std::exception& e) {
+		std::cerr << "Error in sendChunkData: " << e.what() << std::endl;
+		return false;
+	}
+}
+
+void sendChunkData(Packet& packet, Server& server, int chunkX, int chunkZ) {
+	std::cout << "=== Sending Chunk Data (" << chunkX << ", " << chunkZ << ") ===\n";
+
+	Buffer finalBuf(ScratchArena::current());
+	// Return without setting packet data - this will cause the packet to be skipped
+	if (!writeChunkDataFrame(finalBuf, server, chunkX, chunkZ)) return;
 
 	packet.getData() = finalBuf;
 	packet.setPacketSize(finalBuf.getData().size());
@@ -103,101 +87,98 @@ void sendChunkData(Packet& packet, Server& server, int chunkX, int chunkZ) {
 	(void)server;
 }
 
-// Helper function to generate empty chunk sections
-Buffer generateEmptyChunkSections() {
-	Buffer	  chunkData;
-	const int NUM_SECTIONS = 24; // Sections for world height -64 to 319
-
-	for (int section = 0; section < NUM_SECTIONS; section++) {
-		// Block count (non-air blocks) - 0 for empty sections
-		chunkData.writeByte(0x00);
-		chunkData.writeByte(0x00);
-
-		// Block states palette - single entry for air
-		chunkData.writeByte(0);	  // Bits per entry (0 = single valued)
-		chunkData.writeVarInt(0); // Air block state ID
-		chunkData.writeVarInt(0); // No data array needed for single valued
-
-		// Biomes palette - single entry for plains
-		chunkData.writeByte(0);	  // Bits per entry (0 = single valued)
-		chunkData.writeVarInt(1); // Plains biome ID
-		chunkData.writeVarInt(0); // No data array needed for single valued
+// Sections of a chunk without any: air and plains everywhere, length-prefixed as in the packet
+const std::vector<uint8_t>& emptyChunkSections() {
+	static const std::vector<uint8_t> blob = []() {
+		Buffer	  sections;
+		const int plains	   = static_cast<int>(World::defaultBiomeId());
+		const int NUM_SECTIONS = World::SECTION_COUNT; // Sections for world height -64 to 319
+
+		for (int section = 0; section < NUM_SECTIONS; section++) {
+			// Block count (non-air blocks) - 0 for empty sections
+			sections.writeUShort(0);
+
+			// Block states - single valued air, no data array follows (1.21.5)
+			sections.writeByte(0);	 // Bits per entry (0 = single valued)
+			sections.writeVarInt(0); // Air block state ID
+
+			// Biomes - single valued plains
+			sections.writeByte(0);		  // Bits per entry (0 = single valued)
+			sections.writeVarInt(plains); // Plains biome ID
+		}
+
+		Buffer blob;
+		blob.writeVarInt(sections.getData().size());
+		blob.writeBytes(sections.getData());
+		return std::vector<uint8_t>(blob.getData().begin(), blob.getData().end());
+	}();
+	return blob;
+}
+
+void writeChunkSections(Buffer& buf, const World::ChunkData& chunkData) {
+	if (chunkData.isEmpty()) {
+		buf.writeBytes(emptyChunkSections());
+		return;
+	}
+
+	// Sized up front for the VarInt length before the sections
+	size_t sectionsSize = 0;
+	for (const World::ChunkSection& section : chunkData.sections) {
+		sectionsSize += sizeof(uint16_t) + section.blocks.networkSize() + section.biomes.networkSize();
 	}
 
-	return chunkData;
+	buf.writeVarInt(sectionsSize);
+	for (const World::ChunkSection& section : chunkData.sections) {
+		buf.writeUShort(section.nonAirBlocks);
+		section.blocks.encode(buf);
+		section.biomes.encode(buf);
+	}
 }
 
-// Helper function to write light data from loaded chunk
+// Light masks and arrays of a chunk, open sky for a chunk without sections
 void writeLightData(Buffer& buf, const World::ChunkData& chunkData) {
-	if (!chunkData.skyLight.empty() || !chunkData.blockLight.empty()) {
-		// Use actual light data from chunk
+	if (!chunkData.isEmpty()) {
 		writeActualLightData(buf, chunkData);
 	} else {
-		// Fallback to default light data
 		writeEmptyLightData(buf);
 	}
 }
 
-void writeActualLightData(Buffer& buf, const World::ChunkData& chunkData) {
-	// This is complex - you need to reconstruct the light data format
-	// For now, fallback to empty light data
-	// TODO: Implement proper light data reconstruction from chunkData.skyLight and chunkData.blockLight
-	writeEmptyLightData(buf);
-}
-
-void writeEmptyLightData(Buffer& buf) {
-	// Sky Light Mask (BitSet) - all sections have sky light
-	buf.writeVarInt(1);
-	buf.writeLong(0x1FFFFFF);
-
-	// Block Light Mask (BitSet) - no block light
-	buf.writeVarInt(1);
-	buf.writeLong(0);
+void writeActualLightData(Buffer& buf, const World::ChunkData& chunkData) { chunkData.light.encode(buf); }
 
-	// Empty Sky Light Mask
-	buf.writeVarInt(1);
-	buf.writeLong(0);
-
-	// Empty Block Light Mask
-	buf.writeVarInt(1);
-	buf.writeLong(0);
-
-	// Sky Light arrays (2048 bytes each for sections with sky light)
-	for (int i = 0; i < 25; i++) {
-		buf.writeVarInt(2048);
-		for (int j = 0; j < 2048; j++) {
-			buf.writeByte(0xFF); // Full sky light
-		}
-	}
-	// No Block Light arrays since mask is 0
+// Light data of a chunk under open sky: full sky light in every section, no block light
+const std::vector<uint8_t>& fullBrightLightData() {
+	static const std::vector<uint8_t> blob = []() {
+		Buffer light;
+		World::ChunkLight().encode(light);
+		return std::vector<uint8_t>(light.getData().begin(), light.getData().end());
+	}();
+	return blob;
 }
 
-void sendPlayerPositionAndLook(Packet& packet, Server& server) {
+void writeEmptyLightData(Buffer& buf) { buf.writeBytes(fullBrightLightData()); }
+
+void sendPlayerPositionAndLook(Packet& packet, Server& server, const SpawnPoint& spawn) {
 	std::cout << "=== Sending Player Position and Look ===\n";
 
-	Buffer buf;
+	Buffer buf(ScratchArena::current());
 
 	// Teleport ID
 	buf.writeVarInt(1);
 
-	// Player position (using writeLong for double precision storage)
-	// Note: This is a simplified approach - ideally you'd add writeDouble to Buffer
-	int64_t x_bits = 0x3FE0000000000000;
-	int64_t y_bits = 0x4050000000000000;
-	int64_t z_bits = 0x3FE0000000000000;
-
-	buf.writeLong(x_bits);
-	buf.writeLong(y_bits);
-	buf.writeLong(z_bits);
+	// Player position
+	buf.writeDouble(spawn.x);
+	buf.writeDouble(spawn.y);
+	buf.writeDouble(spawn.z);
 
 	// Velocity (all zero)
 	buf.writeLong(0);
 	buf.writeLong(0);
 	buf.writeLong(0);
 
-	// Rotation (using writeInt for float storage)
-	buf.writeInt(0);
-	buf.writeInt(0);
+	// Rotation
+	buf.writeFloat(spawn.yaw);
+	buf.writeFloat(spawn.pitch);
 
 	// Flags (0x00 = absolute positioning)
 	buf.writeInt(0x00);
@@ -206,7 +187,7 @@ void sendPlayerPositionAndLook(Packet& packet, Server& server) {
 	int packetIdSize	 = packet.getVarintSize(packetId);
 	int totalPayloadSize = packetIdSize + buf.getData().size();
 
-	Buffer finalBuf;
+	Buffer finalBuf(ScratchArena::current());
 	finalBuf.writeVarInt(totalPayloadSize);
 	finalBuf.writeVarInt(packetId);
 	finalBuf.writeBytes(buf.getData());
@@ -221,7 +202,7 @@ void sendPlayerPositionAndLook(Packet& packet, Server& server) {
 void sendSpawnPosition(Packet& packet, Server& server) {
 	std::cout << "=== Sending Spawn Position ===\n";
 
-	Buffer buf;
+	Buffer buf(ScratchArena::current());
 
 	// Encode position as long (X=0, Y=64, Z=0 packed into 64 bits)
 	// Position format: ((x & 0x3FFFFFF) << 38) | ((z & 0x3FFFFFF) << 12) | (y & 0xFFF)
@@ -235,7 +216,7 @@ void sendSpawnPosition(Packet& packet, Server& server) {
 	int packetIdSize	 = packet.getVarintSize(packetId);
 	int totalPayloadSize = packetIdSize + buf.getData().size();
 
-	Buffer finalBuf;
+	Buffer finalBuf(ScratchArena::current());
 	finalBuf.writeVarInt(totalPayloadSize);
 	finalBuf.writeVarInt(packetId);
 	finalBuf.writeBytes(buf.getData());
@@ -1,5 +1,6 @@
 #include "network/networking.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
 #include "network/server.hpp"
 #include "player.hpp"
 
@@ -17,10 +18,10 @@ void handleFinishConfiguration(Packet& packet, Server& server) {
 	// player->getPlayerName(), "Configuration");
 
 	// Send Finish Configuration packet (0x03)
-	Buffer payload;
+	Buffer payload(ScratchArena::current());
 	payload.writeVarInt(0x03); // Finish Configuration packet ID
 
-	Buffer final;
+	Buffer final(ScratchArena::current());
 	final.writeVarInt(payload.getData().size());
 	final.writeBytes(payload.getData());
 
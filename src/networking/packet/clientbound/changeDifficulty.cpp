@@ -1,14 +1,15 @@
 #include "buffer.hpp"
+#include "network/scratch_arena.hpp"
 #include "packet.hpp"
 
 void changeDifficulty(Packet& packet) {
-	Buffer buff;
+	Buffer buff(ScratchArena::current());
 
 	buff.writeByte(0x0A);
 	buff.writeByte(2);	  // 0 Peaceful; 1 Easy; 2 Normal; 3 Hard
 	buff.writeBool(true); // Is Difficulty locked ?
 
-	Buffer final;
+	Buffer final(ScratchArena::current());
 	final.writeVarInt(buff.getData().size());
 	final.writeBytes(buff.getData());
 
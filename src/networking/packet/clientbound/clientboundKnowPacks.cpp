@@ -1,17 +1,21 @@
 #include "buffer.hpp"
+#include "data/ConfigurationCache.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
+
+#include <string>
 
 // If implementing data packs we should actually send datapack info with the loaded datapacks
 void clientboundKnownPacks(Packet& packet) {
-	Buffer buffer;
+	Buffer buffer(ScratchArena::current());
 
 	buffer.writeByte(0x0E);
 	buffer.writeVarInt(1);
-	buffer.writeString("minecraft");
-	buffer.writeString("core");
-	buffer.writeString("1.21.5");
+	buffer.writeString(std::string(CORE_PACK_NAMESPACE));
+	buffer.writeString(std::string(CORE_PACK_ID));
+	buffer.writeString(std::string(CORE_PACK_VERSION));
 
-	Buffer final;
+	Buffer final(ScratchArena::current());
 	final.writeVarInt(buffer.getData().size());
 	final.writeBytes(buffer.getData());
 
@@ -2,10 +2,14 @@
 #include "network/buffer.hpp"
 #include "network/networking.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
 #include "network/server.hpp"
 #include "player.hpp"
 
+#include <cstdint>
 #include <iostream>
+#include <memory_resource>
+#include <vector>
 
 void handleCookieRequest(Packet& packet, Server& server) {
 	// g_logger->logNetwork(INFO, "Received Cookie Request in Configuration state",
@@ -26,8 +30,9 @@ void handleCookieRequest(Packet& packet, Server& server) {
 	// Read the cookie identifier from the request
 	std::string cookieIdentifier;
 	try {
-		// Create a fresh buffer from the packet data to read from beginning
-		Buffer cookieBuffer(packet.getData().getData());
+		// Fresh buffer over the packet bytes, read from the beginning: a copy of the packet Buffer would keep its position
+		const std::pmr::vector<uint8_t>& bytes = packet.getData().getData();
+		Buffer							 cookieBuffer(std::vector<uint8_t>(bytes.begin(), bytes.end()));
 		cookieIdentifier = cookieBuffer.readString(32767); // Max string length
 														   // g_logger->logNetwork(INFO, "Cookie Request for identifier: '" + cookieIdentifier + "'",
 														   // "Configuration");
@@ -38,14 +43,14 @@ void handleCookieRequest(Packet& packet, Server& server) {
 	}
 
 	// Create Cookie Response packet (0x01)
-	Buffer payload;
+	Buffer payload(ScratchArena::current());
 	payload.writeVarInt(0x01);			   // Cookie Response packet ID
 	payload.writeString(cookieIdentifier); // Echo back the identifier
 
 	// For now, send empty cookie data (no stored cookie)
 	payload.writeByte(0x00); // Has payload: false (no cookie data)
 
-	Buffer final;
+	Buffer final(ScratchArena::current());
 	final.writeVarInt(payload.getData().size());
 	final.writeBytes(payload.getData());
 
@@ -74,10 +79,10 @@ void sendFinishConfigurationAfterCookie(Packet& packet, Server& server) {
 	}
 
 	// Create Finish Configuration packet (0x03)
-	Buffer payload;
+	Buffer payload(ScratchArena::current());
 	payload.writeVarInt(0x03); // Finish Configuration packet ID
 
-	Buffer final;
+	Buffer final(ScratchArena::current());
 	final.writeVarInt(payload.getData().size());
 	final.writeBytes(payload.getData());
 
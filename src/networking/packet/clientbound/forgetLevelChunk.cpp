@@ -0,0 +1,13 @@
+#include "network/buffer.hpp"
+#include "network/networking.hpp"
+#include "network/packet.hpp"
+
+void writeForgetLevelChunkFrame(Buffer& out, int chunkX, int chunkZ) {
+	int packetId = 0x21; // Forget Level Chunk (Unload Chunk) packet ID for protocol 770
+
+	out.writeVarInt(Packet::varintLen(packetId) + 2 * static_cast<int>(sizeof(int32_t)));
+	out.writeVarInt(packetId);
+	// Z before X, as the client reads its ChunkPos
+	out.writeInt(chunkZ);
+	out.writeInt(chunkX);
+}
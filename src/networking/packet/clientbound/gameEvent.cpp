@@ -1,5 +1,6 @@
 #include "network/buffer.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
 #include "player.hpp"
 
 #include <string>
@@ -8,14 +9,14 @@ void gameEventPacket(Packet& packet, Server& server) {
 	Player* player = packet.getPlayer();
 	if (!player) return;
 
-	Buffer buf;
+	Buffer buf(ScratchArena::current());
 
 	buf.writeByte(0x22);
 	buf.writeByte(13);
 	buf.writeFloat(0);
 
 
-	Buffer final;
+	Buffer final(ScratchArena::current());
 
 	final.writeVarInt(buf.getData().size());
 	final.writeBytes(buf.getData());
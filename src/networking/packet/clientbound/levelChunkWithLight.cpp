@@ -1,5 +1,7 @@
 #include "network/buffer.hpp"
+#include "network/networking.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
 #include "player.hpp"
 
 void levelChunkWithLight(Packet& packet, Server& server) {
@@ -8,84 +10,29 @@ void levelChunkWithLight(Packet& packet, Server& server) {
 
     std::cout << "=== Sending Chunk Data (" << chunkX << ", " << chunkZ << ") ===\n";
 
-	Buffer buf;
+	Buffer buf(ScratchArena::current());
+	buf.reserve(64 * 1024); // 25 sky light arrays alone are ~51 KiB, avoid regrowing inside the arena
 
 	try {
 		// Use your new chunk loading system
-		World::Query	 query	   = server.getWorldQuery();
-		World::ChunkData chunkData = query.fetchChunk(chunkX, chunkZ);
+		World::ChunkCache::ChunkRef chunk	 = server.getWorldQuery().getChunk(chunkX, chunkZ);
+		const World::ChunkData&		chunkData = *chunk;
 
 		// Write chunk coordinates
 		buf.writeInt(chunkX);
 		buf.writeInt(chunkZ);
 
-		// Write heightmaps (proper NBT format)
-		if (!chunkData.heightmaps.empty()) {
-			buf.writeBytes(chunkData.heightmaps);
-		} else {
-			// Empty heightmap NBT compound
-			buf.writeByte(0x0A); // TAG_Compound
-			buf.writeVarInt(0);  // Empty name length
-			buf.writeByte(0x00); // TAG_End
-		}
+		// Heightmaps, (type, long array) pairs since 1.21.5
+		chunkData.heightmaps.encode(buf);
 
 		// Write chunk data
-		if (!chunkData.blockData.empty()) {
-			buf.writeVarInt(chunkData.blockData.size());
-			buf.writeBytes(chunkData.blockData);
-		} else {
-			// Generate simple empty chunk inline
-			Buffer	  emptyData;
-			const int NUM_SECTIONS = 24;
-
-			for (int section = 0; section < NUM_SECTIONS; section++) {
-				// Block count (Short - number of non-air blocks)
-				emptyData.writeUShort(0); // All air blocks
-
-				// Block states palette
-				emptyData.writeByte(0);	  // Bits per entry (single value)
-				emptyData.writeVarInt(0); // Air block state ID (should be 0)
-				emptyData.writeVarInt(0); // Data array length (no data needed for single value)
-
-				// Biomes palette  
-				emptyData.writeByte(0);	  // Bits per entry (single value)
-				emptyData.writeVarInt(0); // Safest biome ID (should always exist)
-				emptyData.writeVarInt(0); // Data array length (no data needed for single value)
-			}
-
-			buf.writeVarInt(emptyData.getData().size());
-			buf.writeBytes(emptyData.getData());
-		}
+		writeChunkSections(buf, chunkData);
 
 		// Block entities
 		buf.writeVarInt(0);
 
 		// Light data (proper format)
-		// Sky Light Mask
-		buf.writeVarInt(1);		  // Sky light mask array length
-		buf.writeLong(0x1FFFFFF); // Mask for sections 0-24 (all have sky light)
-		
-		// Block Light Mask  
-		buf.writeVarInt(1);	// Block light mask array length
-		buf.writeLong(0);	// No block light sections
-		
-		// Empty Sky Light Mask
-		buf.writeVarInt(1);	// Empty sky light mask array length
-		buf.writeLong(0);	// No empty sky light sections
-		
-		// Empty Block Light Mask
-		buf.writeVarInt(1);	// Empty block light mask array length  
-		buf.writeLong(0);	// No empty block light sections
-
-		// Sky light data arrays (25 sections: -4 to 20)
-		for (int i = 0; i < 25; i++) {
-			buf.writeVarInt(2048); // Light array size (16x16x16 / 2)
-			for (int j = 0; j < 2048; j++) {
-				buf.writeByte(0xFF); // Full sky light (15 << 4 | 15)
-			}
-		}
-		
-		// No block light arrays since mask is 0
+		writeLightData(buf, chunkData);
 
 	} catch (const std::exception& e) {
 		std::cerr << "Error in sendChunkData: " << e.what() << std::endl;
@@ -3,6 +3,7 @@
 #include "network/buffer.hpp"
 #include "network/networking.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
 #include "network/server.hpp"
 #include "player.hpp"
 
@@ -15,12 +16,42 @@ void handleLoginStartPacket(Packet& packet, Server& server) {
 
 	std::string username = packet.getData().readString(16);
 	player->setPlayerName(username);
+	player->setUUID(UUID::fromOfflinePlayer(username));
 
-	UUID uuid = UUID::fromOfflinePlayer(username);
-	player->setUUID(uuid);
+	// max-players is enforced here, before any configuration work is spent on the connection
+	if (server.getNetworkManager().getAdmission().reserve(*player, packet) == AdmissionController::Seat::ServerFull) {
+		g_logger->logNetwork(INFO, "Server full, refusing " + username, "Login");
+		writeLoginDisconnect(packet, "Server is full");
+		// The sender closes the connection once the disconnect is out
+		player->setPlayerState(PlayerState::None);
+		return;
+	}
+
+	// Login Success is sent by the login sequence once the player gets a configuration slot
+	runLoginSequence(packet, server);
+	packet.setReturnPacket(PACKET_OK);
+}
+
+void writeLoginDisconnect(Packet& packet, const std::string& reason) {
+	Buffer payload(ScratchArena::current());
+	payload.writeVarInt(0x00); // Disconnect (login) packet ID
+	payload.writeString("{\"text\":\"" + reason + "\"}");
+
+	Buffer final(ScratchArena::current());
+	final.writeVarInt(payload.getData().size());
+	final.writeBytes(payload.getData());
+
+	packet.getData() = final;
+	packet.setReturnPacket(PACKET_SEND);
+	packet.setPacketSize(final.getData().size());
+}
+
+void writeLoginSuccess(Packet& packet, Player& player) {
+	UUID		uuid	 = player.getUUID();
+	std::string username = player.getPlayerName();
 
 	// Build Login Success packet payload
-	Buffer payload;
+	Buffer payload(ScratchArena::current());
 	payload.writeUUID(uuid);
 	payload.writeString(username);
 	payload.writeVarInt(0); // properties length (no properties)
@@ -41,7 +72,7 @@ void handleLoginStartPacket(Packet& packet, Server& server) {
 	int packetIdVarintSize = packet.getVarintSize(packetId);
 	int totalPayloadSize   = packetIdVarintSize + payloadSize;
 
-	Buffer final;
+	Buffer final(ScratchArena::current());
 	final.writeVarInt(totalPayloadSize); // Total packet size
 	final.writeVarInt(packetId);		 // Login Success packet ID (0x02)
 	final.writeBytes(payload.getData()); // UUID + username + properties
@@ -62,8 +93,7 @@ void handleLoginStartPacket(Packet& packet, Server& server) {
 
 	// Don't transition to Configuration yet - wait for Login Acknowledged
 	g_logger->logNetwork(INFO,
-						 "Login Success sent for user: " + username + ", UUID: " + uuid.toString() +
+						 "Login Success built for user: " + username + ", UUID: " + uuid.toString() +
 								 ", packet size: " + std::to_string(final.getData().size()),
 						 "Login");
-	(void)server;
 }
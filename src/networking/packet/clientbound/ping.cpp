@@ -1,6 +1,7 @@
 #include "network/buffer.hpp"
 #include "network/networking.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
 #include "network/server.hpp"
 #include "player.hpp"
 
@@ -22,7 +23,7 @@ void handlePingPacket(Packet& packet, Server& server) {
 	int packetIdVarintSize = packet.getVarintSize(packetId);
 	int totalPayloadSize   = packetIdVarintSize + 8;
 
-	Buffer buf;
+	Buffer buf(ScratchArena::current());
 	buf.writeVarInt(totalPayloadSize);
 	buf.writeVarInt(packetId);
 	buf.writeLong(timestamp);
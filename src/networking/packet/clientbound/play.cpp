@@ -1,14 +1,17 @@
 #include "network/buffer.hpp"
+#include "network/chunk_view.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
 #include "player.hpp"
 
+#include <algorithm>
 #include <string>
 
 void writePlayPacket(Packet& packet, Server& server) {
 	Player* player = packet.getPlayer();
 	if (!player) return;
 
-	Buffer buf;
+	Buffer buf(ScratchArena::current());
 
 	buf.writeByte(0x2B);
 
@@ -27,8 +30,8 @@ void writePlayPacket(Packet& packet, Server& server) {
 	// 4. Max Players
 	buf.writeVarInt(20);
 
-	// 5. View Distance
-	buf.writeVarInt(10);
+	// 5. View Distance, the cap of the chunk views
+	buf.writeVarInt(std::clamp(server.getConfig().getViewDistance(), ChunkView::MIN_VIEW_DISTANCE, ChunkView::MAX_VIEW_DISTANCE));
 
 	// 6. Simulation Distance
 	buf.writeVarInt(10);
@@ -83,7 +86,7 @@ void writePlayPacket(Packet& packet, Server& server) {
 	// 22. Enforces Secure Chat
 	buf.writeBool(false);
 
-	Buffer final;
+	Buffer final(ScratchArena::current());
 
 	final.writeVarInt(buf.getData().size());
 	final.writeBytes(buf.getData());
@@ -92,5 +95,4 @@ void writePlayPacket(Packet& packet, Server& server) {
 	packet.getData() = final;
 	packet.setPacketSize(final.getData().size());
 	packet.setReturnPacket(PACKET_SEND);
-	(void)server;
 }
@@ -1,15 +1,16 @@
 #include "buffer.hpp"
+#include "network/scratch_arena.hpp"
 #include "packet.hpp"
 
 void playerAbilities(Packet& packet) {
-	Buffer buff;
+	Buffer buff(ScratchArena::current());
 
 	buff.writeByte(0x39);
 	buff.writeByte(0x08);  // Invulnerable 0x01; Flying 0x02; Allow Flying 0x04; Creative Mode 0x08;
 	buff.writeFloat(0.05); // Flight speed
 	buff.writeFloat(1);	   // Fov modifier
 
-	Buffer final;
+	Buffer final(ScratchArena::current());
 	final.writeVarInt(buff.getData().size());
 	final.writeBytes(buff.getData());
 
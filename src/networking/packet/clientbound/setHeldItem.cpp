@@ -1,13 +1,14 @@
 #include "buffer.hpp"
+#include "network/scratch_arena.hpp"
 #include "packet.hpp"
 
 void setHeldItem(Packet& packet) {
-	Buffer buff;
+	Buffer buff(ScratchArena::current());
 
 	buff.writeByte(0x62);
 	buff.writeVarInt(3); // 0-8 hand slots --> Should get it from player data when implemented
 
-	Buffer final;
+	Buffer final(ScratchArena::current());
 	final.writeVarInt(buff.getData().size());
 	final.writeBytes(buff.getData());
 
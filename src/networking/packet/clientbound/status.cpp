@@ -2,6 +2,7 @@
 #include "network/buffer.hpp"
 #include "network/networking.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
 #include "network/server.hpp"
 #include "player.hpp"
 
@@ -30,7 +31,7 @@ void handleStatusPacket(Packet& packet, Server& server) {
 	int jsonLenVarintSize  = packet.getVarintSize(jsonLen);
 	int totalPayloadSize   = packetIdVarintSize + jsonLenVarintSize + jsonLen;
 
-	Buffer buf;
+	Buffer buf(ScratchArena::current());
 	buf.writeVarInt(totalPayloadSize);
 	buf.writeVarInt(packetId);
 	buf.writeVarInt(jsonLen);
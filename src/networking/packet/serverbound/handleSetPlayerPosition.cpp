@@ -0,0 +1,19 @@
+#include "network/chunk_view.hpp"
+#include "network/packet.hpp"
+#include "network/server.hpp"
+#include "player.hpp"
+
+// Set Player Position (0x1D) and Set Player Position and Rotation (0x1E) both start with the feet position
+void handleSetPlayerPosition(Packet& packet, Server& server) {
+	Player* player = packet.getPlayer();
+	Buffer& data   = packet.getData();
+
+	double x = data.readDouble();
+	data.readDouble(); // feet y
+	double z = data.readDouble();
+
+	// Only the chunk matters for now: crossing into another one moves the view of the player
+	player->getChunkView()->moveTo(packet, server, x, z);
+
+	packet.setReturnPacket(PACKET_OK);
+}
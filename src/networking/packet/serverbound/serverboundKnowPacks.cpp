@@ -3,16 +3,15 @@
 #include "network/packet.hpp"
 
 #include <iostream>
+#include <vector>
 
-void serverboundKnownPacks(Packet& packet) {
-	int size = packet.getData().readVarInt();
+std::vector<Buffer::KnownPack> serverboundKnownPacks(Packet& packet) {
+	std::vector<Buffer::KnownPack> packs = packet.getData().readKnownPacks();
 
-	std::cout << "Received " << size << " known packs." << std::endl;
+	std::cout << "Received " << packs.size() << " known packs." << std::endl;
 
-	for (int i = 0; i < size; ++i) {
-		std::string name	= packet.getData().readString(10000);
-		std::string id		= packet.getData().readString(10000);
-		std::string version = packet.getData().readString(10000);
-		std::cout << "Pack " << i + 1 << ": " << name << " | " << id << " | " << version << std::endl;
+	for (size_t i = 0; i < packs.size(); ++i) {
+		std::cout << "Pack " << i + 1 << ": " << packs[i].nameSpace << " | " << packs[i].id << " | " << packs[i].version << std::endl;
 	}
+	return packs;
 }
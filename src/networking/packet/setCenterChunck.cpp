@@ -2,26 +2,30 @@
 #include "network/buffer.hpp"
 #include "network/networking.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
 #include "network/server.hpp"
 #include "player.hpp"
 
 #include <iostream>
 
-void writeSetCenterPacket(Packet& packet, Server& server) {
-	std::cout << "=== center chunk packet write init ===\n";
-
-	Buffer buf;
-	buf.writeVarInt(0);
-	buf.writeVarInt(0);
+void writeSetCenterFrame(Buffer& out, int chunkX, int chunkZ) {
+	Buffer buf(ScratchArena::current());
+	buf.writeVarInt(chunkX);
+	buf.writeVarInt(chunkZ);
 
 	int packetId		 = 0x57;
-	int packetIdSize	 = packet.getVarintSize(packetId);
-	int totalPayloadSize = packetIdSize + buf.getData().size();
+	int totalPayloadSize = Packet::varintLen(packetId) + buf.getData().size();
+
+	out.writeVarInt(totalPayloadSize);
+	out.writeVarInt(packetId);
+	out.writeBytes(buf.getData());
+}
+
+void writeSetCenterPacket(Packet& packet, Server& server) {
+	std::cout << "=== center chunk packet write init ===\n";
 
-	Buffer finalBuf;
-	finalBuf.writeVarInt(totalPayloadSize);
-	finalBuf.writeVarInt(packetId);
-	finalBuf.writeBytes(buf.getData());
+	Buffer finalBuf(ScratchArena::current());
+	writeSetCenterFrame(finalBuf, 0, 0);
 
 	packet.getData() = finalBuf;
 	packet.setPacketSize(finalBuf.getData().size());
@@ -2,6 +2,7 @@
 #include "network/buffer.hpp"
 #include "network/networking.hpp"
 #include "network/packet.hpp"
+#include "network/scratch_arena.hpp"
 #include "network/server.hpp"
 #include "player.hpp"
 
@@ -10,7 +11,7 @@
 void sendPlayerAbilities(Packet& packet, Server& server) {
 	std::cout << "=== Sending Player Abilities ===\n";
 
-	Buffer buf;
+	Buffer buf(ScratchArena::current());
 
 	// Flags (byte) - bit field for player abilities
 	uint8_t flags = 0x00;
@@ -32,7 +33,7 @@ void sendPlayerAbilities(Packet& packet, Server& server) {
 	int packetIdSize	 = packet.getVarintSize(packetId);
 	int totalPayloadSize = packetIdSize + buf.getData().size();
 
-	Buffer finalBuf;
+	Buffer finalBuf(ScratchArena::current());
 	finalBuf.writeVarInt(totalPayloadSize);
 	finalBuf.writeVarInt(packetId);
 	finalBuf.writeBytes(buf.getData());
@@ -47,7 +48,7 @@ void sendPlayerAbilities(Packet& packet, Server& server) {
 void sendSetHealth(Packet& packet, Server& server) {
 	std::cout << "=== Sending Set Health ===\n";
 
-	Buffer buf;
+	Buffer buf(ScratchArena::current());
 
 	// Health (float) - 20.0 = full health
 	// Convert 20.0f to IEEE 754 bits: 0x41A00000
@@ -64,7 +65,7 @@ void sendSetHealth(Packet& packet, Server& server) {
 	int packetIdSize	 = packet.getVarintSize(packetId);
 	int totalPayloadSize = packetIdSize + buf.getData().size();
 
-	Buffer finalBuf;
+	Buffer finalBuf(ScratchArena::current());
 	finalBuf.writeVarInt(totalPayloadSize);
 	finalBuf.writeVarInt(packetId);
 	finalBuf.writeBytes(buf.getData());
@@ -79,7 +80,7 @@ void sendSetHealth(Packet& packet, Server& server) {
 void sendSetExperience(Packet& packet, Server& server) {
 	std::cout << "=== Sending Set Experience ===\n";
 
-	Buffer buf;
+	Buffer buf(ScratchArena::current());
 
 	// Experience bar (float) - 0.0 to 1.0 (progress to next level)
 	// Convert 0.0f to IEEE 754 bits: 0x00000000
@@ -95,7 +96,7 @@ void sendSetExperience(Packet& packet, Server& server) {
 	int packetIdSize	 = packet.getVarintSize(packetId);
 	int totalPayloadSize = packetIdSize + buf.getData().size();
 
-	Buffer finalBuf;
+	Buffer finalBuf(ScratchArena::current());
 	finalBuf.writeVarInt(totalPayloadSize);
 	finalBuf.writeVarInt(packetId);
 	finalBuf.writeBytes(buf.getData());
@@ -110,7 +111,7 @@ void sendSetExperience(Packet& packet, Server& server) {
 void sendUpdateTime(Packet& packet, Server& server) {
 	std::cout << "=== Sending Update Time ===\n";
 
-	Buffer buf;
+	Buffer buf(ScratchArena::current());
 
 	// World Age (Long) - total ticks since world creation
 	buf.writeLong(0);
@@ -125,7 +126,7 @@ void sendUpdateTime(Packet& packet, Server& server) {
 	int packetIdSize	 = packet.getVarintSize(packetId);
 	int totalPayloadSize = packetIdSize + buf.getData().size();
 
-	Buffer finalBuf;
+	Buffer finalBuf(ScratchArena::current());
 	finalBuf.writeVarInt(totalPayloadSize);
 	finalBuf.writeVarInt(packetId);
 	finalBuf.writeBytes(buf.getData());
@@ -140,7 +141,7 @@ void sendUpdateTime(Packet& packet, Server& server) {
 void sendSetHeldItem(Packet& packet, Server& server) {
 	std::cout << "=== Sending Set Held Item ===\n";
 
-	Buffer buf;
+	Buffer buf(ScratchArena::current());
 
 	// Slot (VarInt) - hotbar slot selected (0-8)
 	buf.writeVarInt(0); // First slot selected
@@ -149,7 +150,7 @@ void sendSetHeldItem(Packet& packet, Server& server) {
 	int packetIdSize	 = packet.getVarintSize(packetId);
 	int totalPayloadSize = packetIdSize + buf.getData().size();
 
-	Buffer finalBuf;
+	Buffer finalBuf(ScratchArena::current());
 	finalBuf.writeVarInt(totalPayloadSize);
 	finalBuf.writeVarInt(packetId);
 	finalBuf.writeBytes(buf.getData());
@@ -1,12 +1,13 @@
 #include "buffer.hpp"
+#include "network/scratch_arena.hpp"
 #include "packet.hpp"
 
 void templateClientBoundPacket(Packet& packet) {
-	Buffer buff;
+	Buffer buff(ScratchArena::current());
 
 	// Add packet id, and data.
 
-	Buffer final;
+	Buffer final(ScratchArena::current());
 	final.writeVarInt(buff.getData().size());
 	final.writeBytes(buff.getData());
 
@@ -0,0 +1,203 @@
+#include "lib/filesystem.hpp"
+#include "lib/nbtParser.hpp"
+#include "logger.hpp"
+#include "network/buffer.hpp"
+#include "network/networking.hpp"
+#include "network/server.hpp"
+#include "network/spawn_preload.hpp"
+#include "network/task.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+	// Saved position of a returning player, world spawn for everyone else
+	SpawnPoint readSpawnPoint(Server& server, const UUID& uuid) {
+		const World::LevelDat& level = server.getWorldData();
+		SpawnPoint			   spawn{level.SpawnX + 0.5, static_cast<double>(level.SpawnY), level.SpawnZ + 0.5, 0.0f, 0.0f};
+
+		std::filesystem::path path = getPath().parent_path() / server.getConfig().getWorldName() / "playerdata" / (uuid.toString() + ".dat");
+		if (!std::filesystem::exists(path)) return spawn;
+
+		try {
+			nbt::Parser				parser;
+			nbt::NBT				data = parser.parse(World::Manager::decompressGzip(path));
+			const nbt::TagCompound& root = data.getRoot();
+
+			if (root.contains("Pos")) {
+				const auto& pos = root.at("Pos").get<std::shared_ptr<nbt::TagList>>();
+				if (pos && pos->size() == 3) {
+					spawn.x = (*pos)[0].get<nbt::TagDouble>();
+					spawn.y = (*pos)[1].get<nbt::TagDouble>();
+					spawn.z = (*pos)[2].get<nbt::TagDouble>();
+				}
+			}
+			if (root.contains("Rotation")) {
+				const auto& rotation = root.at("Rotation").get<std::shared_ptr<nbt::TagList>>();
+				if (rotation && rotation->size() == 2) {
+					spawn.yaw	= (*rotation)[0].get<nbt::TagFloat>();
+					spawn.pitch = (*rotation)[1].get<nbt::TagFloat>();
+				}
+			}
+		} catch (const std::exception& e) {
+			g_logger->logGameInfo(WARN, "Unreadable player data " + path.string() + ": " + e.what(), "SpawnPreload");
+		}
+		return spawn;
+	}
+} // namespace
+
+SpawnPreload::SpawnPreload()
+	: _lock(), _ready(false), _waiter(), _waiterConnection(), _spawn{0.5, 64.0, 0.5, 0.0f, 0.0f}, _centerX(0), _centerZ(0), _startTime(), _chunks(),
+	  _pending(0), _chunkCount(0), _chunkFrames() {}
+
+std::shared_ptr<SpawnPreload> SpawnPreload::start(Server& server, const UUID& uuid) {
+	auto preload = std::make_shared<SpawnPreload>();
+	// Jobs and chunk callbacks own a reference: the preload outlives a player that disconnects mid-login
+	server.getNetworkManager().runBlocking([preload, &server, uuid]() {
+		try {
+			preload->_startTime = std::chrono::steady_clock::now();
+			preload->_spawn		= readSpawnPoint(server, uuid);
+			requestChunks(server, preload);
+		} catch (const std::exception& e) {
+			g_logger->logGameInfo(ERROR, "Spawn preload failed: " + std::string(e.what()), "SpawnPreload");
+			preload->finish();
+		}
+	});
+	return preload;
+}
+
+void SpawnPreload::requestChunks(Server& server, const std::shared_ptr<SpawnPreload>& preload) {
+	preload->_centerX = static_cast<int>(std::floor(preload->_spawn.x)) >> 4;
+	preload->_centerZ = static_cast<int>(std::floor(preload->_spawn.z)) >> 4;
+
+	// Closest ring first, so the chunk under the player is loaded and decoded first
+	std::vector<std::pair<World::ChunkKey, uint32_t>> ring;
+	for (int distance = 0; distance <= SPAWN_CHUNK_RADIUS; distance++) {
+		for (int dx = -distance; dx <= distance; dx++) {
+			for (int dz = -distance; dz <= distance; dz++) {
+				if (std::max(std::abs(dx), std::abs(dz)) != distance) continue;
+				ring.emplace_back(World::ChunkKey{World::Dimension::Overworld, preload->_centerX + dx, preload->_centerZ + dz},
+								  static_cast<uint32_t>(distance));
+			}
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(preload->_lock);
+		preload->_chunks.assign(ring.size(), nullptr);
+		// Set before the first request: cached chunks call back inline
+		preload->_pending = ring.size();
+	}
+	World::ChunkLoader& loader = server.getChunkLoader();
+	for (size_t i = 0; i < ring.size(); i++) {
+		loader.request(ring[i].first, ring[i].second,
+					   [preload, &server, i](World::ChunkCache::ChunkRef chunk) { chunkLoaded(server, preload, i, std::move(chunk)); });
+	}
+}
+
+void SpawnPreload::chunkLoaded(Server& server, const std::shared_ptr<SpawnPreload>& preload, size_t index, World::ChunkCache::ChunkRef chunk) {
+	{
+		std::lock_guard<std::mutex> lock(preload->_lock);
+		preload->_chunks[index] = std::move(chunk);
+		if (--preload->_pending > 0) return;
+	}
+
+	// Last one in: loader callbacks must not block, encoding goes back to the blocking pool
+	server.getNetworkManager().runBlocking([preload, &server]() {
+		try {
+			preload->encode(server);
+		} catch (const std::exception& e) {
+			g_logger->logGameInfo(ERROR, "Spawn preload failed: " + std::string(e.what()), "SpawnPreload");
+		}
+		preload->finish();
+	});
+}
+
+void SpawnPreload::encode(Server& server) {
+	// Blocking threads have no scratch arena, this Buffer is heap backed
+	Buffer frames;
+	writeSetCenterFrame(frames, _centerX, _centerZ);
+	writeChunkBatchStartFrame(frames);
+
+	size_t chunks = 0;
+	for (const World::ChunkCache::ChunkRef& chunk : _chunks) {
+		if (chunk && writeChunkDataFrame(frames, *chunk)) chunks++;
+	}
+	writeChunkBatchFinishedFrame(frames, static_cast<int>(chunks));
+
+	_chunkCount	 = chunks;
+	_chunkFrames = std::make_shared<const std::vector<uint8_t>>(frames.getData().begin(), frames.getData().end());
+	// The payload is all the client needs, let the cache evict the decoded chunks
+	_chunks.clear();
+
+	auto					 elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _startTime);
+	World::ChunkCache::Stats cache	 = server.getWorldManager().getChunkCache().getStats();
+	g_logger->logGameInfo(INFO,
+						  "Spawn area preloaded around chunk (" + std::to_string(_centerX) + ", " + std::to_string(_centerZ) + "): " +
+								  std::to_string(chunks) + " chunks, " + std::to_string(_chunkFrames->size()) + " bytes in " +
+								  std::to_string(elapsed.count()) + " ms (chunk cache: " + std::to_string(cache.entries) + " entries, " +
+								  std::to_string(cache.bytes >> 10) + " KiB, hit rate " + std::to_string(static_cast<int>(cache.hitRate() * 100)) + "%)",
+						  "SpawnPreload");
+}
+
+void SpawnPreload::finish() {
+	std::coroutine_handle<> waiter;
+	ConnectionToken			connection;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		_ready	   = true;
+		waiter	   = std::exchange(_waiter, nullptr);
+		connection = std::move(_waiterConnection);
+	}
+	if (waiter) connection->resume(waiter);
+}
+
+void SpawnPreload::close() {
+	std::coroutine_handle<> waiter;
+	ConnectionToken			connection;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		waiter	   = std::exchange(_waiter, nullptr);
+		connection = std::move(_waiterConnection);
+	}
+	if (waiter) connection->resume(waiter);
+}
+
+// ========================================
+// Awaiter
+// ========================================
+
+SpawnPreload::Awaiter SpawnPreload::ready(std::shared_ptr<SpawnPreload> preload, ConnectionToken connection) {
+	return Awaiter(std::move(preload), std::move(connection));
+}
+
+SpawnPreload::Awaiter::Awaiter(std::shared_ptr<SpawnPreload> preload, ConnectionToken connection)
+	: _preload(std::move(preload)), _connection(std::move(connection)) {}
+
+bool SpawnPreload::Awaiter::await_ready() const {
+	std::lock_guard<std::mutex> lock(_preload->_lock);
+	return _preload->_ready;
+}
+
+bool SpawnPreload::Awaiter::await_suspend(std::coroutine_handle<> handle) {
+	std::lock_guard<std::mutex> lock(_preload->_lock);
+	// Closed: carry on into await_resume, which unwinds the sequence
+	if (_preload->_ready || !_connection->isOpen()) return false;
+	_preload->_waiter			= handle;
+	_preload->_waiterConnection = _connection;
+	return true;
+}
+
+void SpawnPreload::Awaiter::await_resume() const {
+	if (!_connection->isOpen()) throw ConnectionClosed();
+}
@@ -1,4 +1,5 @@
 #include "config.hpp"
+#include "data/TagUtils.hpp"
 #include "lib/filesystem.hpp"
 #include "lib/json.hpp"
 #include "logger.hpp"
@@ -7,19 +8,25 @@
 #include "player.hpp"
 #include "world/world.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdio>
 #include <exception>
 #include <filesystem>
 #include <iostream>
+#include <optional>
 #include <string>
 #include <unistd.h>
 
 using json = nlohmann::json;
 
-Server::Server() : _playerLst(), _config(), _networkManager(nullptr), _worldQuery(_worldManager) {}
+Server::Server()
+	: _playerLst(), _config(), _networkManager(nullptr), _worldQuery(_worldManager), _chunkLoader(_worldQuery, _worldManager.getChunkCache()),
+	  _configurationCache() {}
 
 Server::~Server() {
+	// Loader callbacks queue chunks on the network manager: no callback may run once it is gone
+	_chunkLoader.stop();
 	if (_networkManager) {
 		_networkManager->stopThreads();
 		delete _networkManager;
@@ -45,6 +52,13 @@ int Server::start_server() {
 				return 1;
 			}
 
+			_worldManager.setWorldPath(levelDatPath.parent_path());
+			_worldManager.getChunkCache().setBudget(static_cast<size_t>(std::max(0, _config.getChunkCacheSize())) * 1024 * 1024);
+			if (std::optional<World::RegionCompression> compression = World::parseRegionCompression(_config.getRegionCompression())) {
+				_worldManager.setRegionCompression(*compression);
+			} else {
+				g_logger->logGameInfo(WARN, "Unknown region-compression \"" + _config.getRegionCompression() + "\", writing chunks with deflate", "SERVER");
+			}
 			_worldData = _worldManager.loadLevelDat(levelDatPath);
 
 			// Log world information
@@ -74,6 +88,18 @@ int Server::start_server() {
 		World::ChunkData chunk = _worldQuery.fetchChunk(0, 0);
 		printChunkInfo(chunk);
 
+		// Registry Data + Update Tags are identical for every client: encode them (and index the tags) before accepting anyone
+		try {
+			_configurationCache.build();
+			TagUtils::buildIndex();
+		} catch (const std::exception& e) {
+			g_logger->logGameInfo(ERROR, "Failed to encode configuration frames: " + std::string(e.what()), "SERVER");
+			return 1;
+		}
+
+		// Chunk reads never run on the network workers
+		_chunkLoader.start();
+
 		size_t workerCount = 4;
 		if (workerCount == 0) workerCount = 4; // fallback
 
@@ -140,9 +166,11 @@ void Server::removeTempPlayer(Player* player) {
 	if (!player) {
 		return;
 	}
-	int							socket = player->getSocketFd();
-	std::lock_guard<std::mutex> lock(_tempPlayerLock);
-	_tempPlayerLst.erase(socket);
+	int socket = player->getSocketFd();
+	{
+		std::lock_guard<std::mutex> lock(_tempPlayerLock);
+		_tempPlayerLst.erase(socket);
+	}
 	delete player;
 	// g_logger->logGameInfo(INFO, "Removed temp player from socket " + std::to_string(socket),
 	// "Server");
@@ -168,32 +196,28 @@ void Server::removePlayerFromAnyList(Player* player) {
 	}
 	int socket = player->getSocketFd();
 
+	// Deleted outside the list locks: the destructor waits for a connection sequence of the player to suspend
 	{
 		std::lock_guard<std::mutex> lock(_tempPlayerLock);
 		auto						temp_it = _tempPlayerLst.find(socket);
 		if (temp_it != _tempPlayerLst.end()) {
 			_tempPlayerLst.erase(socket);
-			delete player;
 			// g_logger->logGameInfo(INFO, "Removed temp player from socket " +
 			// std::to_string(socket), "Server");
-			return;
+			socket = -1;
 		}
 	}
 
-	{
+	if (socket != -1) {
 		std::lock_guard<std::mutex> lock(_playerLock);
 		auto						main_it = _playerLst.find(socket);
 		if (main_it != _playerLst.end()) {
 			_playerLst.erase(socket);
-			delete player;
 			// g_logger->logGameInfo(INFO, "Removed main player from socket " +
 			// std::to_string(socket), "Server");
-			return;
 		}
 	}
 	delete player;
-	// g_logger->logGameInfo(INFO, "Deleted orphaned player from socket " + std::to_string(socket),
-	// "Server");
 }
 
 void Server::addPlayerToSample(const std::string& name) { _playerSample.push_back(name); }
@@ -217,52 +241,45 @@ void Server::printChunkInfo(const World::ChunkData& chunk) {
 	g_logger->logGameInfo(INFO, "Chunk Empty: " + std::string(chunk.isEmpty() ? "true" : "false"), "SERVER");
 
 	// Data vector sizes
-	g_logger->logGameInfo(INFO, "Block Data Size: " + std::to_string(chunk.blockData.size()) + " bytes", "SERVER");
-	g_logger->logGameInfo(INFO, "Biome Data Size: " + std::to_string(chunk.biomeData.size()) + " bytes", "SERVER");
-	g_logger->logGameInfo(INFO, "Heightmaps Size: " + std::to_string(chunk.heightmaps.size()) + " bytes", "SERVER");
+	size_t sectionsSize = 0;
+	for (const World::ChunkSection& section : chunk.sections) sectionsSize += section.blocks.memoryUsage() + section.biomes.memoryUsage();
+	g_logger->logGameInfo(INFO, "Sections: " + std::to_string(chunk.sections.size()) + " (" + std::to_string(sectionsSize) + " bytes)", "SERVER");
+	g_logger->logGameInfo(INFO, "Heightmaps Size: " + std::to_string(sizeof(chunk.heightmaps)) + " bytes", "SERVER");
 	g_logger->logGameInfo(INFO, "Block Entities Size: " + std::to_string(chunk.blockEntities.size()) + " bytes", "SERVER");
-	g_logger->logGameInfo(INFO, "Sky Light Size: " + std::to_string(chunk.skyLight.size()) + " bytes", "SERVER");
-	g_logger->logGameInfo(INFO, "Block Light Size: " + std::to_string(chunk.blockLight.size()) + " bytes", "SERVER");
+	g_logger->logGameInfo(INFO, "Light Size: " + std::to_string(chunk.light.memoryUsage()) + " bytes", "SERVER");
 
 	// Calculate total data size
-	size_t totalSize = chunk.blockData.size() + chunk.biomeData.size() + chunk.heightmaps.size() + chunk.blockEntities.size() +
-					   chunk.skyLight.size() + chunk.blockLight.size();
+	size_t totalSize = sectionsSize + sizeof(chunk.heightmaps) + chunk.blockEntities.size() + chunk.light.memoryUsage();
 	g_logger->logGameInfo(INFO, "Total Chunk Data Size: " + std::to_string(totalSize) + " bytes", "SERVER");
 
 	// Analyze data content
-	if (!chunk.blockData.empty()) {
-		g_logger->logGameInfo(INFO, "Block Data: Contains " + std::to_string(chunk.blockData.size()) + " bytes of NBT block sections", "SERVER");
+	if (!chunk.isEmpty()) {
+		size_t nonAirBlocks = 0;
+		size_t singleValued = 0;
+		for (const World::ChunkSection& section : chunk.sections) {
+			nonAirBlocks += section.nonAirBlocks;
+			singleValued += section.blocks.getMode() == World::PalettedContainer::Mode::Single;
+		}
+		g_logger->logGameInfo(INFO,
+							  "Block Data: " + std::to_string(nonAirBlocks) + " non-air blocks, " + std::to_string(singleValued) +
+									  " single valued sections",
+							  "SERVER");
 
-		// Try to parse some basic NBT info if possible
-		try {
-			if (chunk.blockData.size() > 10) {
-				// Show first few bytes as hex for debugging
-				std::string hexStr = "First 10 bytes (hex): ";
-				for (size_t i = 0; i < std::min(static_cast<size_t>(10), chunk.blockData.size()); ++i) {
-					char hexChar[4];
-					snprintf(hexChar, sizeof(hexChar), "%02X ", static_cast<unsigned char>(chunk.blockData[i]));
-					hexStr += hexChar;
-				}
-				g_logger->logGameInfo(DEBUG, hexStr, "SERVER");
-			}
-		} catch (const std::exception& e) {
-			g_logger->logGameInfo(DEBUG, "Could not analyze block data: " + std::string(e.what()), "SERVER");
+		std::string biomes = "Biomes (lowest section):";
+		for (uint32_t biome : chunk.sections.front().biomes.getPalette()) {
+			biomes += ' ';
+			biomes += std::to_string(biome);
 		}
+		g_logger->logGameInfo(DEBUG, biomes, "SERVER");
 	} else {
 		g_logger->logGameInfo(INFO, "Block Data: Empty (chunk not generated or air-only)", "SERVER");
 	}
 
-	if (!chunk.biomeData.empty()) {
-		g_logger->logGameInfo(INFO, "Biome Data: Contains biome information for 4x4x4 block cells", "SERVER");
-	} else {
-		g_logger->logGameInfo(INFO, "Biome Data: Empty (default biome used)", "SERVER");
-	}
-
-	if (!chunk.heightmaps.empty()) {
-		g_logger->logGameInfo(INFO, "Heightmaps: Contains terrain height data for performance optimization", "SERVER");
-	} else {
-		g_logger->logGameInfo(INFO, "Heightmaps: Empty (not calculated)", "SERVER");
-	}
+	g_logger->logGameInfo(INFO,
+						  "Heightmaps: surface at y " + std::to_string(chunk.heightmaps.getY(World::Heightmaps::Type::WorldSurface, 0, 0)) +
+								  ", motion blocking at y " + std::to_string(chunk.heightmaps.getY(World::Heightmaps::Type::MotionBlocking, 0, 0)) +
+								  " in the corner column",
+						  "SERVER");
 
 	if (!chunk.blockEntities.empty()) {
 		g_logger->logGameInfo(INFO,
@@ -273,17 +290,13 @@ void Server::printChunkInfo(const World::ChunkData& chunk) {
 		g_logger->logGameInfo(INFO, "Block Entities: No special blocks found", "SERVER");
 	}
 
-	if (!chunk.skyLight.empty()) {
-		g_logger->logGameInfo(INFO, "Sky Light: Contains natural lighting data (2048 bytes expected per 16x16x16 section)", "SERVER");
-	} else {
-		g_logger->logGameInfo(INFO, "Sky Light: No sky light data (underground sections or not calculated)", "SERVER");
-	}
-
-	if (!chunk.blockLight.empty()) {
-		g_logger->logGameInfo(INFO, "Block Light: Contains artificial lighting data from torches, glowstone, etc.", "SERVER");
-	} else {
-		g_logger->logGameInfo(INFO, "Block Light: No block light sources found", "SERVER");
-	}
+	size_t skySections = 0, blockSections = 0;
+	for (const World::NibbleArray& section : chunk.light.sky) skySections += !section.isUniform();
+	for (const World::NibbleArray& section : chunk.light.block) blockSections += !section.isUniform();
+	g_logger->logGameInfo(INFO,
+						  "Light: " + std::to_string(skySections) + " sky and " + std::to_string(blockSections) +
+								  " block light sections with varying levels, the others uniform",
+						  "SERVER");
 
 	// Minecraft chunk format info
 	g_logger->logGameInfo(INFO, "Note: Minecraft chunks are 16x384x16 blocks (Overworld) divided into 16x16x16 sections", "SERVER");
@@ -0,0 +1,42 @@
+#include "world/blockAccess.hpp"
+
+#include "world/chunkCache.hpp"
+#include "world/world.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+World::BlockAccess::BlockAccess(Query& query, Dimension dimension) : _query(query), _dimension(dimension), _chunk() {}
+
+const World::ChunkSection& World::BlockAccess::emptySection() {
+	static const ChunkSection section{0, PalettedContainer(PalettedContainer::Kind::Blocks, 0),
+									  PalettedContainer(PalettedContainer::Kind::Biomes, defaultBiomeId())};
+	return section;
+}
+
+const World::ChunkCache::ChunkRef& World::BlockAccess::chunkAt(int chunkX, int chunkZ) {
+	if (!_chunk || _chunk->chunkX != chunkX || _chunk->chunkZ != chunkZ) {
+		_chunk.reset(); // unpinned before the lookup, it may be the entry evicted to make room
+		_chunk = _query.getChunk(chunkX, chunkZ, _dimension);
+	}
+	return _chunk;
+}
+
+const World::ChunkSection& World::BlockAccess::sectionAt(int x, int y, int z) {
+	const ChunkData& chunk = *chunkAt(x >> 4, z >> 4);
+	if (chunk.isEmpty()) return emptySection();
+	return chunk.sections[static_cast<size_t>((y >> 4) - MIN_SECTION_Y)];
+}
+
+uint32_t World::BlockAccess::getBlock(int x, int y, int z) {
+	if (y < MIN_Y || y > MAX_Y) return 0;
+	return sectionAt(x, y, z).getBlock(x & 15, y & 15, z & 15);
+}
+
+uint32_t World::BlockAccess::getBiome(int x, int y, int z) {
+	y = std::clamp(y, MIN_Y, MAX_Y); // vanilla clamps biome lookups to the build height
+	return sectionAt(x, y, z).getBiome((x & 15) >> 2, (y & 15) >> 2, (z & 15) >> 2);
+}
+
+int World::BlockAccess::getHeight(int x, int z, Heightmaps::Type type) { return chunkAt(x >> 4, z >> 4)->heightmaps.getY(type, x & 15, z & 15); }
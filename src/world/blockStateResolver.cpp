@@ -0,0 +1,81 @@
+#include "world/blockStateResolver.hpp"
+
+#include "data/BlockStates.hpp"
+#include "data/RegistryIds.hpp"
+#include "lib/nbtView.hpp"
+#include "logger.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace {
+	// Every block of the state table must be a registered block, with its default state inside its own range
+	constexpr bool blockStatesConsistent() {
+		for (const BlockStateBlock& block : BlockStates::get()) {
+			if (!RegistryIds::getBlock().contains(block.name)) return false;
+			if (block.defaultState < block.firstState || block.defaultState >= BlockStates::STATE_COUNT) return false;
+			if (BlockStates::get().findBlock(block.name) != &block) return false;
+		}
+		return BlockStates::get().find("minecraft:air") == 0u;
+	}
+	static_assert(blockStatesConsistent(), "BlockStates.hpp is out of sync with RegistryIds.hpp or BlockStateTable");
+
+	constexpr uint32_t AIR_STATE = 0;
+
+	// Default state of a block, or `fallback` when the table does not have it
+	constexpr uint32_t defaultState(std::string_view name, uint32_t fallback) {
+		const BlockStateBlock* block = BlockStates::get().findBlock(name);
+		return block ? block->defaultState : fallback;
+	}
+
+	constexpr uint32_t CAVE_AIR_STATE = defaultState("minecraft:cave_air", AIR_STATE);
+	constexpr uint32_t VOID_AIR_STATE = defaultState("minecraft:void_air", AIR_STATE);
+} // namespace
+
+World::BlockStateResolver::BlockStateResolver() : _slots(), _hits(0), _misses(0) {}
+
+World::BlockStateResolver& World::BlockStateResolver::local() {
+	thread_local BlockStateResolver resolver;
+	return resolver;
+}
+
+uint32_t World::BlockStateResolver::lookup(const nbt::TagView& entry) {
+	std::string_view	   name	 = entry["Name"].asString();
+	const BlockStateBlock* block = BlockStates::get().findBlock(name);
+	if (!block) {
+		if (name == "minecraft:cave_air") return CAVE_AIR_STATE;
+		if (name == "minecraft:void_air") return VOID_AIR_STATE;
+		g_logger->logGameInfo(WARN, "No block state for " + std::string(name) + ", sent as stone", "World::BlockStateResolver");
+		return FALLBACK_STATE;
+	}
+	if (block->propertyCount == 0) return block->firstState;
+
+	nbt::TagView properties = entry["Properties"];
+	return BlockStates::get().getState(*block, [&](std::string_view property) {
+		nbt::TagView value = properties[property];
+		return value.isValid() ? value.asString() : std::string_view();
+	});
+}
+
+uint32_t World::BlockStateResolver::resolve(const nbt::TagView& entry) {
+	std::span<const uint8_t> raw = entry.getRawPayload();
+	std::string_view		 key(reinterpret_cast<const char*>(raw.data()), raw.size());
+
+	Slot& slot = _slots[std::hash<std::string_view>()(key) % _slots.size()];
+	if (!slot.key.empty() && slot.key == key) {
+		_hits++;
+		return slot.state;
+	}
+
+	_misses++;
+	uint32_t state = lookup(entry);
+	slot.key.assign(key);
+	slot.state = state;
+	return state;
+}
+
+bool World::BlockStateResolver::isAir(uint32_t state) { return state == AIR_STATE || state == CAVE_AIR_STATE || state == VOID_AIR_STATE; }
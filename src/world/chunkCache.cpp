@@ -0,0 +1,127 @@
+#include "world/chunkCache.hpp"
+#include "world/world.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+World::ChunkCache::ChunkCache(size_t budgetBytes) : _shards(), _shardBudget(budgetBytes / SHARD_COUNT), _hits(0), _misses(0), _evictions(0) {}
+
+void World::ChunkCache::setBudget(size_t budgetBytes) {
+	_shardBudget.store(budgetBytes / SHARD_COUNT);
+	for (Shard& shard : _shards) {
+		std::lock_guard<std::mutex> lock(shard.lock);
+		evictLocked(shard);
+	}
+}
+
+size_t World::ChunkCache::footprint(const ChunkData& chunk) {
+	size_t bytes = sizeof(ChunkData) + chunk.sections.capacity() * sizeof(ChunkSection) + chunk.blockEntities.capacity() + chunk.light.memoryUsage();
+	for (const ChunkSection& section : chunk.sections) {
+		bytes += section.blocks.memoryUsage() + section.biomes.memoryUsage();
+		// The packet cached on first send repeats the sections on the wire
+		bytes += section.blocks.networkSize() + section.biomes.networkSize();
+	}
+	// ... with the heightmaps and every light array not uniformly dark
+	bytes += chunk.heightmaps.networkSize() + chunk.light.networkSize();
+	return bytes;
+}
+
+World::ChunkCache::ChunkRef World::ChunkCache::find(const ChunkKey& key) { return findMutable(key); }
+
+World::ChunkCache::MutableChunkRef World::ChunkCache::findMutable(const ChunkKey& key) {
+	Shard&						shard = shardFor(key);
+	std::lock_guard<std::mutex> lock(shard.lock);
+
+	auto it = shard.index.find(key);
+	if (it == shard.index.end()) {
+		_misses.fetch_add(1, std::memory_order_relaxed);
+		return nullptr;
+	}
+	Slot& slot		= shard.slots[it->second];
+	slot.referenced = true;
+	_hits.fetch_add(1, std::memory_order_relaxed);
+	return slot.chunk;
+}
+
+World::ChunkCache::ChunkRef World::ChunkCache::insert(const ChunkKey& key, ChunkData&& chunk) {
+	size_t			bytes = footprint(chunk);
+	MutableChunkRef ref	  = std::make_shared<ChunkData>(std::move(chunk));
+
+	Shard&						shard = shardFor(key);
+	std::lock_guard<std::mutex> lock(shard.lock);
+
+	auto it = shard.index.find(key);
+	if (it != shard.index.end()) return shard.slots[it->second].chunk;
+
+	size_t index;
+	if (!shard.freeSlots.empty()) {
+		index = shard.freeSlots.back();
+		shard.freeSlots.pop_back();
+		shard.slots[index] = Slot{key, ref, bytes, false};
+	} else {
+		index = shard.slots.size();
+		shard.slots.push_back(Slot{key, ref, bytes, false});
+	}
+	shard.index.emplace(key, index);
+	shard.bytes += bytes;
+
+	evictLocked(shard);
+	return ref;
+}
+
+World::ChunkCache::ChunkRef World::ChunkCache::getOrLoad(const ChunkKey& key, const std::function<ChunkData()>& load) {
+	if (ChunkRef cached = find(key)) return cached;
+	return insert(key, load());
+}
+
+void World::ChunkCache::erase(const ChunkKey& key) {
+	Shard&						shard = shardFor(key);
+	std::lock_guard<std::mutex> lock(shard.lock);
+
+	auto it = shard.index.find(key);
+	if (it == shard.index.end()) return;
+	Slot& slot = shard.slots[it->second];
+	shard.bytes -= slot.bytes;
+	slot = Slot{};
+	shard.freeSlots.push_back(it->second);
+	shard.index.erase(it);
+}
+
+void World::ChunkCache::evictLocked(Shard& shard) {
+	size_t budget = _shardBudget.load();
+
+	// Two full turns at most: the first clears reference bits, the second evicts. Whatever is still over
+	// budget after that is pinned.
+	for (size_t steps = 2 * shard.slots.size(); shard.bytes > budget && steps > 0; steps--) {
+		if (shard.hand >= shard.slots.size()) shard.hand = 0;
+		Slot& slot = shard.slots[shard.hand++];
+
+		if (!slot.chunk) continue;
+		// Pinned: a reader outside the cache still holds it (copies are only handed out under this lock)
+		if (slot.chunk.use_count() > 1) continue;
+		if (slot.referenced) {
+			slot.referenced = false;
+			continue;
+		}
+
+		shard.index.erase(slot.key);
+		shard.bytes -= slot.bytes;
+		shard.freeSlots.push_back(shard.hand - 1);
+		slot = Slot{};
+		_evictions.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+World::ChunkCache::Stats World::ChunkCache::getStats() {
+	Stats stats{_hits.load(), _misses.load(), _evictions.load(), 0, 0};
+	for (Shard& shard : _shards) {
+		std::lock_guard<std::mutex> lock(shard.lock);
+		stats.entries += shard.index.size();
+		stats.bytes += shard.bytes;
+	}
+	return stats;
+}
@@ -0,0 +1,168 @@
+#include "world/chunkLight.hpp"
+
+#include "network/buffer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+	// Expanded arrays of the 16 uniform sections, shared by every bytes() call
+	const std::array<uint8_t, World::NibbleArray::SIZE>& uniformArray(uint8_t level) {
+		static const auto arrays = []() {
+			std::array<std::array<uint8_t, World::NibbleArray::SIZE>, 16> filled;
+			for (size_t level = 0; level < filled.size(); level++) filled[level].fill(static_cast<uint8_t>(level * 0x11));
+			return filled;
+		}();
+		return arrays[level];
+	}
+
+	size_t varIntSize(uint32_t value) {
+		size_t size = 1;
+		while (value >= 0x80) {
+			value >>= 7;
+			size++;
+		}
+		return size;
+	}
+
+	// Uniformly dark sections go in the empty mask, every other one is sent
+	void masks(const std::array<World::NibbleArray, World::LIGHT_SECTION_COUNT>& sections, uint64_t& sent, uint64_t& empty) {
+		sent  = 0;
+		empty = 0;
+		for (size_t i = 0; i < sections.size(); i++) {
+			if (sections[i].isUniform() && sections[i].getFill() == 0) {
+				empty |= uint64_t{1} << i;
+			} else {
+				sent |= uint64_t{1} << i;
+			}
+		}
+	}
+} // namespace
+
+// ============================================================================
+// NibbleArray
+// ============================================================================
+
+void World::NibbleArray::fill(uint8_t level) {
+	std::vector<uint8_t>().swap(_data);
+	_fill = level;
+}
+
+void World::NibbleArray::assign(std::span<const uint8_t> bytes) {
+	if (bytes.size() != SIZE) throw std::runtime_error("Light array of " + std::to_string(bytes.size()) + " bytes, expected 2048");
+
+	uint8_t first = bytes[0];
+	if ((first >> 4) == (first & 0x0F) && std::all_of(bytes.begin(), bytes.end(), [first](uint8_t byte) { return byte == first; })) {
+		fill(first & 0x0F);
+		return;
+	}
+	_data.assign(bytes.begin(), bytes.end());
+}
+
+void World::NibbleArray::pack(const uint8_t* levels) {
+	uint8_t first = levels[0];
+	if (std::all_of(levels, levels + SIZE * 2, [first](uint8_t level) { return level == first; })) {
+		fill(first);
+		return;
+	}
+
+	_data.resize(SIZE);
+	for (size_t i = 0; i < SIZE; i++) _data[i] = static_cast<uint8_t>(levels[2 * i] | (levels[2 * i + 1] << 4));
+}
+
+void World::NibbleArray::unpack(uint8_t* levels) const {
+	if (_data.empty()) {
+		std::memset(levels, _fill, SIZE * 2);
+		return;
+	}
+	for (size_t i = 0; i < SIZE; i++) {
+		levels[2 * i]	  = _data[i] & 0x0F;
+		levels[2 * i + 1] = _data[i] >> 4;
+	}
+}
+
+std::span<const uint8_t> World::NibbleArray::bytes() const {
+	if (_data.empty()) return uniformArray(_fill);
+	return _data;
+}
+
+// ============================================================================
+// ChunkLight
+// ============================================================================
+
+World::ChunkLight::ChunkLight() {
+	for (NibbleArray& section : sky) section.fill(15);
+}
+
+void World::ChunkLight::fillMissingSky(uint32_t storedMask) {
+	for (int i = LIGHT_SECTION_COUNT - 1; i >= 0; i--) {
+		if (storedMask & (uint32_t{1} << i)) continue;
+		if (i == LIGHT_SECTION_COUNT - 1) {
+			sky[i].fill(15);
+			continue;
+		}
+
+		// Filled top-down, the section above is stored or already filled
+		const NibbleArray& above = sky[i + 1];
+		if (above.isUniform()) {
+			sky[i].fill(above.getFill());
+			continue;
+		}
+		std::array<uint8_t, NibbleArray::SIZE * 2> levels;
+		above.unpack(levels.data());
+		for (size_t y = 1; y < 16; y++) std::memcpy(levels.data() + y * 256, levels.data(), 256);
+		sky[i].pack(levels.data());
+	}
+}
+
+void World::ChunkLight::encode(Buffer& out) const {
+	uint64_t skyMask, emptySkyMask, blockMask, emptyBlockMask;
+	masks(sky, skyMask, emptySkyMask);
+	masks(block, blockMask, emptyBlockMask);
+
+	// BitSets of one long, 26 sections
+	out.writeVarInt(1);
+	out.writeLong(static_cast<long>(skyMask));
+	out.writeVarInt(1);
+	out.writeLong(static_cast<long>(blockMask));
+	out.writeVarInt(1);
+	out.writeLong(static_cast<long>(emptySkyMask));
+	out.writeVarInt(1);
+	out.writeLong(static_cast<long>(emptyBlockMask));
+
+	for (const auto* sections : {&sky, &block}) {
+		size_t arrays = 0;
+		for (const NibbleArray& section : *sections) arrays += !(section.isUniform() && section.getFill() == 0);
+		out.writeVarInt(static_cast<int>(arrays));
+		for (const NibbleArray& section : *sections) {
+			if (section.isUniform() && section.getFill() == 0) continue;
+			std::span<const uint8_t> bytes = section.bytes();
+			out.writeVarInt(static_cast<int>(bytes.size()));
+			out.writeBytes(bytes.data(), bytes.size());
+		}
+	}
+}
+
+size_t World::ChunkLight::networkSize() const {
+	size_t size = 4 * (1 + sizeof(uint64_t));
+	for (const auto* sections : {&sky, &block}) {
+		size_t arrays = 0;
+		for (const NibbleArray& section : *sections) arrays += !(section.isUniform() && section.getFill() == 0);
+		size += varIntSize(static_cast<uint32_t>(arrays)) + arrays * (varIntSize(NibbleArray::SIZE) + NibbleArray::SIZE);
+	}
+	return size;
+}
+
+size_t World::ChunkLight::memoryUsage() const {
+	size_t bytes = 0;
+	for (const NibbleArray& section : sky) bytes += section.memoryUsage();
+	for (const NibbleArray& section : block) bytes += section.memoryUsage();
+	return bytes;
+}
@@ -0,0 +1,156 @@
+#include "logger.hpp"
+#include "world/chunkLoader.hpp"
+#include "world/world.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+World::ChunkLoader::ChunkLoader(Query& query, ChunkCache& cache)
+	: _query(query), _cache(cache), _lock(), _wakeup(), _requests(), _queue(), _threads(), _stopping(false), _nextId(1), _sequence(0),
+	  _loaded(0), _coalesced(0), _cancelled(0) {}
+
+World::ChunkLoader::~ChunkLoader() { stop(); }
+
+void World::ChunkLoader::start(size_t threadCount) {
+	std::lock_guard<std::mutex> lock(_lock);
+	if (!_threads.empty()) return;
+	_stopping = false;
+	for (size_t i = 0; i < std::max<size_t>(1, threadCount); i++) _threads.emplace_back(&ChunkLoader::ioThreadLoop, this);
+}
+
+void World::ChunkLoader::stop() {
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		_stopping = true;
+	}
+	_wakeup.notify_all();
+	for (std::thread& thread : _threads) {
+		if (thread.joinable()) thread.join();
+	}
+	_threads.clear();
+
+	// Pending requesters get the failed load answer rather than nothing: a caller waiting on its callbacks (spawn
+	// preload) would wait forever
+	std::vector<Waiter> dropped;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		for (auto& [key, pending] : _requests) {
+			for (Waiter& waiter : pending.waiters) dropped.push_back(std::move(waiter));
+		}
+		_requests.clear();
+		_queue = RequestQueue();
+	}
+	notify(dropped, nullptr);
+}
+
+void World::ChunkLoader::notify(std::vector<Waiter>& waiters, const ChunkCache::ChunkRef& chunk) {
+	for (Waiter& waiter : waiters) {
+		try {
+			waiter.callback(chunk);
+		} catch (const std::exception& e) {
+			g_logger->logGameInfo(ERROR, "Chunk callback failed: " + std::string(e.what()), "World::ChunkLoader");
+		}
+	}
+}
+
+World::ChunkTicket World::ChunkLoader::request(const ChunkKey& key, uint32_t priority, Callback callback) {
+	// Fast path: nothing to load, answer on the caller's thread
+	if (ChunkCache::ChunkRef cached = _cache.find(key)) {
+		callback(std::move(cached));
+		return ChunkTicket{};
+	}
+
+	std::unique_lock<std::mutex> lock(_lock);
+	if (_stopping) {
+		lock.unlock();
+		callback(nullptr);
+		return ChunkTicket{};
+	}
+	ChunkTicket ticket{key, _nextId++};
+
+	auto it = _requests.find(key);
+	if (it == _requests.end()) {
+		_requests.emplace(key, Request{priority, false, {Waiter{ticket.id, std::move(callback)}}});
+		_queue.push(QueueEntry{priority, _sequence++, key});
+	} else {
+		Request& pending = it->second;
+		pending.waiters.push_back(Waiter{ticket.id, std::move(callback)});
+		_coalesced.fetch_add(1, std::memory_order_relaxed);
+		// A closer requester moves the chunk up; the old heap entry goes stale
+		if (!pending.loading && priority < pending.priority) {
+			pending.priority = priority;
+			_queue.push(QueueEntry{priority, _sequence++, key});
+		}
+	}
+	lock.unlock();
+	_wakeup.notify_one();
+	return ticket;
+}
+
+bool World::ChunkLoader::cancel(const ChunkTicket& ticket) {
+	if (!ticket.isValid()) return false;
+
+	std::lock_guard<std::mutex> lock(_lock);
+	auto						it = _requests.find(ticket.key);
+	if (it == _requests.end()) return false;
+
+	Request& pending = it->second;
+	auto	 waiter	 = std::find_if(pending.waiters.begin(), pending.waiters.end(), [&](const Waiter& w) { return w.id == ticket.id; });
+	if (waiter == pending.waiters.end()) return false;
+
+	pending.waiters.erase(waiter);
+	_cancelled.fetch_add(1, std::memory_order_relaxed);
+	// Nobody wants it anymore: drop it before it is read (a load in flight still fills the cache)
+	if (pending.waiters.empty() && !pending.loading) _requests.erase(it);
+	return true;
+}
+
+size_t World::ChunkLoader::getPendingCount() {
+	std::lock_guard<std::mutex> lock(_lock);
+	return _requests.size();
+}
+
+void World::ChunkLoader::ioThreadLoop() {
+	std::unique_lock<std::mutex> lock(_lock);
+
+	while (true) {
+		_wakeup.wait(lock, [this] { return _stopping || !_queue.empty(); });
+		if (_stopping) return;
+
+		QueueEntry entry = _queue.top();
+		_queue.pop();
+
+		auto it = _requests.find(entry.key);
+		if (it == _requests.end() || it->second.loading || it->second.priority != entry.priority) continue;
+		it->second.loading = true;
+		lock.unlock();
+
+		ChunkCache::ChunkRef chunk;
+		try {
+			chunk = _cache.insert(entry.key, _query.fetchChunk(entry.key.x, entry.key.z));
+		} catch (const std::exception& e) {
+			// fetchChunk already falls back to an empty chunk, this is an allocation failure or worse
+			g_logger->logGameInfo(ERROR, "Chunk load failed: " + std::string(e.what()), "World::ChunkLoader");
+		}
+		_loaded.fetch_add(1, std::memory_order_relaxed);
+
+		lock.lock();
+		std::vector<Waiter> waiters;
+		it = _requests.find(entry.key);
+		if (it != _requests.end()) {
+			waiters = std::move(it->second.waiters);
+			_requests.erase(it);
+		}
+		lock.unlock();
+
+		notify(waiters, chunk);
+		lock.lock();
+	}
+}
@@ -0,0 +1,128 @@
+#include "world/compression.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+namespace {
+	// Worst case of deflate is ~1032:1, a trailer above that is corrupted or a concatenated stream
+	constexpr size_t MAX_DEFLATE_RATIO = 1032;
+
+	// Gzip stores the inflated size (mod 2^32) in its last 4 bytes, little endian
+	size_t gzipInflatedSize(std::span<const uint8_t> in) {
+		if (in.size() < 18 || in[0] != 0x1F || in[1] != 0x8B) return 0;
+		const uint8_t* p	= in.data() + in.size() - 4;
+		size_t		   size = static_cast<size_t>(p[0]) | (static_cast<size_t>(p[1]) << 8) | (static_cast<size_t>(p[2]) << 16) |
+					  (static_cast<size_t>(p[3]) << 24);
+		return size <= in.size() * MAX_DEFLATE_RATIO ? size : 0;
+	}
+
+	uInt clampToUInt(size_t size) { return static_cast<uInt>(std::min<size_t>(size, UINT_MAX)); }
+} // namespace
+
+World::ZlibCodec::ZlibCodec() : _inflate(), _deflate(), _deflateReady{false, false}, _ratio(4.0), _scratch() {
+	// 32 + MAX_WBITS: accept both zlib and gzip headers
+	if (inflateInit2(&_inflate, 32 + MAX_WBITS) != Z_OK) throw std::runtime_error("Failed to initialize zlib decompression");
+}
+
+World::ZlibCodec::~ZlibCodec() {
+	inflateEnd(&_inflate);
+	for (size_t i = 0; i < 2; i++) {
+		if (_deflateReady[i]) deflateEnd(&_deflate[i]);
+	}
+}
+
+World::ZlibCodec& World::ZlibCodec::local() {
+	thread_local ZlibCodec codec;
+	return codec;
+}
+
+size_t World::ZlibCodec::inflate(std::span<const uint8_t> in, std::vector<uint8_t>& out) {
+	if (in.empty()) return 0;
+
+	size_t start	= out.size();
+	size_t expected = gzipInflatedSize(in);
+	bool   exact	= expected != 0;
+	if (!exact) expected = static_cast<size_t>(static_cast<double>(in.size()) * _ratio * 1.125) + 64;
+	out.resize(start + expected);
+
+	inflateReset(&_inflate);
+	_inflate.next_in  = const_cast<Bytef*>(in.data());
+	_inflate.avail_in = clampToUInt(in.size());
+
+	size_t written = 0;
+	while (true) {
+		_inflate.next_out  = out.data() + start + written;
+		_inflate.avail_out = clampToUInt(out.size() - start - written);
+
+		uInt availBefore = _inflate.avail_out;
+		int	 ret		 = ::inflate(&_inflate, Z_NO_FLUSH);
+		written += availBefore - _inflate.avail_out;
+
+		if (ret == Z_STREAM_END) break;
+		if (ret != Z_OK && ret != Z_BUF_ERROR) {
+			out.resize(start);
+			throw std::runtime_error("Zlib decompression error: " + std::to_string(ret));
+		}
+		if (_inflate.avail_out != 0) {
+			// Output space left but no progress: the input ended before the stream did
+			out.resize(start);
+			throw std::runtime_error("Zlib decompression error: truncated input");
+		}
+		// Estimate too small (or a gzip trailer that wrapped around 4 GiB), double
+		out.resize(start + written + std::max<size_t>(written, 4096));
+	}
+	out.resize(start + written);
+
+	// Only estimated sizes feed the history, gzip ones were exact anyway
+	if (!exact) _ratio = 0.75 * _ratio + 0.25 * (static_cast<double>(written) / static_cast<double>(in.size()));
+	return written;
+}
+
+size_t World::ZlibCodec::deflate(std::span<const uint8_t> in, ZlibFormat format, std::vector<uint8_t>& out) {
+	size_t	  index	 = static_cast<size_t>(format);
+	z_stream& stream = _deflate[index];
+	if (!_deflateReady[index]) {
+		// 16 + MAX_WBITS writes a gzip header and trailer instead of the zlib ones
+		int windowBits = format == ZlibFormat::Gzip ? 16 + MAX_WBITS : MAX_WBITS;
+		if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+			throw std::runtime_error("Failed to initialize zlib compression");
+		_deflateReady[index] = true;
+	} else {
+		deflateReset(&stream);
+	}
+
+	size_t start = out.size();
+	size_t bound = deflateBound(&stream, static_cast<uLong>(in.size()));
+	out.resize(start + bound);
+
+	stream.next_in	 = const_cast<Bytef*>(in.data());
+	stream.avail_in	 = clampToUInt(in.size());
+	stream.next_out	 = out.data() + start;
+	stream.avail_out = clampToUInt(bound);
+
+	// deflateBound() guarantees a single call is enough
+	int ret = ::deflate(&stream, Z_FINISH);
+	if (ret != Z_STREAM_END) {
+		out.resize(start);
+		throw std::runtime_error("Zlib compression error: " + std::to_string(ret));
+	}
+
+	size_t written = bound - stream.avail_out;
+	out.resize(start + written);
+	return written;
+}
+
+std::vector<uint8_t>& World::ZlibCodec::scratch() {
+	// One huge payload should not pin its buffer on the thread forever
+	if (_scratch.capacity() > SCRATCH_RETAIN_LIMIT) std::vector<uint8_t>().swap(_scratch);
+	_scratch.clear();
+	return _scratch;
+}
@@ -0,0 +1,207 @@
+#include "world/heightmaps.hpp"
+
+#include "data/BlockProperties.hpp"
+#include "data/BlockStates.hpp"
+#include "lib/byteSwap.hpp"
+#include "network/buffer.hpp"
+#include "world/world.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+	using Type = World::Heightmaps::Type;
+
+	constexpr size_t PER_LONG	 = 64 / World::Heightmaps::BITS;
+	constexpr size_t LONG_COUNT	 = (256 + PER_LONG - 1) / PER_LONG;
+	constexpr size_t SENT_TYPES	 = 3; // all but OceanFloor
+	constexpr int	 WORLD_HEIGHT = World::MAX_Y - World::MIN_Y + 1;
+	static_assert((1 << World::Heightmaps::BITS) > WORLD_HEIGHT, "heights do not fit the packing");
+
+	constexpr uint8_t bit(Type type) { return static_cast<uint8_t>(1u << static_cast<unsigned>(type)); }
+
+	constexpr uint8_t ALL_TYPES = bit(Type::WorldSurface) | bit(Type::OceanFloor) | bit(Type::MotionBlocking) | bit(Type::MotionBlockingNoLeaves);
+
+	// Types a non-air state counts for
+	constexpr uint8_t stateTypes(bool solid, bool fluid, bool leaves) {
+		uint8_t types = bit(Type::WorldSurface);
+		if (solid) types |= bit(Type::OceanFloor);
+		if (solid || fluid) types |= bit(Type::MotionBlocking);
+		if ((solid || fluid) && !leaves) types |= bit(Type::MotionBlockingNoLeaves);
+		return types;
+	}
+
+	constexpr auto STATE_TYPES = []() {
+		const BlockStateTable& blocks = BlockStates::get();
+
+		// A waterlogged state also counts as fluid
+		std::array<uint8_t, BlockStates::STATE_COUNT> table{};
+		for (uint8_t& types : table) types = ALL_TYPES;
+		for (size_t i = 0; i < blocks.size(); i++) {
+			const BlockStateBlock& block	   = blocks.begin()[i];
+			BlockStatePropertySlot waterlogged = blocks.findProperty(block, "waterlogged");
+			uint8_t				   flags	   = BlockProperties::of(block);
+			bool				   solid	   = !(flags & (BlockProperties::NON_SOLID | BlockProperties::FLUID));
+			bool				   leaves	   = flags & BlockProperties::LEAVES;
+			uint32_t			   states	   = 1;
+			for (size_t p = 0; p < block.propertyCount; p++) states *= blocks.getProperty(block, p).valueCount;
+			for (uint32_t state = block.firstState; state < block.firstState + states; state++) {
+				bool wet	 = (flags & BlockProperties::FLUID) || blocks.getValue(block, waterlogged, state) == "true";
+				table[state] = (flags & BlockProperties::AIR) ? 0 : stateTypes(solid, wet, leaves);
+			}
+		}
+		return table;
+	}();
+	static_assert(STATE_TYPES[0] == 0, "air must not count for any heightmap");
+
+	uint8_t typesOf(uint32_t state) { return state < STATE_TYPES.size() ? STATE_TYPES[state] : ALL_TYPES; }
+
+	size_t varIntSize(uint32_t value) {
+		size_t size = 1;
+		while (value >= 0x80) {
+			value >>= 7;
+			size++;
+		}
+		return size;
+	}
+} // namespace
+
+int World::Heightmaps::getNetworkId(Type type) {
+	switch (type) {
+	case Type::WorldSurface:
+		return 1;
+	case Type::OceanFloor:
+		return 3;
+	case Type::MotionBlocking:
+		return 4;
+	case Type::MotionBlockingNoLeaves:
+		return 5;
+	}
+	return 1;
+}
+
+std::string_view World::Heightmaps::getName(Type type) {
+	switch (type) {
+	case Type::WorldSurface:
+		return "WORLD_SURFACE";
+	case Type::OceanFloor:
+		return "OCEAN_FLOOR";
+	case Type::MotionBlocking:
+		return "MOTION_BLOCKING";
+	case Type::MotionBlockingNoLeaves:
+		return "MOTION_BLOCKING_NO_LEAVES";
+	}
+	return "WORLD_SURFACE";
+}
+
+World::Heightmaps::Heightmaps() : _heights() {}
+
+int World::Heightmaps::getY(Type type, int x, int z) const { return MIN_Y + get(type, x, z); }
+
+uint16_t World::Heightmaps::scan(const std::vector<ChunkSection>& sections, Type type, int x, int z, int fromY) {
+	for (int y = std::min(fromY, MAX_Y); y >= MIN_Y; y--) {
+		const ChunkSection& section = sections[static_cast<size_t>((y >> 4) - MIN_SECTION_Y)];
+		if (section.nonAirBlocks == 0) {
+			y &= ~15; // the whole section is air
+			continue;
+		}
+		if (typesOf(section.getBlock(x, y & 15, z)) & bit(type)) return static_cast<uint16_t>(y + 1 - MIN_Y);
+	}
+	return 0;
+}
+
+void World::Heightmaps::compute(const std::vector<ChunkSection>& sections) {
+	_heights = {};
+	if (sections.empty()) return;
+
+	// One walk down each column fills every type, stopping once all are found
+	for (int z = 0; z < 16; z++) {
+		for (int x = 0; x < 16; x++) {
+			uint8_t missing = ALL_TYPES;
+			for (int index = SECTION_COUNT - 1; index >= 0 && missing; index--) {
+				const ChunkSection& section = sections[static_cast<size_t>(index)];
+				if (section.nonAirBlocks == 0) continue;
+				for (int y = 15; y >= 0 && missing; y--) {
+					uint8_t found = typesOf(section.getBlock(x, y, z)) & missing;
+					if (!found) continue;
+					uint16_t height = static_cast<uint16_t>((index + MIN_SECTION_Y) * 16 + y + 1 - MIN_Y);
+					for (size_t type = 0; type < TYPE_COUNT; type++) {
+						if (found & (1u << type)) _heights[type][column(x, z)] = height;
+					}
+					missing &= static_cast<uint8_t>(~found);
+				}
+			}
+		}
+	}
+}
+
+void World::Heightmaps::compute(const std::vector<ChunkSection>& sections, Type type) {
+	std::array<uint16_t, 256>& heights = _heights[static_cast<size_t>(type)];
+	heights.fill(0);
+	if (sections.empty()) return;
+	for (int z = 0; z < 16; z++) {
+		for (int x = 0; x < 16; x++) heights[column(x, z)] = scan(sections, type, x, z, MAX_Y);
+	}
+}
+
+void World::Heightmaps::load(Type type, const nbt::BigEndianArray<int64_t>& packed) {
+	if (packed.size() != LONG_COUNT) {
+		throw std::runtime_error("Heightmap " + std::string(getName(type)) + " of " + std::to_string(packed.size()) + " longs, expected " +
+								 std::to_string(LONG_COUNT));
+	}
+
+	std::array<uint16_t, 256>& heights = _heights[static_cast<size_t>(type)];
+	for (size_t i = 0; i < heights.size(); i++) {
+		uint64_t word = static_cast<uint64_t>(packed[i / PER_LONG]);
+		heights[i]	  = static_cast<uint16_t>((word >> ((i % PER_LONG) * BITS)) & ((1u << BITS) - 1));
+	}
+}
+
+bool World::Heightmaps::update(const std::vector<ChunkSection>& sections, int x, int y, int z, uint32_t state) {
+	if (sections.empty() || y < MIN_Y || y > MAX_Y) return false;
+
+	uint8_t	 types	 = typesOf(state);
+	uint16_t above	 = static_cast<uint16_t>(y + 1 - MIN_Y);
+	bool	 changed = false;
+	for (size_t type = 0; type < TYPE_COUNT; type++) {
+		uint16_t& height = _heights[type][column(x, z)];
+		uint16_t  next	 = height;
+		if (types & (1u << type)) {
+			next = std::max(height, above);
+		} else if (height == above) {
+			next = scan(sections, static_cast<Type>(type), x, z, y - 1);
+		}
+		changed |= next != height;
+		height = next;
+	}
+	return changed;
+}
+
+void World::Heightmaps::encode(Buffer& out) const {
+	out.writeVarInt(static_cast<int>(SENT_TYPES));
+	for (size_t index = 0; index < TYPE_COUNT; index++) {
+		Type type = static_cast<Type>(index);
+		if (!isSentToClient(type)) continue;
+		out.writeVarInt(getNetworkId(type));
+		out.writeVarInt(static_cast<int>(LONG_COUNT));
+
+		const std::array<uint16_t, 256>& heights = _heights[index];
+		std::array<uint64_t, LONG_COUNT> packed{};
+		for (size_t i = 0; i < heights.size(); i++) packed[i / PER_LONG] |= static_cast<uint64_t>(heights[i]) << ((i % PER_LONG) * BITS);
+
+		auto&  bytes  = out.getData();
+		size_t offset = bytes.size();
+		bytes.resize(offset + packed.size() * sizeof(uint64_t));
+		nbt::byteSwapCopy64(bytes.data() + offset, packed.data(), packed.size());
+	}
+}
+
+size_t World::Heightmaps::networkSize() const {
+	return varIntSize(SENT_TYPES) + SENT_TYPES * (1 + varIntSize(LONG_COUNT) + LONG_COUNT * sizeof(uint64_t));
+}
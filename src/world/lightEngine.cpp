@@ -0,0 +1,582 @@
+#include "world/lightEngine.hpp"
+
+#include "data/BlockProperties.hpp"
+#include "data/BlockStates.hpp"
+#include "world/chunkLight.hpp"
+#include "world/world.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#define LIGHT_ENGINE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+	// ============================================================================
+	// Block light properties
+	// ============================================================================
+
+	struct LightProperties {
+		uint8_t emission;
+		uint8_t opacity;
+	};
+
+	// Light given off by blocks in their brightest state, per the vanilla block definitions; everything else gives none
+	struct Emitter {
+		std::string_view name;
+		uint8_t			 emission;
+	};
+
+	constexpr Emitter EMITTERS[] = {
+		{"minecraft:beacon", 15}, {"minecraft:campfire", 15}, {"minecraft:conduit", 15}, {"minecraft:end_gateway", 15}, {"minecraft:end_portal", 15},
+		{"minecraft:fire", 15}, {"minecraft:glowstone", 15}, {"minecraft:jack_o_lantern", 15}, {"minecraft:lantern", 15}, {"minecraft:lava", 15},
+		{"minecraft:lava_cauldron", 15}, {"minecraft:light", 15}, {"minecraft:redstone_lamp", 15}, {"minecraft:respawn_anchor", 15},
+		{"minecraft:sea_lantern", 15}, {"minecraft:shroomlight", 15}, {"minecraft:cave_vines", 14}, {"minecraft:cave_vines_plant", 14},
+		{"minecraft:end_rod", 14}, {"minecraft:torch", 14}, {"minecraft:wall_torch", 14}, {"minecraft:blast_furnace", 13}, {"minecraft:furnace", 13},
+		{"minecraft:smoker", 13}, {"minecraft:nether_portal", 11}, {"minecraft:crying_obsidian", 10}, {"minecraft:soul_campfire", 10},
+		{"minecraft:soul_fire", 10}, {"minecraft:soul_lantern", 10}, {"minecraft:soul_torch", 10}, {"minecraft:soul_wall_torch", 10},
+		{"minecraft:deepslate_redstone_ore", 9}, {"minecraft:redstone_ore", 9}, {"minecraft:enchanting_table", 7}, {"minecraft:ender_chest", 7},
+		{"minecraft:glow_lichen", 7}, {"minecraft:redstone_torch", 7}, {"minecraft:redstone_wall_torch", 7}, {"minecraft:sculk_catalyst", 6},
+		{"minecraft:amethyst_cluster", 5}, {"minecraft:large_amethyst_bud", 4}, {"minecraft:magma_block", 3}, {"minecraft:firefly_bush", 2},
+		{"minecraft:medium_amethyst_bud", 2}, {"minecraft:brewing_stand", 1}, {"minecraft:brown_mushroom", 1},
+		{"minecraft:calibrated_sculk_sensor", 1}, {"minecraft:dragon_egg", 1}, {"minecraft:end_portal_frame", 1}, {"minecraft:sculk_sensor", 1},
+		{"minecraft:small_amethyst_bud", 1}};
+
+	// Emission of the blocks classified by the pattern of their name, opacity from the shared block properties; the
+	// listed emitters are found by hash afterwards
+	constexpr LightProperties patternProperties(const BlockStateBlock& block) {
+		std::string_view name		= block.name;
+		LightProperties	 properties = {0, 15};
+		if (name.ends_with("_froglight")) properties.emission = 15;
+		// Copper bulbs dim as they oxidize
+		if (name.ends_with("copper_bulb")) {
+			properties.emission = 15;
+			if (name.find("exposed") != std::string_view::npos) properties.emission = 12;
+			else if (name.find("weathered") != std::string_view::npos) properties.emission = 8;
+			else if (name.find("oxidized") != std::string_view::npos) properties.emission = 4;
+		}
+
+		uint8_t flags = BlockProperties::of(block);
+		if (flags & BlockProperties::CLEAR) properties.opacity = 0;
+		else if (flags & (BlockProperties::DIMMING | BlockProperties::LEAVES)) properties.opacity = 1;
+		return properties;
+	}
+
+	// Properties the light of a state depends on, looked up once per block
+	struct LightSlots {
+		BlockStatePropertySlot lit, candles, level, charges, pickles, berries, eye, type, waterlogged;
+
+		constexpr bool any() const {
+			return lit.property || candles.property || level.property || charges.property || pickles.property || berries.property || eye.property ||
+				   type.property || waterlogged.property;
+		}
+
+		constexpr explicit LightSlots(const BlockStateBlock& block)
+			: lit(BlockStates::get().findProperty(block, "lit")), candles(BlockStates::get().findProperty(block, "candles")),
+			  level(BlockStates::get().findProperty(block, "level")), charges(BlockStates::get().findProperty(block, "charges")),
+			  pickles(BlockStates::get().findProperty(block, "pickles")), berries(BlockStates::get().findProperty(block, "berries")),
+			  eye(BlockStates::get().findProperty(block, "eye")), type(BlockStates::get().findProperty(block, "type")),
+			  waterlogged(BlockStates::get().findProperty(block, "waterlogged")) {}
+	};
+
+	constexpr int digits(std::string_view value) {
+		int number = 0;
+		for (char c : value) number = number * 10 + (c - '0');
+		return number;
+	}
+
+	// Light of the few blocks whose light depends on their state (lit, charged, waterlogged, ...), from its property values
+	constexpr LightProperties stateProperties(const BlockStateBlock& block, const LightSlots& slots, uint32_t state, LightProperties base) {
+		const BlockStateTable& table = BlockStates::get();
+		auto				   value = [&](const BlockStatePropertySlot& slot) { return table.getValue(block, slot, state); };
+
+		LightProperties	 properties = base;
+		std::string_view lit		= value(slots.lit);
+		if (lit == "false") properties.emission = 0;
+		// Three levels per lit candle
+		if (lit == "true" && slots.candles.property) properties.emission = static_cast<uint8_t>(3 * digits(value(slots.candles)));
+		else if (lit == "true" && block.name.ends_with("candle_cake")) properties.emission = 3;
+		if (block.name == "minecraft:light") properties.emission = static_cast<uint8_t>(digits(value(slots.level)));
+		if (slots.charges.property) {
+			int charges			= digits(value(slots.charges));
+			properties.emission = static_cast<uint8_t>(charges == 0 ? 0 : 3 + 4 * (charges - 1));
+		}
+		// Sea pickles glow under water only
+		if (slots.pickles.property) {
+			bool wet			= value(slots.waterlogged) == "true";
+			properties.emission = wet ? static_cast<uint8_t>(3 + 3 * digits(value(slots.pickles))) : 0;
+		}
+		if (value(slots.berries) == "false" || value(slots.eye) == "false") properties.emission = 0;
+		// A double slab is a full cube; water in a block that lets light through dims it like a water block
+		if (value(slots.type) == "double" && block.name.ends_with("_slab")) properties.opacity = 15;
+		if (properties.opacity == 0 && value(slots.waterlogged) == "true") properties.opacity = 1;
+		return properties;
+	}
+
+	constexpr auto LIGHT_PROPERTIES = []() {
+		const BlockStateTable& blocks = BlockStates::get();
+
+		// Per block first, then per state for the blocks with properties light depends on
+		std::array<LightProperties, BlockStates::get().size()> base{};
+		for (size_t i = 0; i < base.size(); i++) base[i] = patternProperties(blocks.begin()[i]);
+		auto index = [&blocks](std::string_view name) { return static_cast<size_t>(blocks.findBlock(name) - blocks.begin()); };
+		for (const Emitter& emitter : EMITTERS) base[index(emitter.name)].emission = emitter.emission;
+
+		std::array<LightProperties, BlockStates::STATE_COUNT> table{};
+		for (LightProperties& properties : table) properties = {0, 15};
+		for (size_t i = 0; i < base.size(); i++) {
+			const BlockStateBlock& block  = blocks.begin()[i];
+			LightSlots			   slots(block);
+			uint32_t			   states = 1;
+			for (size_t p = 0; p < block.propertyCount; p++) states *= blocks.getProperty(block, p).valueCount;
+			for (uint32_t state = block.firstState; state < block.firstState + states; state++) {
+				table[state] = slots.any() ? stateProperties(block, slots, state, base[i]) : base[i];
+			}
+		}
+		return table;
+	}();
+	static_assert(LIGHT_PROPERTIES[0].opacity == 0, "air must let light through");
+
+	LightProperties propertiesOf(uint32_t state) { return state < LIGHT_PROPERTIES.size() ? LIGHT_PROPERTIES[state] : LightProperties{0, 15}; }
+
+	// ============================================================================
+	// Whole chunk relaxation
+	// ============================================================================
+
+	constexpr int	 LIGHT_HEIGHT  = World::LIGHT_SECTION_COUNT * 16;
+	constexpr size_t SECTION_CELLS = 4096;
+	constexpr size_t CHUNK_CELLS   = World::LIGHT_SECTION_COUNT * SECTION_CELLS;
+
+	// One level or opacity per byte, cell (y * 16 + z) * 16 + x from the bottom of the lowest light section: an x
+	// row is 16 consecutive bytes
+	struct Volume {
+		std::vector<uint8_t> opacity;
+		std::vector<uint8_t> level;
+
+		Volume() : opacity(CHUNK_CELLS), level(CHUNK_CELLS) {}
+
+		static Volume& local() {
+			thread_local Volume volume;
+			return volume;
+		}
+	};
+
+#ifdef LIGHT_ENGINE_SSE2
+	// One pass over the rows of a light section, levels raised in place to max(own, neighbour max - max(1, opacity)).
+	// Returns whether any level rose.
+	bool relaxSection(uint8_t* level, const uint8_t* opacity, int section, bool upward) {
+		const __m128i zero	  = _mm_setzero_si128();
+		const __m128i one	  = _mm_set1_epi8(1);
+		__m128i		  changed = zero;
+		for (int i = 0; i < 16; i++) {
+			int y = section * 16 + (upward ? i : 15 - i);
+			for (int z = 0; z < 16; z++) {
+				size_t	row		= static_cast<size_t>((y * 16 + z) * 16);
+				__m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(level + row));
+
+				// x - 1 and x + 1 are the row shifted by one byte, zero past the chunk border
+				__m128i neighbours = _mm_max_epu8(_mm_slli_si128(current, 1), _mm_srli_si128(current, 1));
+				if (y > 0) neighbours = _mm_max_epu8(neighbours, _mm_loadu_si128(reinterpret_cast<const __m128i*>(level + row - 256)));
+				if (y < LIGHT_HEIGHT - 1) neighbours = _mm_max_epu8(neighbours, _mm_loadu_si128(reinterpret_cast<const __m128i*>(level + row + 256)));
+				if (z > 0) neighbours = _mm_max_epu8(neighbours, _mm_loadu_si128(reinterpret_cast<const __m128i*>(level + row - 16)));
+				if (z < 15) neighbours = _mm_max_epu8(neighbours, _mm_loadu_si128(reinterpret_cast<const __m128i*>(level + row + 16)));
+
+				__m128i cost = _mm_max_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(opacity + row)), one);
+				__m128i next = _mm_max_epu8(current, _mm_subs_epu8(neighbours, cost));
+				changed		 = _mm_or_si128(changed, _mm_xor_si128(next, current));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(level + row), next);
+			}
+		}
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(changed, zero)) != 0xFFFF;
+	}
+#else
+	bool relaxSection(uint8_t* level, const uint8_t* opacity, int section, bool upward) {
+		bool changed = false;
+		for (int i = 0; i < 16; i++) {
+			int y = section * 16 + (upward ? i : 15 - i);
+			for (int z = 0; z < 16; z++) {
+				size_t	row = static_cast<size_t>((y * 16 + z) * 16);
+				uint8_t current[16];
+				std::memcpy(current, level + row, 16);
+				for (int x = 0; x < 16; x++) {
+					uint8_t neighbours = std::max(x > 0 ? current[x - 1] : 0, x < 15 ? current[x + 1] : 0);
+					if (y > 0) neighbours = std::max(neighbours, level[row - 256 + x]);
+					if (y < LIGHT_HEIGHT - 1) neighbours = std::max(neighbours, level[row + 256 + x]);
+					if (z > 0) neighbours = std::max(neighbours, level[row - 16 + x]);
+					if (z < 15) neighbours = std::max(neighbours, level[row + 16 + x]);
+
+					uint8_t cost = std::max<uint8_t>(opacity[row + x], 1);
+					uint8_t next = neighbours > cost ? static_cast<uint8_t>(neighbours - cost) : 0;
+					if (next > level[row + x]) {
+						level[row + x] = next;
+						changed		   = true;
+					}
+				}
+			}
+		}
+		return changed;
+	}
+#endif
+
+	// Sweeps the sections, alternately upward and downward, until no level rises. A section is swept again only
+	// when it or a section next to it changed in the previous sweep.
+	void relax(uint8_t* level, const uint8_t* opacity) {
+		constexpr uint32_t ALL	   = (uint32_t{1} << World::LIGHT_SECTION_COUNT) - 1;
+		uint32_t		   active  = ALL;
+		bool			   upward  = true;
+		while (active) {
+			uint32_t next = 0;
+			for (int i = 0; i < World::LIGHT_SECTION_COUNT; i++) {
+				int section = upward ? i : World::LIGHT_SECTION_COUNT - 1 - i;
+				if (!(active & (uint32_t{1} << section))) continue;
+				if (relaxSection(level, opacity, section, upward)) next |= (uint32_t{7} << section) >> 1;
+			}
+			active = next & ALL;
+			upward = !upward;
+		}
+	}
+
+	// ============================================================================
+	// Incremental updates
+	// ============================================================================
+
+	struct Direction {
+		int dx, dy, dz;
+	};
+	constexpr std::array<Direction, 6> DIRECTIONS{{{0, -1, 0}, {0, 1, 0}, {-1, 0, 0}, {1, 0, 0}, {0, 0, -1}, {0, 0, 1}}};
+	constexpr size_t					DOWN = 0;
+
+	// BFS over the 3x3 chunks around one changed chunk, nothing outside them is read or written
+	class Propagator {
+	  private:
+		struct Cell {
+			World::ChunkData* chunk; // nullptr when outside the loaded light
+			int				  slot;	 // chunk in the 3x3 window
+			int				  section;
+			size_t			  index;
+		};
+
+		struct Node {
+			int		x, y, z;
+			uint8_t level;
+		};
+
+		int												   _originX, _originZ; // chunk of the window corner
+		std::array<World::ChunkData*, 9>				   _chunks;
+		std::array<std::unique_lock<std::shared_mutex>, 9> _locks; // writers exclude the encoder of each chunk
+		uint16_t										   _touched;
+		std::vector<Node>								   _decrease;
+		std::vector<Node>								   _increase;
+
+		Cell cellAt(int x, int y, int z) const {
+			int chunkX = (x >> 4) - _originX;
+			int chunkZ = (z >> 4) - _originZ;
+			int section = World::ChunkLight::sectionIndex(y);
+			if (chunkX < 0 || chunkX > 2 || chunkZ < 0 || chunkZ > 2 || section < 0) return Cell{nullptr, 0, 0, 0};
+			int slot = chunkX * 3 + chunkZ;
+			return Cell{_chunks[slot], slot, section, World::ChunkSection::blockIndex(x & 15, y & 15, z & 15)};
+		}
+
+		static World::NibbleArray& layer(const Cell& cell, bool sky) {
+			return sky ? cell.chunk->light.sky[cell.section] : cell.chunk->light.block[cell.section];
+		}
+
+		uint8_t getLevel(const Cell& cell, bool sky) const { return layer(cell, sky).get(cell.index); }
+
+		void setLevel(const Cell& cell, bool sky, uint8_t level) {
+			layer(cell, sky).set(cell.index, level);
+			_touched |= static_cast<uint16_t>(1u << cell.slot);
+		}
+
+		// Light sections below and above the world are air
+		static LightProperties propertiesAt(const Cell& cell) {
+			int section = cell.section - 1;
+			if (section < 0 || section >= World::SECTION_COUNT) return propertiesOf(0);
+			return propertiesOf(cell.chunk->sections[section].blocks.get(cell.index));
+		}
+
+		// Removes the light that came through the queued cells; neighbours lit from elsewhere are queued to refill
+		void decrease(bool sky) {
+			for (size_t head = 0; head < _decrease.size(); head++) {
+				Node node = _decrease[head];
+				for (size_t d = 0; d < DIRECTIONS.size(); d++) {
+					int	 x = node.x + DIRECTIONS[d].dx, y = node.y + DIRECTIONS[d].dy, z = node.z + DIRECTIONS[d].dz;
+					Cell cell = cellAt(x, y, z);
+					if (!cell.chunk) continue;
+					uint8_t level = getLevel(cell, sky);
+					if (level == 0) continue;
+
+					bool fromNode = level < node.level || (sky && d == DOWN && node.level == 15 && level == 15);
+					if (!fromNode) {
+						_increase.push_back(Node{x, y, z, level});
+						continue;
+					}
+					setLevel(cell, sky, 0);
+					_decrease.push_back(Node{x, y, z, level});
+					if (!sky) {
+						uint8_t emission = propertiesAt(cell).emission;
+						if (emission > 0) {
+							setLevel(cell, sky, emission);
+							_increase.push_back(Node{x, y, z, emission});
+						}
+					}
+				}
+			}
+			_decrease.clear();
+		}
+
+		void increase(bool sky) {
+			for (size_t head = 0; head < _increase.size(); head++) {
+				Node node	 = _increase[head];
+				Cell current = cellAt(node.x, node.y, node.z);
+				if (!current.chunk || getLevel(current, sky) != node.level) continue; // raised or cleared since queued
+
+				for (size_t d = 0; d < DIRECTIONS.size(); d++) {
+					int	 x = node.x + DIRECTIONS[d].dx, y = node.y + DIRECTIONS[d].dy, z = node.z + DIRECTIONS[d].dz;
+					Cell cell = cellAt(x, y, z);
+					if (!cell.chunk) continue;
+
+					uint8_t opacity = propertiesAt(cell).opacity;
+					uint8_t cost	= std::max<uint8_t>(opacity, 1);
+					uint8_t level	= node.level > cost ? static_cast<uint8_t>(node.level - cost) : 0;
+					if (sky && d == DOWN && node.level == 15 && opacity == 0) level = 15;
+					if (level <= getLevel(cell, sky)) continue;
+					setLevel(cell, sky, level);
+					_increase.push_back(Node{x, y, z, level});
+				}
+			}
+			_increase.clear();
+		}
+
+	  public:
+		Propagator(World::LightEngine::Source& source, int chunkX, int chunkZ)
+			: _originX(chunkX - 1), _originZ(chunkZ - 1), _chunks(), _locks(), _touched(0), _decrease(), _increase() {
+			// Windows run in parallel are disjoint, only encoders contend for these locks
+			for (int x = 0; x < 3; x++) {
+				for (int z = 0; z < 3; z++) {
+					World::ChunkData* chunk = source.getChunk(_originX + x, _originZ + z);
+					// A chunk without sections has nothing to light
+					if (!chunk || chunk->isEmpty()) continue;
+					_chunks[x * 3 + z] = chunk;
+					_locks[x * 3 + z]  = std::unique_lock<std::shared_mutex>(chunk->lock);
+				}
+			}
+		}
+
+		void run(const std::vector<World::LightEngine::BlockPos>& changes) {
+			for (bool sky : {false, true}) {
+				for (const auto& [x, y, z] : changes) {
+					Cell cell = cellAt(x, y, z);
+					if (!cell.chunk) continue;
+
+					// The changed cell starts dark and is refilled by its neighbours and its own emission
+					uint8_t old = getLevel(cell, sky);
+					if (old > 0) {
+						setLevel(cell, sky, 0);
+						_decrease.push_back(Node{x, y, z, old});
+					}
+					uint8_t emission = sky ? 0 : propertiesAt(cell).emission;
+					if (emission > 0) {
+						setLevel(cell, sky, emission);
+						_increase.push_back(Node{x, y, z, emission});
+					}
+					for (const Direction& direction : DIRECTIONS) {
+						Cell neighbour = cellAt(x + direction.dx, y + direction.dy, z + direction.dz);
+						if (!neighbour.chunk) continue;
+						uint8_t level = getLevel(neighbour, sky);
+						if (level > 0) _increase.push_back(Node{x + direction.dx, y + direction.dy, z + direction.dz, level});
+					}
+				}
+				decrease(sky);
+				increase(sky);
+			}
+		}
+
+		// Before the locks are released: an encoder that waited for them sees the new version
+		void markTouched() {
+			for (int slot = 0; slot < 9; slot++) {
+				if (_touched & (1u << slot)) _chunks[slot]->markChanged();
+			}
+		}
+	};
+} // namespace
+
+// ============================================================================
+// LightEngine
+// ============================================================================
+
+World::LightEngine::LightEngine()
+	: _lock(), _changes(), _updateLock(), _poolLock(), _roundStart(), _roundDone(), _threads(), _round(nullptr), _roundSize(0), _nextJob(0), _busy(0),
+	  _generation(0), _stopping(false) {}
+
+World::LightEngine::~LightEngine() {
+	{
+		std::lock_guard<std::mutex> lock(_poolLock);
+		_stopping = true;
+	}
+	_roundStart.notify_all();
+	for (std::thread& thread : _threads) thread.join();
+}
+
+void World::LightEngine::poolThreadLoop() {
+	uint64_t					 seen = 0;
+	std::unique_lock<std::mutex> lock(_poolLock);
+
+	while (true) {
+		_roundStart.wait(lock, [this, seen] { return _stopping || _generation != seen; });
+		if (_stopping) return;
+		seen = _generation;
+		lock.unlock();
+
+		for (size_t i; (i = _nextJob.fetch_add(1)) < _roundSize;) (*_round)(i);
+
+		lock.lock();
+		if (--_busy == 0) _roundDone.notify_one();
+	}
+}
+
+void World::LightEngine::runRound(size_t count, const std::function<void(size_t)>& job) {
+	if (count <= 1 || _threads.empty()) {
+		for (size_t i = 0; i < count; i++) job(i);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_poolLock);
+		_round	   = &job;
+		_roundSize = count;
+		_nextJob.store(0);
+		_busy = _threads.size();
+		_generation++;
+	}
+	_roundStart.notify_all();
+
+	for (size_t i; (i = _nextJob.fetch_add(1)) < count;) job(i);
+
+	std::unique_lock<std::mutex> lock(_poolLock);
+	_roundDone.wait(lock, [this] { return _busy == 0; });
+	_round = nullptr;
+}
+
+uint8_t World::LightEngine::getEmission(uint32_t state) { return propertiesOf(state).emission; }
+
+uint8_t World::LightEngine::getOpacity(uint32_t state) { return propertiesOf(state).opacity; }
+
+void World::LightEngine::lightChunk(ChunkData& chunk) {
+	chunk.light = ChunkLight();
+	if (chunk.isEmpty()) return;
+
+	Volume&	 volume	 = Volume::local();
+	uint8_t* opacity = volume.opacity.data();
+	uint8_t* level	 = volume.level.data();
+
+	// Opacity of every cell, emitters kept aside for the block light pass
+	std::vector<std::pair<size_t, uint8_t>> emitters;
+	std::memset(opacity, 0, CHUNK_CELLS);
+	for (int index = 0; index < SECTION_COUNT; index++) {
+		const PalettedContainer& blocks = chunk.sections[static_cast<size_t>(index)].blocks;
+		size_t					 base	= static_cast<size_t>(index + 1) * SECTION_CELLS;
+		if (blocks.getMode() == PalettedContainer::Mode::Single) {
+			LightProperties properties = propertiesOf(blocks.get(0));
+			std::memset(opacity + base, properties.opacity, SECTION_CELLS);
+			for (size_t i = 0; properties.emission > 0 && i < SECTION_CELLS; i++) emitters.emplace_back(base + i, properties.emission);
+			continue;
+		}
+		blocks.forEach(0, SECTION_CELLS, [&](size_t entry, uint32_t state) {
+			LightProperties properties = propertiesOf(state);
+			opacity[base + entry]	   = properties.opacity;
+			if (properties.emission > 0) emitters.emplace_back(base + entry, properties.emission);
+		});
+	}
+
+	// Sky: every column is at 15 from the top down to its first block that is not fully transparent
+	std::memset(level, 0, CHUNK_CELLS);
+	uint8_t open[256];
+	std::memset(open, 15, sizeof(open));
+	for (int y = LIGHT_HEIGHT - 1; y >= 0; y--) {
+		size_t layer = static_cast<size_t>(y) * 256;
+		for (size_t column = 0; column < 256; column++) {
+			open[column]		  = opacity[layer + column] == 0 ? open[column] : 0;
+			level[layer + column] = open[column];
+		}
+	}
+	relax(level, opacity);
+	for (int section = 0; section < LIGHT_SECTION_COUNT; section++) chunk.light.sky[section].pack(level + section * SECTION_CELLS);
+
+	// Block light, nothing to spread in most chunks
+	if (emitters.empty()) return;
+	std::memset(level, 0, CHUNK_CELLS);
+	for (const auto& [cell, emission] : emitters) level[cell] = emission;
+	relax(level, opacity);
+	for (int section = 0; section < LIGHT_SECTION_COUNT; section++) chunk.light.block[section].pack(level + section * SECTION_CELLS);
+}
+
+void World::LightEngine::queueBlockChange(int x, int y, int z) {
+	std::lock_guard<std::mutex> lock(_lock);
+	_changes.push_back(BlockPos{x, y, z});
+}
+
+size_t World::LightEngine::getPending() const {
+	std::lock_guard<std::mutex> lock(_lock);
+	return _changes.size();
+}
+
+World::LightEngine::CacheSource::CacheSource(ChunkCache& cache, Dimension dimension) : _cache(cache), _dimension(dimension), _lock(), _pinned() {}
+
+World::ChunkData* World::LightEngine::CacheSource::getChunk(int chunkX, int chunkZ) {
+	ChunkKey					key{_dimension, chunkX, chunkZ};
+	std::lock_guard<std::mutex> lock(_lock);
+	auto						pinned = _pinned.find(key);
+	if (pinned == _pinned.end()) pinned = _pinned.emplace(key, _cache.findMutable(key)).first;
+	return pinned->second.get();
+}
+
+size_t World::LightEngine::runUpdates(Source& source) {
+	std::vector<BlockPos> changes;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		changes.swap(_changes);
+	}
+	if (changes.empty()) return 0;
+
+	// Changes grouped by chunk, then by chunk colour: chunks of one colour are three apart
+	using Changes = std::vector<BlockPos>;
+	std::unordered_map<ChunkKey, Changes, ChunkKeyHash> byChunk;
+	for (const BlockPos& change : changes) byChunk[ChunkKey{Dimension::Overworld, change.x >> 4, change.z >> 4}].push_back(change);
+
+	std::array<std::vector<std::pair<ChunkKey, const Changes*>>, 9> colours;
+	for (const auto& [key, chunkChanges] : byChunk) {
+		int colour = (((key.x % 3) + 3) % 3) * 3 + ((key.z % 3) + 3) % 3;
+		colours[static_cast<size_t>(colour)].emplace_back(key, &chunkChanges);
+	}
+
+	std::lock_guard<std::mutex> update(_updateLock);
+	if (_threads.empty()) {
+		// One thread per core, the caller included
+		size_t threads = std::max(1u, std::thread::hardware_concurrency());
+		for (size_t t = 1; t < threads; t++) _threads.emplace_back(&LightEngine::poolThreadLoop, this);
+	}
+	for (const auto& jobs : colours) {
+		runRound(jobs.size(), [&](size_t i) {
+			Propagator propagator(source, jobs[i].first.x, jobs[i].first.z);
+			propagator.run(*jobs[i].second);
+			propagator.markTouched();
+		});
+	}
+	return changes.size();
+}
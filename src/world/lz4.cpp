@@ -0,0 +1,309 @@
+#include "world/lz4.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+	constexpr size_t MIN_MATCH	   = 4;
+	constexpr size_t LAST_LITERALS = 5;	 // the block always ends with at least 5 literals
+	constexpr size_t MF_LIMIT	   = 12; // the last match starts at least 12 bytes before the end
+	constexpr size_t MAX_OFFSET	   = 65535;
+	constexpr int	 HASH_LOG	   = 14;
+
+	constexpr uint8_t STREAM_MAGIC[8]	   = {'L', 'Z', '4', 'B', 'l', 'o', 'c', 'k'};
+	constexpr size_t  STREAM_HEADER_SIZE   = sizeof(STREAM_MAGIC) + 1 + 4 + 4 + 4;
+	constexpr uint8_t METHOD_RAW		   = 0x10;
+	constexpr uint8_t METHOD_LZ4		   = 0x20;
+	constexpr int	  COMPRESSION_LEVEL_BASE = 10;
+
+	uint32_t readLE32(const uint8_t* p) {
+		return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) |
+			   (static_cast<uint32_t>(p[3]) << 24);
+	}
+
+	void writeLE32(uint8_t* p, uint32_t value) {
+		p[0] = static_cast<uint8_t>(value);
+		p[1] = static_cast<uint8_t>(value >> 8);
+		p[2] = static_cast<uint8_t>(value >> 16);
+		p[3] = static_cast<uint8_t>(value >> 24);
+	}
+
+	uint32_t read32(const uint8_t* p) {
+		uint32_t value;
+		std::memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	uint32_t hashSequence(uint32_t sequence) { return (sequence * 2654435761u) >> (32 - HASH_LOG); }
+
+	// 15 in the token, then 255s until the remainder
+	uint8_t* writeLength(uint8_t* op, size_t length) {
+		for (length -= 15; length >= 255; length -= 255) *op++ = 255;
+		*op++ = static_cast<uint8_t>(length);
+		return op;
+	}
+
+	uint8_t* writeSequence(uint8_t* op, const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength) {
+		uint8_t* token = op++;
+		*token		   = static_cast<uint8_t>(std::min<size_t>(literalLength, 15) << 4);
+		if (literalLength >= 15) op = writeLength(op, literalLength);
+		std::memcpy(op, literals, literalLength);
+		op += literalLength;
+
+		// Last sequence: literals only
+		if (matchLength == 0) return op;
+
+		*op++ = static_cast<uint8_t>(offset);
+		*op++ = static_cast<uint8_t>(offset >> 8);
+		*token |= static_cast<uint8_t>(std::min<size_t>(matchLength - MIN_MATCH, 15));
+		if (matchLength - MIN_MATCH >= 15) op = writeLength(op, matchLength - MIN_MATCH);
+		return op;
+	}
+
+	size_t readLength(const uint8_t*& ip, const uint8_t* end, size_t length) {
+		if (length != 15) return length;
+		uint8_t byte;
+		do {
+			if (ip >= end) throw std::runtime_error("LZ4 block truncated");
+			byte = *ip++;
+			length += byte;
+		} while (byte == 255);
+		return length;
+	}
+
+	uint32_t streamChecksum(std::span<const uint8_t> data) { return World::LZ4::xxHash32(data, World::LZ4::CHECKSUM_SEED) & 0x0FFFFFFF; }
+} // namespace
+
+// ========================================
+// Block format
+// ========================================
+
+size_t World::LZ4::compressBlock(std::span<const uint8_t> in, uint8_t* out) {
+	const uint8_t* base	  = in.data();
+	size_t		   size	  = in.size();
+	uint8_t*	   op	  = out;
+	size_t		   anchor = 0;
+
+	if (size > MF_LIMIT) {
+		// Greedy single-probe matcher: one candidate per hash, positions stored + 1 so 0 means empty
+		std::array<uint32_t, 1u << HASH_LOG> table{};
+		size_t								 matchLimit = size - LAST_LITERALS;
+
+		for (size_t ip = 0; ip + MF_LIMIT <= size;) {
+			uint32_t  sequence = read32(base + ip);
+			uint32_t& slot	   = table[hashSequence(sequence)];
+			size_t	  ref	   = slot;
+			slot			   = static_cast<uint32_t>(ip + 1);
+
+			if (ref == 0 || ip - (ref - 1) > MAX_OFFSET || read32(base + ref - 1) != sequence) {
+				ip++;
+				continue;
+			}
+			ref--;
+
+			size_t length = MIN_MATCH;
+			while (ip + length < matchLimit && base[ref + length] == base[ip + length]) length++;
+
+			op	   = writeSequence(op, base + anchor, ip - anchor, ip - ref, length);
+			ip	   = ip + length;
+			anchor = ip;
+		}
+	}
+	op = writeSequence(op, base + anchor, size - anchor, 0, 0);
+	return static_cast<size_t>(op - out);
+}
+
+size_t World::LZ4::decompressBlock(std::span<const uint8_t> in, std::span<uint8_t> out) {
+	const uint8_t* ip	 = in.data();
+	const uint8_t* end	 = ip + in.size();
+	uint8_t*	   op	 = out.data();
+	uint8_t*	   limit = op + out.size();
+
+	while (ip < end) {
+		uint8_t token = *ip++;
+
+		size_t literalLength = readLength(ip, end, token >> 4);
+		if (literalLength > static_cast<size_t>(end - ip) || literalLength > static_cast<size_t>(limit - op))
+			throw std::runtime_error("LZ4 literals out of bounds");
+		std::memcpy(op, ip, literalLength);
+		ip += literalLength;
+		op += literalLength;
+
+		// The last sequence has no match part
+		if (ip == end) break;
+
+		if (end - ip < 2) throw std::runtime_error("LZ4 block truncated");
+		size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+		ip += 2;
+		if (offset == 0 || offset > static_cast<size_t>(op - out.data())) throw std::runtime_error("LZ4 match offset out of bounds");
+
+		size_t matchLength = readLength(ip, end, token & 0x0F) + MIN_MATCH;
+		if (matchLength > static_cast<size_t>(limit - op)) throw std::runtime_error("LZ4 match out of bounds");
+
+		const uint8_t* match = op - offset;
+		if (offset >= matchLength) {
+			std::memcpy(op, match, matchLength);
+			op += matchLength;
+		} else {
+			// Overlapping copy repeats the last `offset` bytes, has to go forward one byte at a time
+			for (size_t i = 0; i < matchLength; i++) *op++ = *match++;
+		}
+	}
+	return static_cast<size_t>(op - out.data());
+}
+
+// ========================================
+// XXHash32
+// ========================================
+
+uint32_t World::LZ4::xxHash32(std::span<const uint8_t> data, uint32_t seed) {
+	constexpr uint32_t PRIME1 = 2654435761u;
+	constexpr uint32_t PRIME2 = 2246822519u;
+	constexpr uint32_t PRIME3 = 3266489917u;
+	constexpr uint32_t PRIME4 = 668265263u;
+	constexpr uint32_t PRIME5 = 374761393u;
+
+	auto round = [](uint32_t acc, uint32_t input) { return std::rotl(acc + input * PRIME2, 13) * PRIME1; };
+
+	const uint8_t* p   = data.data();
+	const uint8_t* end = p + data.size();
+	uint32_t	   hash;
+
+	if (data.size() >= 16) {
+		uint32_t v1 = seed + PRIME1 + PRIME2;
+		uint32_t v2 = seed + PRIME2;
+		uint32_t v3 = seed;
+		uint32_t v4 = seed - PRIME1;
+		for (; end - p >= 16; p += 16) {
+			v1 = round(v1, readLE32(p));
+			v2 = round(v2, readLE32(p + 4));
+			v3 = round(v3, readLE32(p + 8));
+			v4 = round(v4, readLE32(p + 12));
+		}
+		hash = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+	} else {
+		hash = seed + PRIME5;
+	}
+	hash += static_cast<uint32_t>(data.size());
+
+	for (; end - p >= 4; p += 4) hash = std::rotl(hash + readLE32(p) * PRIME3, 17) * PRIME4;
+	for (; p < end; p++) hash = std::rotl(hash + *p * PRIME5, 11) * PRIME1;
+
+	hash ^= hash >> 15;
+	hash *= PRIME2;
+	hash ^= hash >> 13;
+	hash *= PRIME3;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+// ========================================
+// LZ4Block stream
+// ========================================
+
+size_t World::LZ4::compressStream(std::span<const uint8_t> in, std::vector<uint8_t>& out) {
+	// Level is the block size as a power of two above 1 KiB, only used by readers as a sanity bound
+	const uint8_t level = static_cast<uint8_t>(std::bit_width(STREAM_BLOCK_SIZE - 1) - COMPRESSION_LEVEL_BASE);
+
+	auto writeHeader = [&](uint8_t* header, uint8_t method, size_t compressedSize, size_t originalSize, uint32_t checksum) {
+		std::memcpy(header, STREAM_MAGIC, sizeof(STREAM_MAGIC));
+		header[8] = method | level;
+		writeLE32(header + 9, static_cast<uint32_t>(compressedSize));
+		writeLE32(header + 13, static_cast<uint32_t>(originalSize));
+		writeLE32(header + 17, checksum);
+	};
+
+	size_t start  = out.size();
+	size_t blocks = (in.size() + STREAM_BLOCK_SIZE - 1) / STREAM_BLOCK_SIZE;
+	out.resize(start + blocks * (STREAM_HEADER_SIZE + compressBound(STREAM_BLOCK_SIZE)) + STREAM_HEADER_SIZE);
+
+	size_t written = start;
+	for (size_t offset = 0; offset < in.size(); offset += STREAM_BLOCK_SIZE) {
+		std::span<const uint8_t> block = in.subspan(offset, std::min(STREAM_BLOCK_SIZE, in.size() - offset));
+		uint8_t*				 header = out.data() + written;
+		uint8_t*				 data	= header + STREAM_HEADER_SIZE;
+
+		size_t compressedSize = compressBlock(block, data);
+		// Incompressible: stored as is, like lz4-java does
+		if (compressedSize >= block.size()) {
+			std::memcpy(data, block.data(), block.size());
+			writeHeader(header, METHOD_RAW, block.size(), block.size(), streamChecksum(block));
+			written += STREAM_HEADER_SIZE + block.size();
+		} else {
+			writeHeader(header, METHOD_LZ4, compressedSize, block.size(), streamChecksum(block));
+			written += STREAM_HEADER_SIZE + compressedSize;
+		}
+	}
+
+	// End mark: an empty raw block
+	writeHeader(out.data() + written, METHOD_RAW, 0, 0, 0);
+	written += STREAM_HEADER_SIZE;
+
+	out.resize(written);
+	return written - start;
+}
+
+size_t World::LZ4::decompressStream(std::span<const uint8_t> in, std::vector<uint8_t>& out) {
+	struct Block {
+		uint8_t					 method;
+		size_t					 originalSize;
+		uint32_t				 checksum;
+		std::span<const uint8_t> data;
+	};
+
+	// Headers first: validates the framing and gives the exact output size
+	std::vector<Block> blocks;
+	size_t			   total = 0;
+	for (size_t offset = 0; offset < in.size();) {
+		if (in.size() - offset < STREAM_HEADER_SIZE || std::memcmp(in.data() + offset, STREAM_MAGIC, sizeof(STREAM_MAGIC)) != 0)
+			throw std::runtime_error("LZ4 stream: bad block header");
+
+		const uint8_t* header		  = in.data() + offset;
+		uint8_t		   method		  = header[8] & 0xF0;
+		int			   level		  = header[8] & 0x0F;
+		size_t		   compressedSize = readLE32(header + 9);
+		size_t		   originalSize	  = readLE32(header + 13);
+		uint32_t	   checksum		  = readLE32(header + 17);
+		offset += STREAM_HEADER_SIZE;
+
+		// End mark, whatever follows is not part of the stream
+		if (compressedSize == 0 && originalSize == 0) break;
+
+		if ((method != METHOD_RAW && method != METHOD_LZ4) || originalSize > (size_t(1) << (COMPRESSION_LEVEL_BASE + level)) ||
+			(method == METHOD_RAW && compressedSize != originalSize) || compressedSize > in.size() - offset)
+			throw std::runtime_error("LZ4 stream: corrupted block of " + std::to_string(compressedSize) + " bytes");
+
+		blocks.push_back(Block{method, originalSize, checksum, in.subspan(offset, compressedSize)});
+		total += originalSize;
+		offset += compressedSize;
+	}
+
+	size_t start = out.size();
+	out.resize(start + total);
+
+	uint8_t* op = out.data() + start;
+	for (const Block& block : blocks) {
+		std::span<uint8_t> destination(op, block.originalSize);
+		try {
+			if (block.method == METHOD_RAW) {
+				std::memcpy(op, block.data.data(), block.originalSize);
+			} else if (decompressBlock(block.data, destination) != block.originalSize) {
+				throw std::runtime_error("LZ4 stream: block shorter than announced");
+			}
+			if (streamChecksum(destination) != block.checksum) throw std::runtime_error("LZ4 stream: checksum mismatch");
+		} catch (...) {
+			out.resize(start);
+			throw;
+		}
+		op += block.originalSize;
+	}
+	return total;
+}
@@ -1,62 +1,36 @@
 #include "lib/filesystem.hpp"
 #include "lib/nbtParser.hpp"
 #include "logger.hpp"
+#include "world/compression.hpp"
+#include "world/lz4.hpp"
 #include "world/world.hpp"
 
 #include <cstddef>
 #include <cstdint>
-#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <ios>
-#include <iterator>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <variant>
 #include <vector>
-#include <zconf.h>
-#include <zlib.h>
 
 std::vector<uint8_t> World::Manager::decompressGzip(std::filesystem::path compressedFilePath) {
 	// Read file into memory
-	std::ifstream file(compressedFilePath, std::ios::binary);
+	std::ifstream file(compressedFilePath, std::ios::binary | std::ios::ate);
 	if (!file) {
 		throw std::runtime_error("Could not open file: " + compressedFilePath.string());
 	}
 
-	std::vector<uint8_t> compressed((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	std::vector<uint8_t> compressed(static_cast<size_t>(file.tellg()));
+	file.seekg(0);
+	file.read(reinterpret_cast<char*>(compressed.data()), static_cast<std::streamsize>(compressed.size()));
 	file.close();
 
-	// Initialize zlib stream
-	z_stream stream;
-	std::memset(&stream, 0, sizeof(stream));
-
-	// 16 + MAX_WBITS tells zlib to decode gzip format
-	if (inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK) {
-		throw std::runtime_error("Failed to initialize gzip decompression");
-	}
-
-	// Allocate output buffer (level.dat is usually < 10MB)
-	std::vector<uint8_t> decompressed(10 * 1024 * 1024);
-
-	stream.avail_in	 = static_cast<uInt>(compressed.size());
-	stream.next_in	 = compressed.data();
-	stream.avail_out = static_cast<uInt>(decompressed.size());
-	stream.next_out	 = decompressed.data();
-
-	int ret = inflate(&stream, Z_FINISH);
-
-	if (ret != Z_STREAM_END) {
-		inflateEnd(&stream);
-		throw std::runtime_error("Decompression failed: " + std::to_string(ret));
-	}
-
-	// Resize to actual decompressed size
-	decompressed.resize(stream.total_out);
-	inflateEnd(&stream);
-
-	return decompressed;
+	// Sized from the gzip trailer, no more guessing
+	return decompressGzip(compressed);
 }
 
 World::LevelDat World::Manager::loadLevelDat(std::filesystem::path levelDatPath) {
@@ -85,6 +59,8 @@ World::LevelDat World::Manager::loadLevelDat(std::filesystem::path levelDatPath)
 					member = (dataCompound->at(key).get<nbt::TagByte>() != 0);
 				} else if constexpr (std::is_same_v<MemberType, std::byte>) {
 					member = std::byte(dataCompound->at(key).get<nbt::TagByte>());
+				} else if constexpr (std::is_same_v<MemberType, std::string>) {
+					member = std::string(dataCompound->at(key).get<nbt::TagString>());
 				} else {
 					member = dataCompound->at(key).get<MemberType>();
 				}
@@ -133,10 +109,35 @@ World::LevelDat World::Manager::loadLevelDat(std::filesystem::path levelDatPath)
 	return dataStruct;
 }
 
-std::filesystem::path World::Manager::locateRegionFileByChunkCoord(int localX, int localZ) {
-	const auto					regionDir = getPath().parent_path() / "world" / "region";
-	const std::string			filename  = "r." + std::to_string(localX / 32) + "." + std::to_string(localZ / 32) + ".mca";
-	const std::filesystem::path path	  = regionDir / filename;
+void World::Manager::setWorldPath(const std::filesystem::path& worldPath) {
+	_worldPath = worldPath;
+	_regions.setDirectory(worldPath / "region");
+}
+
+void World::Manager::saveChunk(int chunkX, int chunkZ, std::span<const uint8_t> chunkNbt) {
+	std::vector<uint8_t> payload;
+	switch (_regionCompression) {
+	case RegionCompression::Gzip:
+		ZlibCodec::local().deflate(chunkNbt, ZlibFormat::Gzip, payload);
+		break;
+	case RegionCompression::Zlib:
+		ZlibCodec::local().deflate(chunkNbt, ZlibFormat::Zlib, payload);
+		break;
+	case RegionCompression::None:
+		payload.assign(chunkNbt.begin(), chunkNbt.end());
+		break;
+	case RegionCompression::LZ4:
+		LZ4::compressStream(chunkNbt, payload);
+		break;
+	}
+
+	_regions.writeChunk(chunkX, chunkZ, _regionCompression, payload);
+	_chunkCache.erase(ChunkKey{Dimension::Overworld, chunkX, chunkZ});
+}
+
+std::filesystem::path World::Manager::locateRegionFileByChunkCoord(int chunkX, int chunkZ) {
+	// >> 5 floors negative coordinates into the right region
+	const std::filesystem::path path = _worldPath / "region" / RegionCache::regionFileName(chunkX >> 5, chunkZ >> 5);
 
 	if (std::filesystem::exists(path)) {
 		return path;
@@ -146,90 +147,15 @@ std::filesystem::path World::Manager::locateRegionFileByChunkCoord(int localX, i
 	}
 }
 
-std::vector<uint8_t> World::Manager::decompressZlib(const std::vector<uint8_t>& compressedData) {
-	if (compressedData.empty()) {
-		return {};
-	}
-
-	// Initialize zlib stream
-	z_stream stream = {};
-	stream.next_in	= const_cast<Bytef*>(compressedData.data());
-	stream.avail_in = static_cast<uInt>(compressedData.size());
-
-	// Initialize for zlib format (not gzip)
-	int ret = inflateInit(&stream);
-	if (ret != Z_OK) {
-		throw std::runtime_error("Failed to initialize zlib decompression");
-	}
-
-	// Estimate output size (start with 4x input size)
-	std::vector<uint8_t> decompressed(compressedData.size() * 4);
-
-	do {
-		stream.next_out	 = decompressed.data() + stream.total_out;
-		stream.avail_out = static_cast<uInt>(decompressed.size() - stream.total_out);
-
-		ret = inflate(&stream, Z_NO_FLUSH);
-
-		if (ret == Z_STREAM_ERROR || ret == Z_DATA_ERROR || ret == Z_MEM_ERROR) {
-			inflateEnd(&stream);
-			throw std::runtime_error("Zlib decompression error: " + std::to_string(ret));
-		}
-
-		// If we need more space, double the buffer
-		if (stream.avail_out == 0 && ret != Z_STREAM_END) {
-			decompressed.resize(decompressed.size() * 2);
-		}
-
-	} while (ret != Z_STREAM_END);
-
-	inflateEnd(&stream);
-
-	// Resize to actual decompressed size
-	decompressed.resize(stream.total_out);
+std::vector<uint8_t> World::Manager::decompressZlib(std::span<const uint8_t> compressedData) {
+	std::vector<uint8_t> decompressed;
+	ZlibCodec::local().inflate(compressedData, decompressed);
 	return decompressed;
 }
 
-std::vector<uint8_t> World::Manager::decompressGzip(const std::vector<uint8_t>& compressedData) {
-	if (compressedData.empty()) {
-		return {};
-	}
-
-	// Initialize zlib stream for gzip format
-	z_stream stream = {};
-	stream.next_in	= const_cast<Bytef*>(compressedData.data());
-	stream.avail_in = static_cast<uInt>(compressedData.size());
-
-	// Use inflateInit2 with gzip flag (16 + MAX_WBITS)
-	int ret = inflateInit2(&stream, 16 + MAX_WBITS);
-	if (ret != Z_OK) {
-		throw std::runtime_error("Failed to initialize gzip decompression");
-	}
-
-	// Estimate output size (start with 4x input size)
-	std::vector<uint8_t> decompressed(compressedData.size() * 4);
-
-	do {
-		stream.next_out	 = decompressed.data() + stream.total_out;
-		stream.avail_out = static_cast<uInt>(decompressed.size() - stream.total_out);
-
-		ret = inflate(&stream, Z_NO_FLUSH);
-
-		if (ret == Z_STREAM_ERROR || ret == Z_DATA_ERROR || ret == Z_MEM_ERROR) {
-			inflateEnd(&stream);
-			throw std::runtime_error("Gzip decompression error: " + std::to_string(ret));
-		}
-
-		// If we need more space, double the buffer
-		if (stream.avail_out == 0 && ret != Z_STREAM_END) {
-			decompressed.resize(decompressed.size() * 2);
-		}
-
-	} while (ret != Z_STREAM_END);
-
-	inflateEnd(&stream);
-
-	// Resize to actual decompressed size
-	decompressed.resize(stream.total_out);
+std::vector<uint8_t> World::Manager::decompressGzip(std::span<const uint8_t> compressedData) {
+	// The codec detects the header, both formats go through the same stream
+	std::vector<uint8_t> decompressed;
+	ZlibCodec::local().inflate(compressedData, decompressed);
 	return decompressed;
 }
@@ -0,0 +1,180 @@
+#include "world/palettedContainer.hpp"
+
+#include "data/BlockStates.hpp"
+#include "data/RegistryDataUtils.hpp"
+#include "lib/byteSwap.hpp"
+#include "network/buffer.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+	size_t varIntSize(uint32_t value) {
+		size_t size = 1;
+		while (value >= 0x80) {
+			value >>= 7;
+			size++;
+		}
+		return size;
+	}
+
+	size_t packedLongs(size_t entries, uint8_t bits) {
+		size_t perLong = 64 / bits;
+		return (entries + perLong - 1) / perLong;
+	}
+
+	// True when every packed entry is below `limit`
+	bool indicesBelow(const std::vector<uint64_t>& data, uint8_t bits, size_t entries, uint64_t limit) {
+		size_t	 perLong = 64 / bits;
+		uint64_t mask	 = (uint64_t{1} << bits) - 1;
+		for (size_t i = 0; i < entries; i++) {
+			if (((data[i / perLong] >> ((i % perLong) * bits)) & mask) >= limit) return false;
+		}
+		return true;
+	}
+} // namespace
+
+World::PalettedContainer::PalettedContainer(Kind kind, Mode mode, uint8_t bits) : _kind(kind), _mode(mode), _bits(bits), _palette(), _data() {}
+
+World::PalettedContainer::PalettedContainer(Kind kind, uint32_t value) : _kind(kind), _mode(Mode::Single), _bits(0), _palette{value}, _data() {}
+
+uint8_t World::PalettedContainer::directBits(Kind kind) {
+	if (kind == Kind::Blocks) return static_cast<uint8_t>(std::bit_width(BlockStates::STATE_COUNT - 1));
+	// The client sizes direct biome containers from the worldgen/biome registry it was sent
+	static const uint8_t biomeBits = static_cast<uint8_t>(std::bit_width(std::max<size_t>(getSyncedEntryCount("minecraft:worldgen/biome"), 2) - 1));
+	return biomeBits;
+}
+
+// Network layout of an indirect container, 0 when `paletteSize` entries need the direct form
+uint8_t World::PalettedContainer::indirectBits(Kind kind, size_t paletteSize) {
+	uint8_t bits = static_cast<uint8_t>(std::bit_width(paletteSize - 1));
+	if (kind == Kind::Blocks) {
+		bits = std::max<uint8_t>(bits, 4);
+		return bits <= 8 ? bits : 0;
+	}
+	bits = std::max<uint8_t>(bits, 1);
+	return bits <= 3 ? bits : 0;
+}
+
+World::PalettedContainer World::PalettedContainer::fromNBT(Kind kind, const nbt::TagView& container, const Resolver& resolve) {
+	nbt::TagView palette = container["palette"];
+	if (palette.size() == 0) throw std::runtime_error("Paletted container without a palette");
+
+	std::vector<uint32_t> globals;
+	globals.reserve(palette.size());
+	for (nbt::TagView entry : palette) globals.push_back(resolve(entry));
+
+	// Distinct ids in first-seen order, and the local index each disk index maps to
+	std::vector<uint32_t> local;
+	std::vector<uint32_t> remap(globals.size());
+	bool				  identity = true;
+	if (globals.size() <= 64) {
+		for (size_t i = 0; i < globals.size(); i++) {
+			auto it	 = std::find(local.begin(), local.end(), globals[i]);
+			remap[i] = static_cast<uint32_t>(it - local.begin());
+			if (it == local.end()) {
+				local.push_back(globals[i]);
+			} else {
+				identity = false;
+			}
+		}
+	} else {
+		std::unordered_map<uint32_t, uint32_t> seen;
+		seen.reserve(globals.size());
+		for (size_t i = 0; i < globals.size(); i++) {
+			auto [it, inserted] = seen.try_emplace(globals[i], static_cast<uint32_t>(local.size()));
+			remap[i]			= it->second;
+			if (inserted) {
+				local.push_back(globals[i]);
+			} else {
+				identity = false;
+			}
+		}
+	}
+	if (local.size() == 1) return PalettedContainer(kind, local[0]);
+
+	// Vanilla writes palettes of 2+ entries with at least 4 bits for blocks, exactly ceil(log2(size)) for biomes
+	size_t	entries	 = entryCount(kind);
+	uint8_t diskBits = static_cast<uint8_t>(std::bit_width(globals.size() - 1));
+	if (kind == Kind::Blocks) diskBits = std::max<uint8_t>(diskBits, 4);
+
+	nbt::BigEndianArray<int64_t> packed = container["data"].asLongArray();
+	if (packed.size() != packedLongs(entries, diskBits))
+		throw std::runtime_error("Paletted container data holds " + std::to_string(packed.size()) + " longs, expected " +
+								 std::to_string(packedLongs(entries, diskBits)));
+
+	uint8_t bits = indirectBits(kind, local.size());
+	Mode	mode = bits ? Mode::Indirect : Mode::Direct;
+	if (mode == Mode::Direct) bits = directBits(kind);
+
+	PalettedContainer result(kind, mode, bits);
+	if (mode == Mode::Indirect) result._palette = local;
+
+	// Same layout on disk and on the wire: the array is taken as is, only checked when the palette leaves
+	// index values unused
+	if (mode == Mode::Indirect && identity && bits == diskBits) {
+		result._data.resize(packed.size());
+		packed.copyTo(result._data.data());
+		if (globals.size() < (size_t{1} << bits) && !indicesBelow(result._data, bits, entries, globals.size()))
+			throw std::runtime_error("Paletted container index outside its palette");
+		return result;
+	}
+
+	std::vector<uint64_t> disk(packed.size());
+	packed.copyTo(disk.data());
+	result._data.assign(packedLongs(entries, bits), 0);
+
+	size_t	 diskPerLong = 64 / diskBits;
+	size_t	 perLong	 = 64 / bits;
+	uint64_t diskMask	 = (uint64_t{1} << diskBits) - 1;
+	uint64_t mask		 = (uint64_t{1} << bits) - 1;
+	for (size_t i = 0; i < entries; i++) {
+		uint64_t index = (disk[i / diskPerLong] >> ((i % diskPerLong) * diskBits)) & diskMask;
+		if (index >= globals.size()) throw std::runtime_error("Paletted container index outside its palette");
+		uint64_t value = mode == Mode::Indirect ? remap[index] : globals[index];
+		// A value wider than the entry would spill into its neighbours
+		result._data[i / perLong] |= (value & mask) << ((i % perLong) * bits);
+	}
+	return result;
+}
+
+size_t World::PalettedContainer::countIf(const std::function<bool(uint32_t)>& match) const {
+	if (_mode == Mode::Single) return match(_palette[0]) ? size() : 0;
+
+	size_t count = 0;
+	if (_mode == Mode::Indirect) {
+		std::vector<bool> matches(_palette.size());
+		for (size_t i = 0; i < _palette.size(); i++) matches[i] = match(_palette[i]);
+		for (size_t i = 0; i < size(); i++) count += matches[index(i)];
+	} else {
+		forEach(0, size(), [&](size_t, uint32_t id) { count += match(id); });
+	}
+	return count;
+}
+
+void World::PalettedContainer::encode(Buffer& out) const {
+	out.writeByte(_bits);
+	if (_mode != Mode::Direct) {
+		if (_mode == Mode::Indirect) out.writeVarInt(static_cast<int>(_palette.size()));
+		for (uint32_t id : _palette) out.writeVarInt(static_cast<int>(id));
+	}
+
+	auto&  bytes  = out.getData();
+	size_t offset = bytes.size();
+	bytes.resize(offset + _data.size() * sizeof(uint64_t));
+	nbt::byteSwapCopy64(bytes.data() + offset, _data.data(), _data.size());
+}
+
+size_t World::PalettedContainer::networkSize() const {
+	size_t size = 1 + _data.size() * sizeof(uint64_t);
+	if (_mode == Mode::Indirect) size += varIntSize(static_cast<uint32_t>(_palette.size()));
+	for (uint32_t id : _palette) size += varIntSize(id);
+	return size;
+}
@@ -1,71 +1,55 @@
+#include "data/RegistryDataUtils.hpp"
 #include "lib/nbt.hpp"
-#include "lib/nbtParser.hpp"
+#include "lib/nbtView.hpp"
 #include "logger.hpp"
+#include "world/blockStateResolver.hpp"
+#include "world/lightEngine.hpp"
+#include "world/compression.hpp"
+#include "world/lz4.hpp"
 #include "world/world.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
-#include <fstream>
-#include <ios>
-#include <netinet/in.h>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <zlib.h>
 
-World::ChunkData World::Query::loadChunkFromRegion(const std::filesystem::path& regionPath, int chunkX, int chunkZ) {
-
-	// Get the byte index inside the location table
-	int localX = chunkX & 31, localZ = chunkZ & 31;
-	int chunkIndex = (localZ << 5) + localX;
-
-	std::ifstream file(regionPath, std::ios::binary);
-	if (!file.is_open()) {
-		throw std::runtime_error("Cannot open region file");
-	}
-
-	file.seekg(chunkIndex * 4);
-	uint32_t locationData;
-	file.read(reinterpret_cast<char*>(&locationData), 4);
-	locationData = ntohl(locationData);
-
-	uint32_t offset		 = (locationData >> 8) & 0xFFFFFF;
-	uint8_t	 sectorCount = locationData & 0xFF;
+World::ChunkCache::ChunkRef World::Query::getChunk(int chunkX, int chunkZ, Dimension dimension) {
+	if (dimension != Dimension::Overworld) throw std::runtime_error("Only overworld chunks can be loaded");
+	return _worldManager.getChunkCache().getOrLoad(ChunkKey{dimension, chunkX, chunkZ}, [&]() { return fetchChunk(chunkX, chunkZ); });
+}
 
-	if (offset == 0 || sectorCount == 0) {
+World::ChunkData World::Query::loadChunkFromRegion(const World::RegionFile& region, int chunkX, int chunkZ) {
+	RegionChunk compressed = region.readChunk(chunkX, chunkZ);
+	if (compressed.empty()) {
 		// Chunk doesn't exist in this region
 		return ChunkData(chunkX, chunkZ);
 	}
 
-	file.seekg(offset * 4096);
-
-	uint32_t chunkLength;
-	file.read(reinterpret_cast<char*>(&chunkLength), 4);
-	chunkLength = ntohl(chunkLength);
-
-	uint8_t compressionType;
-	file.read(reinterpret_cast<char*>(&compressionType), 1);
-
-	std::vector<uint8_t> compressedData(chunkLength - 1);
-	file.read(reinterpret_cast<char*>(compressedData.data()), chunkLength - 1);
-
-	std::vector<uint8_t> decompressedData;
-	switch (compressionType) {
+	// Inflated straight into this thread's reusable buffer, it only has to outlive the parse below
+	ZlibCodec&			  codec			   = ZlibCodec::local();
+	std::vector<uint8_t>& decompressedData = codec.scratch();
+	switch (compressed.compression) {
 	case 1: // GZip
-		decompressedData = World::Manager::decompressGzip(compressedData);
-		break;
 	case 2: // Zlib
-		decompressedData = World::Manager::decompressZlib(compressedData);
+		codec.inflate(compressed.data, decompressedData);
 		break;
 	case 3: // Uncompressed
-		decompressedData = compressedData;
+		decompressedData.assign(compressed.data.begin(), compressed.data.end());
+		break;
+	case 4: // LZ4
+		LZ4::decompressStream(compressed.data, decompressedData);
 		break;
 	default:
-		throw std::runtime_error("Unknown compression type: " + std::to_string(compressionType));
+		throw std::runtime_error("Unknown compression type: " + std::to_string(compressed.compression));
 	};
 
-	nbt::Parser parser;
-	nbt::NBT	chunkNBT = parser.parse(decompressedData);
+	// Indexed in place: only the tags read below are ever decoded
+	nbt::View chunkNBT(decompressedData);
 
 	ChunkData chunk(chunkX, chunkZ);
 	extractChunkDataFromNBT(chunkNBT, chunk);
@@ -73,130 +57,125 @@ World::ChunkData World::Query::loadChunkFromRegion(const std::filesystem::path&
 	return chunk;
 }
 
-void World::Query::extractChunkDataFromNBT(const nbt::NBT& chunkNBT, World::ChunkData& chunk) {
+uint32_t World::defaultBiomeId() {
+	static const uint32_t id = static_cast<uint32_t>(std::max(getSyncedEntryId("minecraft:worldgen/biome", "minecraft:plains"), 0));
+	return id;
+}
+
+namespace {
+	std::span<const uint8_t> asBytes(std::span<const int8_t> array) { return {reinterpret_cast<const uint8_t*>(array.data()), array.size()}; }
+
+	constexpr uint32_t AIR_STATE = 0;
+
+	uint32_t resolveBiome(const nbt::TagView& entry) {
+		std::string_view name = entry.asString();
+		int				 id	  = getSyncedEntryId("minecraft:worldgen/biome", name);
+		if (id >= 0) return static_cast<uint32_t>(id);
+		g_logger->logGameInfo(WARN, "Biome " + std::string(name) + " is not synced to clients, sent as plains", "World::Query");
+		return World::defaultBiomeId();
+	}
+
+	World::ChunkSection airSection() {
+		return World::ChunkSection{0, World::PalettedContainer(World::PalettedContainer::Kind::Blocks, AIR_STATE),
+								   World::PalettedContainer(World::PalettedContainer::Kind::Biomes, World::defaultBiomeId())};
+	}
+} // namespace
+
+void World::Query::extractChunkDataFromNBT(const nbt::View& chunkNBT, World::ChunkData& chunk) {
 	try {
-		const auto& root = chunkNBT.getRoot();
+		nbt::TagView root = chunkNBT.getRoot();
 
 		// Modern format (1.18+) - data directly in root
 
 		// Extract sections (block data)
-		if (root.contains("sections")) {
-			const auto& sectionsTag = root.at("sections").get<std::shared_ptr<nbt::TagList>>();
-			extractSectionsData(*sectionsTag, chunk);
+		if (nbt::TagView sections = root["sections"]; sections.isValid()) {
+			extractSectionsData(sections, chunk);
 		}
 
-		// Extract heightmaps
-		if (root.contains("Heightmaps")) {
-			const auto& heightmapsTag = root.at("Heightmaps").get<std::shared_ptr<nbt::TagCompound>>();
-			extractHeightmaps(*heightmapsTag, chunk);
+		// Light stored by a server that had not finished lighting the chunk is not trusted, it is computed again
+		nbt::TagView lightOn = root["isLightOn"];
+		if (!chunk.isEmpty() && (!lightOn.isValid() || lightOn.asByte() == 0)) {
+			LightEngine::lightChunk(chunk);
 		}
 
-		// Extract biomes from sections
-		extractBiomesFromSections(root, chunk);
+		// Extract heightmaps, computed when the chunk has none
+		extractHeightmaps(root["Heightmaps"], chunk);
 
 		// Extract block entities
-		if (root.contains("block_entities")) {
-			const auto& blockEntitiesTag = root.at("block_entities").get<std::shared_ptr<nbt::TagList>>();
-			extractBlockEntities(*blockEntitiesTag, chunk);
+		if (nbt::TagView blockEntities = root["block_entities"]; blockEntities.isValid()) {
+			extractBlockEntities(blockEntities, chunk);
 		}
 
 	} catch (const std::exception& e) {
 		g_logger->logGameInfo(ERROR, "Failed to extract chunk data from NBT: " + std::string(e.what()), "World::Query");
-		// Leave chunk data empty - it will be treated as empty chunk
+		// No sections - it will be treated as empty chunk
+		chunk.sections.clear();
+		chunk.heightmaps = Heightmaps();
 	}
 }
 
-void World::Query::extractSectionsData(const nbt::TagList& sections, World::ChunkData& chunk) {
-	for (size_t i = 0; i < sections.size(); i++) {
-		const auto& sectionTag = sections[i].get<std::shared_ptr<nbt::TagCompound>>();
+void World::Query::extractSectionsData(const nbt::TagView& sections, World::ChunkData& chunk) {
+	// Sections absent from the file are air
+	chunk.sections.clear();
+	chunk.sections.reserve(SECTION_COUNT);
+	for (int i = 0; i < SECTION_COUNT; i++) chunk.sections.push_back(airSection());
+
+	BlockStateResolver& resolver	 = BlockStateResolver::local();
+	auto				resolveBlock = [&resolver](const nbt::TagView& entry) { return resolver.resolve(entry); };
+	uint32_t			storedSky	 = 0;
 
+	for (nbt::TagView section : sections) {
 		// Get section Y coordinate
 		int8_t sectionY = 0;
-		if (sectionTag->contains("Y")) {
-			sectionY = sectionTag->at("Y").get<nbt::TagByte>();
+		if (nbt::TagView y = section["Y"]; y.isValid()) {
+			sectionY = y.asByte();
 		}
 
-		// Extract block states
-		if (sectionTag->contains("block_states")) {
-			const auto& blockStatesTag = sectionTag->at("block_states").get<std::shared_ptr<nbt::TagCompound>>();
-			extractBlockStatesFromSection(*blockStatesTag, chunk, sectionY);
+		// Light, one section below and one above the blocks; missing block light is dark
+		if (int light = ChunkLight::sectionIndex(sectionY * 16); light >= 0) {
+			if (nbt::TagView skyLight = section["SkyLight"]; skyLight.isValid()) {
+				chunk.light.sky[light].assign(asBytes(skyLight.asByteArray()));
+				storedSky |= uint32_t{1} << light;
+			}
+			if (nbt::TagView blockLight = section["BlockLight"]; blockLight.isValid()) {
+				chunk.light.block[light].assign(asBytes(blockLight.asByteArray()));
+			}
 		}
 
-		// Extract light data if present
-		if (sectionTag->contains("SkyLight")) {
-			const auto& skyLightTag = sectionTag->at("SkyLight").get<nbt::TagByteArray>();
-			// Append to chunk.skyLight
-			size_t offset = chunk.skyLight.size();
-			chunk.skyLight.resize(offset + skyLightTag.size());
-			std::memcpy(chunk.skyLight.data() + offset, skyLightTag.data(), skyLightTag.size());
-		}
+		// The light-only sections below and above the world carry no blocks
+		int index = sectionY - MIN_SECTION_Y;
+		if (index < 0 || index >= SECTION_COUNT) continue;
+		ChunkSection& target = chunk.sections[index];
 
-		if (sectionTag->contains("BlockLight")) {
-			const auto& blockLightTag = sectionTag->at("BlockLight").get<nbt::TagByteArray>();
-			// Append to chunk.blockLight
-			size_t offset = chunk.blockLight.size();
-			chunk.blockLight.resize(offset + blockLightTag.size());
-			std::memcpy(chunk.blockLight.data() + offset, blockLightTag.data(), blockLightTag.size());
+		if (nbt::TagView blockStates = section["block_states"]; blockStates.isValid()) {
+			target.blocks		= PalettedContainer::fromNBT(PalettedContainer::Kind::Blocks, blockStates, resolveBlock);
+			target.nonAirBlocks = static_cast<uint16_t>(target.blocks.countIf([](uint32_t state) { return !BlockStateResolver::isAir(state); }));
 		}
-	}
-}
-
-void World::Query::extractBlockStatesFromSection(const nbt::TagCompound& blockStates, World::ChunkData& chunk, int8_t sectionY) {
-	// Block states contain palette and packed data array
 
-	if (blockStates.contains("data")) {
-		const auto& dataTag = blockStates.at("data").get<nbt::TagLongArray>();
-
-		// For now, just append raw packed data
-		// In a full implementation, you'd unpack the bits based on palette size
-		size_t offset = chunk.blockData.size();
-		chunk.blockData.resize(offset + dataTag.size() * sizeof(int64_t));
-		std::memcpy(chunk.blockData.data() + offset, dataTag.data(), dataTag.size() * sizeof(int64_t));
-	}
-
-	// Note: To properly decode blocks, you'd also need to:
-	// 1. Read the "palette" array to get block state mappings
-	// 2. Calculate bits per entry based on palette size
-	// 3. Unpack the long array using the calculated bits per entry
-	// 4. Map indices back to actual block states using the palette
-}
-
-void World::Query::extractHeightmaps(const nbt::TagCompound& heightmaps, World::ChunkData& chunk) {
-	// Modern chunks typically have multiple heightmap types
-	if (heightmaps.contains("MOTION_BLOCKING")) {
-		const auto& motionBlockingTag = heightmaps.at("MOTION_BLOCKING").get<nbt::TagLongArray>();
-
-		size_t dataSize = motionBlockingTag.size() * sizeof(int64_t);
-		chunk.heightmaps.resize(dataSize);
-		std::memcpy(chunk.heightmaps.data(), motionBlockingTag.data(), dataSize);
+		if (nbt::TagView biomes = section["biomes"]; biomes.isValid()) {
+			target.biomes = PalettedContainer::fromNBT(PalettedContainer::Kind::Biomes, biomes, resolveBiome);
+		}
 	}
+	chunk.light.fillMissingSky(storedSky);
 }
 
-void World::Query::extractBiomesFromSections(const nbt::TagCompound& root, World::ChunkData& chunk) {
-	// In modern format, biomes are stored in sections
-	if (root.contains("sections")) {
-		const auto& sectionsTag = root.at("sections").get<std::shared_ptr<nbt::TagList>>();
-
-		for (size_t i = 0; i < sectionsTag->size(); i++) {
-			const auto& sectionTag = (*sectionsTag)[i].get<std::shared_ptr<nbt::TagCompound>>();
-
-			if (sectionTag->contains("biomes")) {
-				const auto& biomesTag = sectionTag->at("biomes").get<std::shared_ptr<nbt::TagCompound>>();
-
-				if (biomesTag->contains("data")) {
-					const auto& biomeDataTag = biomesTag->at("data").get<nbt::TagLongArray>();
-
-					// Append biome data
-					size_t offset = chunk.biomeData.size();
-					chunk.biomeData.resize(offset + biomeDataTag.size() * sizeof(int64_t));
-					std::memcpy(chunk.biomeData.data() + offset, biomeDataTag.data(), biomeDataTag.size() * sizeof(int64_t));
-				}
+void World::Query::extractHeightmaps(const nbt::TagView& heightmaps, World::ChunkData& chunk) {
+	for (size_t index = 0; index < Heightmaps::TYPE_COUNT; index++) {
+		Heightmaps::Type type	= static_cast<Heightmaps::Type>(index);
+		nbt::TagView	 stored = heightmaps[Heightmaps::getName(type)];
+		if (stored.isValid()) {
+			try {
+				chunk.heightmaps.load(type, stored.asLongArray());
+				continue;
+			} catch (const std::exception& e) {
+				g_logger->logGameInfo(WARN, std::string(e.what()) + ", computed from the sections", "World::Query");
 			}
 		}
+		chunk.heightmaps.compute(chunk.sections, type);
 	}
 }
 
-void World::Query::extractBlockEntities(const nbt::TagList& blockEntities, World::ChunkData& chunk) {
+void World::Query::extractBlockEntities(const nbt::TagView& blockEntities, World::ChunkData& chunk) {
 	// For now, just reserve some space
 	// In a full implementation, you'd serialize each block entity properly
 	chunk.blockEntities.reserve(blockEntities.size() * 100); // Rough estimate
@@ -0,0 +1,278 @@
+#include "logger.hpp"
+#include "world/region.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+	uint32_t readBigEndian32(const uint8_t* p) {
+		return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) | (static_cast<uint32_t>(p[2]) << 8) | p[3];
+	}
+
+	void writeBigEndian32(uint8_t* p, uint32_t value) {
+		p[0] = static_cast<uint8_t>(value >> 24);
+		p[1] = static_cast<uint8_t>(value >> 16);
+		p[2] = static_cast<uint8_t>(value >> 8);
+		p[3] = static_cast<uint8_t>(value);
+	}
+
+	bool preadAll(int fd, uint8_t* data, size_t size, off_t offset) {
+		while (size > 0) {
+			ssize_t n = ::pread(fd, data, size, offset);
+			if (n == -1 && errno == EINTR) continue;
+			if (n <= 0) return false;
+			data += n;
+			size -= static_cast<size_t>(n);
+			offset += n;
+		}
+		return true;
+	}
+
+	bool pwriteAll(int fd, const uint8_t* data, size_t size, off_t offset) {
+		while (size > 0) {
+			ssize_t n = ::pwrite(fd, data, size, offset);
+			if (n == -1 && errno == EINTR) continue;
+			if (n <= 0) return false;
+			data += n;
+			size -= static_cast<size_t>(n);
+			offset += n;
+		}
+		return true;
+	}
+} // namespace
+
+std::optional<World::RegionCompression> World::parseRegionCompression(const std::string& name) {
+	if (name == "gzip") return RegionCompression::Gzip;
+	if (name == "deflate" || name == "zlib") return RegionCompression::Zlib;
+	if (name == "none") return RegionCompression::None;
+	if (name == "lz4") return RegionCompression::LZ4;
+	return std::nullopt;
+}
+
+// ========================================
+// RegionFile
+// ========================================
+
+World::RegionFile::RegionFile(const std::filesystem::path& path) : _path(path), _map(nullptr), _size(0), _locations(), _timestamps() {
+	int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd == -1) throw std::runtime_error("Cannot open region file " + path.string() + ": " + std::strerror(errno));
+
+	struct stat st;
+	if (fstat(fd, &st) == -1) {
+		::close(fd);
+		throw std::runtime_error("Cannot stat region file " + path.string());
+	}
+	_size = static_cast<size_t>(st.st_size);
+
+	// Empty or truncated header: every chunk reads as missing
+	if (_size >= 2 * SECTOR_SIZE) {
+		void* map = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (map == MAP_FAILED) {
+			::close(fd);
+			throw std::runtime_error("Cannot map region file " + path.string() + ": " + std::strerror(errno));
+		}
+		_map = static_cast<const uint8_t*>(map);
+		// Chunks are read in no particular order
+		madvise(map, _size, MADV_RANDOM);
+
+		for (size_t i = 0; i < _locations.size(); i++) {
+			_locations[i]  = readBigEndian32(_map + i * 4);
+			_timestamps[i] = readBigEndian32(_map + SECTOR_SIZE + i * 4);
+		}
+	}
+	// The mapping keeps its own reference to the file
+	::close(fd);
+}
+
+World::RegionFile::~RegionFile() {
+	if (_map) munmap(const_cast<uint8_t*>(_map), _size);
+}
+
+World::RegionChunk World::RegionFile::readChunk(int chunkX, int chunkZ) const {
+	uint32_t location = _locations[index(chunkX, chunkZ)];
+	size_t	 offset	  = static_cast<size_t>(location >> 8) * SECTOR_SIZE;
+	size_t	 sectors  = location & 0xFF;
+
+	// Chunk doesn't exist in this region
+	if (offset == 0 || sectors == 0) return {};
+
+	if (offset < 2 * SECTOR_SIZE || offset + 5 > _size) throw std::runtime_error("Chunk location outside of region file " + _path.string());
+
+	// [length: u32 BE][compression: u8][length - 1 bytes of data], the length field included in the sectors
+	uint32_t length = readBigEndian32(_map + offset);
+	if (length == 0 || static_cast<size_t>(length) + 4 > sectors * SECTOR_SIZE || offset + 4 + length > _size)
+		throw std::runtime_error("Corrupted chunk length in region file " + _path.string());
+
+	uint8_t compression = _map[offset + 4];
+	// Bit 7 means the payload lives in an external c.<x>.<z>.mcc file
+	if (compression & 0x80) throw std::runtime_error("External chunk storage (.mcc) is not supported");
+
+	return RegionChunk{compression, std::span<const uint8_t>(_map + offset + 5, length - 1)};
+}
+
+void World::RegionFile::writeChunk(const std::filesystem::path& path, int chunkX, int chunkZ, RegionCompression compression,
+								   std::span<const uint8_t> payload) {
+	// [length: u32 BE][compression: u8][payload], padded to whole sectors
+	size_t sectors = (payload.size() + 5 + SECTOR_SIZE - 1) / SECTOR_SIZE;
+	if (sectors > 255) throw std::runtime_error("Chunk too large for region file " + path.string() + " (external .mcc storage is not supported)");
+
+	std::error_code ec;
+	std::filesystem::create_directories(path.parent_path(), ec);
+
+	int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+	if (fd == -1) throw std::runtime_error("Cannot open region file " + path.string() + ": " + std::strerror(errno));
+	auto fail = [&](const std::string& what) {
+		std::string error = std::strerror(errno);
+		::close(fd);
+		throw std::runtime_error(what + " region file " + path.string() + ": " + error);
+	};
+
+	struct stat st;
+	if (fstat(fd, &st) == -1) fail("Cannot stat");
+	size_t fileSize = static_cast<size_t>(st.st_size);
+
+	std::vector<uint8_t> header(2 * SECTOR_SIZE, 0);
+	if (fileSize >= header.size()) {
+		if (!preadAll(fd, header.data(), header.size(), 0)) fail("Cannot read header of");
+	} else if (!pwriteAll(fd, header.data(), header.size(), 0)) {
+		// New (or truncated) file: start from an empty header
+		fail("Cannot initialize");
+	}
+
+	// Sectors in use, the chunk's current ones included
+	std::vector<bool> used(std::max<size_t>(2, (fileSize + SECTOR_SIZE - 1) / SECTOR_SIZE), false);
+	used[0] = used[1] = true;
+	for (size_t i = 0; i < 1024; i++) {
+		uint32_t location = readBigEndian32(header.data() + i * 4);
+		size_t	 first	  = location >> 8;
+		size_t	 count	  = location & 0xFF;
+		if (first == 0 || count == 0) continue;
+		if (first + count > used.size()) used.resize(first + count, false);
+		for (size_t sector = first; sector < first + count; sector++) used[sector] = true;
+	}
+
+	// First fit, the free run at the end of the file can grow past it
+	size_t offset = used.size();
+	for (size_t sector = 2, run = 0; sector <= used.size(); sector++) {
+		if (sector == used.size() || used[sector]) {
+			if (run >= sectors || sector == used.size()) {
+				offset = sector - run;
+				break;
+			}
+			run = 0;
+		} else {
+			run++;
+		}
+	}
+	if (offset >= (1u << 24)) fail("No sector left in");
+
+	std::vector<uint8_t> block(sectors * SECTOR_SIZE, 0);
+	writeBigEndian32(block.data(), static_cast<uint32_t>(payload.size() + 1));
+	block[4] = static_cast<uint8_t>(compression);
+	std::memcpy(block.data() + 5, payload.data(), payload.size());
+	if (!pwriteAll(fd, block.data(), block.size(), static_cast<off_t>(offset * SECTOR_SIZE))) fail("Cannot write chunk to");
+
+	// Header last: until it is updated, readers still see the previous version
+	uint8_t entry[4];
+	size_t	slot = index(chunkX, chunkZ);
+	writeBigEndian32(entry, static_cast<uint32_t>((offset << 8) | sectors));
+	if (!pwriteAll(fd, entry, sizeof(entry), static_cast<off_t>(slot * 4))) fail("Cannot update location in");
+	writeBigEndian32(entry, static_cast<uint32_t>(std::time(nullptr)));
+	if (!pwriteAll(fd, entry, sizeof(entry), static_cast<off_t>(SECTOR_SIZE + slot * 4))) fail("Cannot update timestamp in");
+
+	::close(fd);
+}
+
+// ========================================
+// RegionCache
+// ========================================
+
+World::RegionCache::RegionCache(size_t capacity) : _directory(), _capacity(capacity ? capacity : 1), _lock(), _lru(), _index(), _writeLocks() {}
+
+void World::RegionCache::setDirectory(const std::filesystem::path& directory) {
+	std::lock_guard<std::mutex> lock(_lock);
+	_directory = directory;
+	_lru.clear();
+	_index.clear();
+}
+
+std::filesystem::path World::RegionCache::regionFileName(int regionX, int regionZ) {
+	return "r." + std::to_string(regionX) + "." + std::to_string(regionZ) + ".mca";
+}
+
+void World::RegionCache::writeChunk(int chunkX, int chunkZ, RegionCompression compression, std::span<const uint8_t> payload) {
+	Key key{chunkX >> 5, chunkZ >> 5};
+
+	std::mutex*			  regionLock;
+	std::filesystem::path path;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		regionLock = &_writeLocks[key]; // map nodes never move
+		path	   = _directory / regionFileName(key.first, key.second);
+	}
+
+	// A region mapped while the write runs still sees the previous header, or a complete new chunk: the payload
+	// is written before the header. Its mapping is dropped below either way.
+	std::lock_guard<std::mutex> regionGuard(*regionLock);
+	RegionFile::writeChunk(path, chunkX, chunkZ, compression, payload);
+
+	// Also drops a "does not exist" entry. Readers holding the old mapping finish on the previous version.
+	std::lock_guard<std::mutex> lock(_lock);
+	auto						it = _index.find(key);
+	if (it != _index.end()) {
+		_lru.erase(it->second);
+		_index.erase(it);
+	}
+}
+
+std::shared_ptr<const World::RegionFile> World::RegionCache::getRegionForChunk(int chunkX, int chunkZ) {
+	// Arithmetic shift floors: chunk -1 is in region -1, not 0
+	return getRegion(chunkX >> 5, chunkZ >> 5);
+}
+
+std::shared_ptr<const World::RegionFile> World::RegionCache::getRegion(int regionX, int regionZ) {
+	Key key{regionX, regionZ};
+
+	std::lock_guard<std::mutex> lock(_lock);
+	auto						it = _index.find(key);
+	if (it != _index.end()) {
+		_lru.splice(_lru.begin(), _lru, it->second);
+		return it->second->second;
+	}
+
+	// Opened under the lock: concurrent misses on the same region map it once
+	std::shared_ptr<const RegionFile> region;
+	std::filesystem::path			  path = _directory / regionFileName(regionX, regionZ);
+	std::error_code					  ec;
+	if (std::filesystem::exists(path, ec)) {
+		try {
+			region = std::make_shared<const RegionFile>(path);
+		} catch (const std::exception& e) {
+			g_logger->logGameInfo(ERROR, e.what(), "World::RegionCache");
+		}
+	}
+
+	_lru.emplace_front(key, region);
+	_index[key] = _lru.begin();
+	if (_lru.size() > _capacity) {
+		// Readers still holding the evicted region keep it mapped until they are done
+		_index.erase(_lru.back().first);
+		_lru.pop_back();
+	}
+	return region;
+}
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Generate include/data/BlockStates.hpp from the vanilla data generator's blocks.json.
+
+    java -DbundlerMainClass=net.minecraft.data.Main -jar server.jar --reports
+    python3 tools/gen_block_states.py <generated/reports/blocks.json> > include/data/BlockStates.hpp
+
+Vanilla numbers the states of a block consecutively, as the cartesian product of its properties in
+report order with the last property varying fastest. A block is therefore stored as its first and
+default state plus its property definitions, and the state of any property combination is computed
+instead of listed: ~1100 blocks instead of ~28000 states. Identical property definitions (axis,
+waterlogged, facing...) are shared. Block names are looked up through the same hash-and-displace
+perfect hash as include/data/RegistryTable.hpp (see gen_registry_ids.py).
+"""
+
+import json
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from gen_registry_ids import perfect_hash, wrap  # noqa: E402
+
+
+def state_layout(name, block):
+    """-> (first state, default state, [(property, [values])]), checking the report matches the computed layout"""
+    properties = list(block.get("properties", {}).items())
+    states = block["states"]
+    first = min(state["id"] for state in states)
+    default = next(state["id"] for state in states if state.get("default"))
+
+    expected = 1
+    for _, values in properties:
+        expected *= len(values)
+    if len(states) != expected:
+        sys.exit(f"{name}: {len(states)} states, {expected} expected from its properties")
+
+    for state in states:
+        offset, stride = 0, 1
+        for prop, values in reversed(properties):
+            offset += values.index(state["properties"][prop]) * stride
+            stride *= len(values)
+        if state["id"] != first + offset:
+            sys.exit(f"{name}: state {state['id']} is not at its computed position {first + offset}")
+    return first, default, properties
+
+
+def main():
+    with open(sys.argv[1]) as f:
+        report = json.load(f)
+
+    values, value_index = [], {}
+    props, prop_index = [], {}
+    block_props = []
+    blocks = []
+    for name in sorted(report):
+        first, default, properties = state_layout(name, report[name])
+        start = len(block_props)
+        for prop, prop_values in properties:
+            key = (prop, tuple(prop_values))
+            if key not in prop_index:
+                if key[1] not in value_index:
+                    value_index[key[1]] = len(values)
+                    values.extend(prop_values)
+                prop_index[key] = len(props)
+                props.append((prop, value_index[key[1]], len(prop_values)))
+            block_props.append(prop_index[key])
+        blocks.append((name, first, default, start, len(properties)))
+
+    seeds, slots = perfect_hash([name for name, *_ in blocks])
+    state_count = max(state["id"] for block in report.values() for state in block["states"]) + 1
+
+    out = [
+        "// Generated by tools/gen_block_states.py from the data generator's blocks.json - do not edit",
+        "#ifndef BLOCK_STATES_HPP",
+        "#define BLOCK_STATES_HPP",
+        "",
+        '#include "BlockStateTable.hpp"',
+        "",
+        "#include <cstdint>",
+        "#include <string_view>",
+        "",
+        "namespace BlockStatesData {",
+        "\t// name, first state, default state, first entry in BLOCK_PROPERTIES, property count",
+        "\tinline constexpr BlockStateBlock BLOCKS[] = {",
+        wrap([f'{{"{n}", {f}, {d}, {s}, {c}}}' for n, f, d, s, c in blocks], "\t\t\t"),
+        "\t};",
+        "\tinline constexpr uint32_t SEEDS[] = {",
+        wrap([str(s) for s in seeds], "\t\t\t"),
+        "\t};",
+        "\tinline constexpr uint16_t SLOTS[] = {",
+        wrap([str(s) for s in slots], "\t\t\t"),
+        "\t};",
+        "\tinline constexpr uint16_t BLOCK_PROPERTIES[] = {",
+        wrap([str(p) for p in block_props], "\t\t\t"),
+        "\t};",
+        "\t// name, first entry in VALUES, value count",
+        "\tinline constexpr BlockStateProperty PROPERTIES[] = {",
+        wrap([f'{{"{n}", {v}, {c}}}' for n, v, c in props], "\t\t\t"),
+        "\t};",
+        "\tinline constexpr std::string_view VALUES[] = {",
+        wrap([f'"{v}"' for v in values], "\t\t\t"),
+        "\t};",
+        "} // namespace BlockStatesData",
+        "",
+        "class BlockStates {",
+        "  public:",
+        f"\tstatic constexpr uint32_t STATE_COUNT = {state_count};",
+        "",
+        "\tstatic constexpr BlockStateTable TABLE = BlockStateTable(BlockStatesData::BLOCKS, BlockStatesData::SEEDS, BlockStatesData::SLOTS,",
+        "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t  BlockStatesData::BLOCK_PROPERTIES, BlockStatesData::PROPERTIES, BlockStatesData::VALUES);",
+        "",
+        "\tstatic constexpr const BlockStateTable& get() { return TABLE; }",
+        "};",
+        "",
+        "#endif // BLOCK_STATES_HPP",
+    ]
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""Generate include/data/RegistryIds.hpp from the vanilla data generator's registries.json.
+
+    python3 tools/gen_registry_ids.py <generated/reports/registries.json> > include/data/RegistryIds.hpp
+
+Every registry becomes constexpr arrays consumed by RegistryTable (include/data/RegistryTable.hpp):
+entries sorted by name, a hash-and-displace minimal perfect hash (bucket seeds + slot -> entry index)
+and a dense id -> name array. hash() must stay in sync with RegistryTable::hash.
+"""
+
+import json
+import re
+import sys
+
+MASK = 0xFFFFFFFF
+
+
+def rt_hash(seed, key):
+    h = (2166136261 ^ seed) & MASK
+    for c in key.encode():
+        h ^= c
+        h = (h * 16777619) & MASK
+    h ^= h >> 15
+    h = (h * 0x2C1B3C6D) & MASK
+    h ^= h >> 12
+    return h
+
+
+def perfect_hash(names):
+    n = len(names)
+    bucket_count = max(1, (n + 3) // 4)
+    buckets = [[] for _ in range(bucket_count)]
+    for index, name in enumerate(names):
+        buckets[rt_hash(0, name) % bucket_count].append(index)
+
+    seeds = [0] * bucket_count
+    slots = [None] * n
+    for b in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        members = buckets[b]
+        if not members:
+            continue
+        seed = 1
+        while True:
+            wanted = [rt_hash(seed, names[i]) % n for i in members]
+            if len(set(wanted)) == len(wanted) and all(slots[s] is None for s in wanted):
+                break
+            seed += 1
+        seeds[b] = seed
+        for i, s in zip(members, wanted):
+            slots[s] = i
+    return seeds, slots
+
+
+def ident(registry):
+    return re.sub(r"[^A-Z0-9]", "_", registry.split(":", 1)[1].upper())
+
+
+def accessor(registry):
+    return "get" + "".join(p.capitalize() for p in re.split(r"[_/]", registry.split(":", 1)[1]))
+
+
+def wrap(items, indent, width=140):
+    lines, line = [], indent
+    for item in items:
+        piece = item + ", "
+        if len(line) + len(piece) > width and line.strip():
+            lines.append(line.rstrip())
+            line = indent
+        line += piece
+    if line.strip():
+        lines.append(line.rstrip())
+    return "\n".join(lines)
+
+
+def emit_table(out, prefix, pairs):
+    """pairs: list of (name, id)"""
+    pairs = sorted(pairs)
+    names = [name for name, _ in pairs]
+    seeds, slots = perfect_hash(names) if pairs else ([0], [])
+    dense = [""] * (max((i for _, i in pairs), default=-1) + 1)
+    for name, i in pairs:
+        dense[i] = name
+
+    out.append(f"\tinline constexpr RegistryIdEntry {prefix}_ENTRIES[] = {{")
+    out.append(wrap([f'{{"{name}", {i}}}' for name, i in pairs], "\t\t\t"))
+    out.append("\t};")
+    out.append(f"\tinline constexpr uint32_t {prefix}_SEEDS[] = {{")
+    out.append(wrap([str(s) for s in seeds], "\t\t\t"))
+    out.append("\t};")
+    out.append(f"\tinline constexpr uint16_t {prefix}_SLOTS[] = {{")
+    out.append(wrap([str(s) for s in slots], "\t\t\t"))
+    out.append("\t};")
+    out.append(f"\tinline constexpr std::string_view {prefix}_NAMES[] = {{")
+    out.append(wrap([f'"{name}"' for name in dense], "\t\t\t"))
+    out.append("\t};")
+    out.append("")
+
+
+def main():
+    with open(sys.argv[1]) as f:
+        registries = json.load(f)
+    names = sorted(registries)
+
+    out = [
+        "// Generated by tools/gen_registry_ids.py from the data generator's registries.json - do not edit",
+        "#ifndef REGISTRY_IDS_HPP",
+        "#define REGISTRY_IDS_HPP",
+        "",
+        '#include "RegistryTable.hpp"',
+        "",
+        "#include <array>",
+        "#include <cstdint>",
+        "#include <string_view>",
+        "",
+        "namespace RegistryIdsData {",
+    ]
+    for registry in names:
+        pairs = [(entry, data["protocol_id"]) for entry, data in registries[registry]["entries"].items()]
+        emit_table(out, ident(registry), pairs)
+    emit_table(out, "REGISTRY", [(registry, index) for index, registry in enumerate(names)])
+    out.append("} // namespace RegistryIdsData")
+    out.append("")
+    out.append("#define REGISTRY_TABLE(NAME) \\")
+    out.append("\tRegistryTable(RegistryIdsData::NAME##_ENTRIES, RegistryIdsData::NAME##_SEEDS, RegistryIdsData::NAME##_SLOTS, RegistryIdsData::NAME##_NAMES)")
+    out.append("")
+    out.append("class RegistryIds {")
+    out.append("  public:")
+    for registry in names:
+        out.append(f"\tstatic constexpr RegistryTable {ident(registry)} = REGISTRY_TABLE({ident(registry)});")
+    out.append("")
+    out.append("\t// Registry name (\"minecraft:block\") -> table, in the same order as REGISTRY_NAMES")
+    out.append(f"\tstatic constexpr RegistryTable REGISTRY = REGISTRY_TABLE(REGISTRY);")
+    out.append(f"\tstatic constexpr std::array<const RegistryTable*, {len(names)}> ALL = {{")
+    out.append(wrap([f"&{ident(registry)}" for registry in names], "\t\t\t"))
+    out.append("\t};")
+    out.append("")
+    for registry in names:
+        out.append(f"\tstatic constexpr const RegistryTable& {accessor(registry)}() {{ return {ident(registry)}; }}")
+    out.append("")
+    out.append("\t// Table for a registry name, nullptr when unknown")
+    out.append("\tstatic constexpr const RegistryTable* getRegistry(std::string_view registryType) {")
+    out.append("\t\tauto index = REGISTRY.find(registryType);")
+    out.append("\t\treturn index ? ALL[*index] : nullptr;")
+    out.append("\t}")
+    out.append("")
+    out.append("\t// Protocol id of entryName in registryType, 0 when either is unknown")
+    out.append("\tstatic constexpr uint32_t getRegistryId(std::string_view registryType, std::string_view entryName) {")
+    out.append("\t\tconst RegistryTable* table = getRegistry(registryType);")
+    out.append("\t\treturn table ? table->getId(entryName) : 0;")
+    out.append("\t}")
+    out.append("")
+    out.append("\tstatic constexpr const RegistryTable& getAvailableRegistries() { return REGISTRY; }")
+    out.append("};")
+    out.append("")
+    out.append("#undef REGISTRY_TABLE")
+    out.append("")
+    out.append("#endif // REGISTRY_IDS_HPP")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()